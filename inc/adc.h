@@ -32,6 +32,8 @@
 #include "stdio.h"
 #include "main.h"
 #include <stdbool.h>
+#include "tim.h"
+#include "adc_plan.h"
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /*																											*/
@@ -39,7 +41,122 @@
 /*																										    */
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 #define t_ADCVREG_SETUP                      2		// 2ms
-#define V_REF_plus                           3.3f   // Internal Voltage Reference
+#define V_REF_plus                           3.3f   // Nominal VREF+ (= VDDA), see adc_vref.h for the measured one
+
+/*
+ * Analog front-end: VREF+ and the 47k/10k input divider. Used by adc_convert.h to fold the
+ * code -> millivolt scale factor into integer constants at compile time.
+ */
+#define ADC_VREF_mV                          3300U  // VREF+ in millivolts (matches V_REF_plus), nominal scale
+#define ADC_DIVIDER_R_TOP                    47U    // Divider top resistor (kOhm)
+#define ADC_DIVIDER_R_BOTTOM                 10U    // Divider bottom resistor (kOhm)
+#define ADC_RESOLUTION_BITS                  ADC_PLAN_RES_BITS  // Boot resolution (adc_plan.h), see ADC1_ConfigResolution()
+
+#define ADC_SCAN_MAX_CHANNELS                8U     // CHSELRMOD = 1 sequencer depth (SQ1..SQ8)
+#define ADC_SCAN_MAX_SEQ_CHANNEL             14U    // SQx is 4 bits, 0xF terminates the sequence
+#define ADC_MAX_CHANNEL                      18U    // CHSEL0..CHSEL18
+#define ADC_DR_BITS                          16U    // ADC_DR DATA[15:0]
+#define ADC_OVS_MAX_SHIFT                    8U     // OVSS = 1000
+#define ADC_EXTSEL_TIM3_TRGO                 0x3UL  // EXTSEL = 011: TRG3 (TIM3_TRGO)
+#define ADC_EXTEN_RISING                     0x1UL  // EXTEN = 01: hardware trigger on rising edge
+
+/*
+ * Non-blocking bring-up options (ADC1_InitAsync)
+ */
+#define ADC_INIT_FLAG_IRQ                    (1UL << 0)   // EOCAL / ADRDY interrupts run the steps after the regulator wait
+#define ADC_INIT_FLAG_CALCACHE               (1UL << 1)   // Restore / save CALFACT in a TAMP backup register
+
+#define ADC_CALCACHE_BKPR                    (TAMP->BKP4R)  // Backup register holding the cached CALFACT
+#define ADC_CALCACHE_MAGIC                   0xCA100000UL   // Bits 31:20 tag a valid entry
+#define ADC_CALCACHE_MAGIC_MASK              0xFFF00000UL
+#define ADC_CALCACHE_CHECK_Pos               8U             // Bits 14:8 hold ~CALFACT
+
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * 14.3.9: SMPx[2:0] encodings
+ */
+typedef enum {
+	ADC_SMP_1_5   = 0,                                            //000: 1.5 ADC clock cycles
+	ADC_SMP_3_5   = 1,                                            //001: 3.5 ADC clock cycles
+	ADC_SMP_7_5   = 2,                                            //010: 7.5 ADC clock cycles
+	ADC_SMP_12_5  = 3,                                            //011: 12.5 ADC clock cycles
+	ADC_SMP_19_5  = 4,                                            //100: 19.5 ADC clock cycles
+	ADC_SMP_39_5  = 5,                                            //101: 39.5 ADC clock cycles
+	ADC_SMP_79_5  = 6,                                            //110: 79.5 ADC clock cycles
+	ADC_SMP_160_5 = 7                                             //111: 160.5 ADC clock cycles
+} ADC_SampleTime_t;
+
+/*
+ * 14.3.7: Resolution (RES[1:0])
+ */
+typedef enum {
+	ADC_RES_12BIT = 0,                                            //00: 12 bits, tCONV 12.5 ADC clock cycles
+	ADC_RES_10BIT = 1,                                            //01: 10 bits, tCONV 10.5
+	ADC_RES_8BIT  = 2,                                            //10: 8 bits, tCONV 8.5
+	ADC_RES_6BIT  = 3                                             //11: 6 bits, tCONV 6.5
+} ADC_Resolution_t;
+
+/*
+ * 14.6: Data alignment (ALIGN). Left: 12/10/8-bit results end at bit 15, 6-bit results end at bit 7.
+ */
+typedef enum {
+	ADC_ALIGN_RIGHT = 0,
+	ADC_ALIGN_LEFT  = 1
+} ADC_Align_t;
+
+/*
+ * 14.3.8: Channel selection modes
+ */
+typedef enum {
+	ADC_SCAN_BITMASK  = 0,                                        //CHSELRMOD = 0: channel-number order (SCANDIR)
+	ADC_SCAN_SEQUENCE = 1                                         //CHSELRMOD = 1: programmed order SQ1..SQ8
+} ADC_ScanMode_t;
+
+typedef struct {
+	ADC_ScanMode_t   Mode;
+	bool             Backward;                                    //SCANDIR, bitmask mode only
+	uint8_t          NumChannels;                                 //1..ADC_SCAN_MAX_CHANNELS
+	uint8_t          Channels[ADC_SCAN_MAX_CHANNELS];             //Channel numbers
+	ADC_SampleTime_t SampleTime[ADC_SCAN_MAX_CHANNELS];           //Per channel, at most two distinct values
+} ADC_ScanConfig_t;
+
+/*
+ * 14.7: Oversampler ratio (OVSR[2:0])
+ */
+typedef enum {
+	ADC_OVS_RATIO_2   = 0,                                        //000: 2x
+	ADC_OVS_RATIO_4   = 1,                                        //001: 4x
+	ADC_OVS_RATIO_8   = 2,                                        //010: 8x
+	ADC_OVS_RATIO_16  = 3,                                        //011: 16x
+	ADC_OVS_RATIO_32  = 4,                                        //100: 32x
+	ADC_OVS_RATIO_64  = 5,                                        //101: 64x
+	ADC_OVS_RATIO_128 = 6,                                        //110: 128x
+	ADC_OVS_RATIO_256 = 7                                         //111: 256x
+} ADC_OvsRatio_t;
+
+/*
+ * 14.3.2-14.3.4: Bring-up sequence (ADC1_InitAsync / ADC1_InitPoll)
+ */
+typedef enum {
+	ADC_INIT_IDLE        = 0,                                     //ADC1_InitAsync() not called yet
+	ADC_INIT_VREG        = 1,                                     //Waiting for the voltage regulator
+	ADC_INIT_CALIBRATING = 2,                                     //ADCAL running
+	ADC_INIT_ENABLING    = 3,                                     //ADEN set, waiting for ADRDY
+	ADC_INIT_READY       = 4,                                     //Ready for ADSTART
+	ADC_INIT_ERROR       = 5                                      //ADCAL precondition failed (ADEN, ADVREGEN or DMAEN)
+} ADC_InitState_t;
+
+typedef struct {
+	bool            Enable;                                       //OVSE
+	ADC_OvsRatio_t  Ratio;                                        //OVSR
+	uint8_t         Shift;                                        //OVSS, 0..8 bits right shift
+	bool            Triggered;                                    //TOVS: one trigger per oversampled conversion
+} ADC_OvsConfig_t;
 
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
@@ -47,6 +164,9 @@
 /*                                          DATA PROCESSING                                                 */
 /*																						 				    */
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+uint32_t ADC_Scan_GetLength(void);
+uint32_t ADC_Scan_GetOrder(uint8_t *pChannels);
+uint32_t ADC_Scan_Deinterleave(const uint16_t *pData, uint32_t Length, uint16_t *const pOut[]);
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /*																											*/
@@ -55,7 +175,21 @@
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 
 void ADC1_Init(void);
+void ADC1_InitAsync(uint32_t Flags);
+ADC_InitState_t ADC1_InitPoll(void);
+void ADC1_Init_IRQHandler(void);
+void ADC1_InvalidateCalibration(void);
 void ADC1_Start(void);
+void ADC1_Stop(void);
+bool ADC1_ConfigScan(const ADC_ScanConfig_t *pConfig);
+bool ADC1_ConfigOversampling(const ADC_OvsConfig_t *pConfig);
+bool ADC1_ConfigResolution(ADC_Resolution_t Resolution, ADC_Align_t Align);
+uint32_t ADC1_GetResolutionBits(void);
+uint32_t ADC1_GetResultBits(void);
+bool ADC1_ConfigTimerTrigger(uint32_t RateHz, TIM_Timebase_t *pTimebase);
+void ADC1_ConfigFreeRun(void);
+void ADC1_ConfigAutoOff(bool Enable);
+void ADC1_AdoptConfig(const uint8_t *pOrder, uint32_t Length, uint32_t ResolutionBits, uint32_t ResultBits);
 
 uint16_t ADC1_Read(void);
 #endif /* CUSTOM_DRIVERS_ADC_INC_ADC_H_ */
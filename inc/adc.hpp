@@ -0,0 +1,313 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc.hpp                              ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 26, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Driver - Compile-Time Register Configuration (C++)    ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides a header-only C++17 layer over the C driver: instance, channel set,            *
+ * resolution, sampling time and DMA channel are template parameters, and the complete CFGR1, CFGR2,        *
+ * SMPR, CHSELR, common CCR and DMA CCR values are folded into constants at compile time.                   *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - adc::Adc1 instance, adc::Channels<...> channel set.                                                  *
+ *   - adc::Driver<...>: register constants, static_assert checks, Attach(), Configure(), Start().          *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - using Acq = adc::Driver<adc::Adc1, adc::Channels<0, 13>, ADC_RES_12BIT, ADC_SMP_39_5, 1>;            *
+ *   - ADC1_InitPoll() until ADC_INIT_READY, Acq::Attach() once, Acq::Configure() on every (re)config,      *
+ *     then ADC_Stream_Start() or Acq::Start(buffer).                                                       *
+ *   - Invalid combinations (channel range, sequencer limits, sampling time below the source settling       *
+ *     time, 8-bit buffers for wider results, DMA channel) fail to compile.                                 *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h (types, adc_plan.h clock plan, ADC1_AdoptConfig()), dma.h (channel allocator), adc_vref.h.     *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_HPP_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_HPP_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define _Static_assert static_assert                              //C11 checks in adc_convert.h
+extern "C" {
+#include "adc.h"
+#include "dma.h"
+#include "adc_vref.h"
+}
+#undef _Static_assert
+#include <stdint.h>
+#include <stddef.h>
+
+namespace adc {
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INSTANCES                                                      */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Register blocks of one ADC. Functions rather than constants: the CMSIS pointers are casts, which a
+ * template argument cannot hold, and inline to the same literal address.
+ */
+struct Adc1 {
+	static ADC_TypeDef        *Regs(void)   { return ADC1; }
+	static ADC_Common_TypeDef *Common(void) { return ADC; }
+};
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CHANNEL SET                                                    */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Channels in conversion order. Strictly rising or falling lists use the bitmask mode (SCANDIR), any
+ * other order (or a repeated channel) the SQ1..SQ8 sequencer.
+ */
+template <uint8_t... Ch>
+struct Channels {
+	static constexpr uint32_t Count            = sizeof...(Ch);
+	static constexpr uint8_t  Order[Count]     = { Ch... };
+	static constexpr uint32_t Mask             = (0UL | ... | (1UL << Ch));
+	static constexpr bool     HasVrefint       = ((Ch == ADC_VREF_CHANNEL_VREFINT) || ...);
+	static constexpr bool     HasTsense        = ((Ch == ADC_VREF_CHANNEL_TSENSE) || ...);
+	static constexpr bool     HasExternal      = (((Ch != ADC_VREF_CHANNEL_TSENSE) &&
+	                                               (Ch != ADC_VREF_CHANNEL_VREFINT)) || ...);
+
+	static constexpr bool Monotonic(bool Rising) {
+		for (uint32_t i = 1; i < Count; i++) {
+			if (Rising ? (Order[i] <= Order[i - 1U]) : (Order[i] >= Order[i - 1U])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static constexpr bool     Backward         = (Count > 1U) && Monotonic(false);
+	static constexpr bool     Sequence         = !Monotonic(true) && !Backward;
+
+	/*
+	 * CHSELR: channel bits, or SQx nibbles with unused slots at 0xF (end of sequence)
+	 */
+	static constexpr uint32_t Chselr(void) {
+		uint32_t chselr = 0xFFFFFFFFUL;
+
+		if (!Sequence) {
+			return Mask;
+		}
+		for (uint32_t i = 0; i < Count; i++) {
+			chselr &= ~(0xFUL << (4U * i));
+			chselr |= ((uint32_t)Order[i] << (4U * i));
+		}
+		return chselr;
+	}
+
+	static_assert(Count >= 1U, "adc::Channels: at least one channel");
+	static_assert(((Ch <= ADC_MAX_CHANNEL) && ...), "adc::Channels: channel above CHSEL18");
+	static_assert(Count <= ADC_SCAN_MAX_CHANNELS, "adc::Channels: up to 8 (SQ1..SQ8, scan order in adc.c)");
+	static_assert(!Sequence || ((Ch <= ADC_SCAN_MAX_SEQ_CHANNEL) && ...),
+	              "adc::Channels: sequencer order needs channels 0..14, list them rising or falling instead");
+};
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DRIVER                                                         */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Free-running continuous conversions into a circular DMA buffer, clock from adc_plan.h. One sampling
+ * time (SMP1) for the whole set, oversampler off. Timer triggers, AUTOFF and oversampling are added
+ * afterwards with the C calls, which modify the registers written here. The AWD1 fields of CFGR1 belong
+ * to ADC_AWD_Config() (and the capture trigger) and survive Configure().
+ */
+template <class Instance, class ChannelSet, ADC_Resolution_t Res, ADC_SampleTime_t Smp, uint32_t DmaChannel,
+          DMA_Priority_t DmaPriority = DMA_PRIORITY_HIGH, ADC_Align_t Align = ADC_ALIGN_RIGHT>
+class Driver {
+public:
+	static constexpr uint32_t ResolutionBits = 12U - 2U * (uint32_t)Res;
+	static constexpr uint32_t ResultBits     = (Align == ADC_ALIGN_RIGHT) ? ResolutionBits :
+	                                           (ResolutionBits == 6U) ? 8U : ADC_DR_BITS;
+
+	/*
+	 * Timing in half ADC clock cycles, as adc_plan.h
+	 */
+	static constexpr int64_t  SampleNs       = ADC_PLAN_SMP_H((int)Smp) * 500000000LL * ADC_PLAN_PRESC_DIV /
+	                                           ADC_PLAN_SYSCLK_HZ;
+	static constexpr uint32_t ConversionHz   = (2UL * ADC_PLAN_SYSCLK_HZ) / (ADC_PLAN_PRESC_DIV *
+	                                           (ADC_PLAN_SMP_H((int)Smp) + ADC_PLAN_TCONV_H((int)ResolutionBits)));
+	static constexpr uint32_t ScanHz         = ConversionHz / ChannelSet::Count;
+
+	/*
+	 * Register images
+	 */
+	static constexpr uint32_t Cfgr1 = ((uint32_t)Res << ADC_CFGR1_RES_Pos) |
+	                                  ((Align == ADC_ALIGN_LEFT) ? ADC_CFGR1_ALIGN : 0U) |
+	                                  (ChannelSet::Sequence ? ADC_CFGR1_CHSELRMOD : 0U) |
+	                                  (ChannelSet::Backward ? ADC_CFGR1_SCANDIR : 0U) |
+	                                  ADC_CFGR1_CONT |                //Continuous, EXTEN = 00
+	                                  ADC_CFGR1_DMACFG |              //Circular DMA requests
+	                                  ADC_CFGR1_DMAEN;
+	static constexpr uint32_t Cfgr1Keep = ADC_CFGR1_AWD1EN | ADC_CFGR1_AWD1SGL | ADC_CFGR1_AWD1CH;  //Watchdog 1
+	static constexpr uint32_t Cfgr2 = (uint32_t)ADC_PLAN_CKMODE << ADC_CFGR2_CKMODE_Pos;
+	static constexpr uint32_t Smpr  = ((uint32_t)Smp << ADC_SMPR_SMP1_Pos) |
+	                                  ((uint32_t)Smp << ADC_SMPR_SMP2_Pos);   //SMPSELx = 0: all on SMP1
+	static constexpr uint32_t Chselr = ChannelSet::Chselr();
+	static constexpr uint32_t Ccr   = ((uint32_t)ADC_PLAN_PRESC << ADC_CCR_PRESC_Pos) |
+	                                  (ChannelSet::HasVrefint ? ADC_CCR_VREFEN : 0U) |
+	                                  (ChannelSet::HasTsense ? ADC_CCR_TSEN : 0U);
+
+	static constexpr uint32_t DmaCcr(uint32_t ElementBits) {
+		return ((uint32_t)DmaPriority << DMA_CCR_PL_Pos) |
+		       DMA_CCR_CIRC | DMA_CCR_MINC |                          //DIR = 0, PINC = 0: ADC_DR -> buffer
+		       (DMA_SIZE_16BIT << DMA_CCR_PSIZE_Pos) |
+		       (((ElementBits > 8U) ? DMA_SIZE_16BIT : DMA_SIZE_8BIT) << DMA_CCR_MSIZE_Pos) |
+		       DMA_CCR_HTIE | DMA_CCR_TCIE;
+	}
+
+	static_assert((uint32_t)Res <= (uint32_t)ADC_RES_6BIT, "adc::Driver: RES is 2 bits");
+	static_assert((uint32_t)Smp <= (uint32_t)ADC_SMP_160_5, "adc::Driver: SMP is 3 bits");
+	static_assert((uint32_t)Align <= (uint32_t)ADC_ALIGN_LEFT, "adc::Driver: ALIGN is 1 bit");
+	static_assert(ResolutionBits <= ADC_PLAN_MAX_RES_BITS, "adc::Driver: resolution above ADC_PLAN_MAX_RES_BITS");
+	static_assert((DmaChannel >= 1U) && (DmaChannel <= DMA1_CHANNELS), "adc::Driver: DMA1 Channel1..5");
+	static_assert(!ChannelSet::HasExternal || (SampleNs >= ADC_PLAN_MIN_TSMP_NS),
+	              "adc::Driver: sampling time below ADC_PLAN_MIN_TSMP_NS for the input divider");
+	static_assert(!(ChannelSet::HasVrefint || ChannelSet::HasTsense) || (SampleNs >= ADC_VREF_TSMP_MIN_NS),
+	              "adc::Driver: VREFINT / TSENSE need ADC_VREF_TSMP_MIN_NS of sampling");
+
+	/* ────────────────────────────────────────────────────────────── /
+	 * Function : Attach()
+	 * Purpose  : Claim DmaChannel for the ADC request
+	 * Details  : DMA1_InitAdc() with the fixed channel. False if
+	 *            the channel belongs to another stream. Once.
+	 * Runtime  : ~X.Xxx
+	 * ────────────────────────────────────────────────────────────── */
+	static bool Attach(uint32_t IrqPriority, DMA_Handler_t Handler, void *pCtx = NULL) {
+		const DMA_ChannelConfig_t dma = { DMA_REQ_ADC, DmaChannel, DmaPriority, IrqPriority, Handler, pCtx };
+
+		return DMA1_InitAdc(&dma) == DmaChannel;
+	}
+
+	/* ────────────────────────────────────────────────────────────── /
+	 * Function : Configure()
+	 * Purpose  : Load the folded register images
+	 * Details  : ADC ready (ADC1_InitPoll()). Each register is
+	 *            written once; the ADC is only disabled when RES,
+	 *            CFGR2 or PRESC really change. Stops conversions,
+	 *            restart the DMA/stream afterwards. A configured
+	 *            watchdog 1 (Cfgr1Keep) stays armed.
+	 * Runtime  : ~X.Xxx
+	 * ────────────────────────────────────────────────────────────── */
+	static void Configure(void) {
+		const uint32_t ccr   = READ_REG(Instance::Common()->CCR);
+		const uint32_t cfgr1 = READ_REG(Instance::Regs()->CFGR1);
+		const bool     off   = (((cfgr1 ^ Cfgr1) & ADC_CFGR1_RES) != 0U) ||
+		                       (READ_REG(Instance::Regs()->CFGR2) != Cfgr2) || (((ccr ^ Ccr) & ADC_CCR_PRESC) != 0U);
+
+		ADC1_Stop();
+
+		if (off) {
+			Disable();
+			WRITE_REG(Instance::Regs()->CFGR2, Cfgr2);            //Only writable with ADEN = 0
+			WRITE_REG(Instance::Common()->CCR, Ccr);
+			WRITE_REG(Instance::Regs()->CFGR1, (cfgr1 & Cfgr1Keep) | Cfgr1);  //RES: ADEN = 0
+			Enable();
+		} else {
+			if (ccr != Ccr) {
+				WRITE_REG(Instance::Common()->CCR, Ccr);          //VREFEN / TSEN only
+			}
+			WRITE_REG(Instance::Regs()->CFGR1, (cfgr1 & Cfgr1Keep) | Cfgr1);
+		}
+
+		WRITE_REG(Instance::Regs()->SMPR, Smpr);
+		WRITE_REG(Instance::Regs()->ISR, ADC_ISR_CCRDY);          //Clear CCRDY (write 1)
+		WRITE_REG(Instance::Regs()->CHSELR, Chselr);              //After CHSELRMOD (CFGR1)
+		while (!(Instance::Regs()->ISR & ADC_ISR_CCRDY)) {
+			/*
+			 * ⏳...
+			 */
+		}
+
+		ADC1_AdoptConfig(ChannelSet::Order, ChannelSet::Count, ResolutionBits, ResultBits);
+	}
+
+	/* ────────────────────────────────────────────────────────────── /
+	 * Function : Start()
+	 * Purpose  : Circular DMA into pBuffer, then ADSTART
+	 * Details  : After Attach() and Configure(). Raw ring without
+	 *            ADC_Stream bookkeeping: the Attach() handler gets
+	 *            the HT/TC halves. Length: whole scans per half.
+	 * Runtime  : ~X.Xxx
+	 * ────────────────────────────────────────────────────────────── */
+	template <size_t Length>
+	static void Start(uint16_t (&pBuffer)[Length]) {
+
+		static_assert((Length % (2U * ChannelSet::Count)) == 0U, "adc::Driver: buffer halves must hold whole scans");
+		Run((uint32_t)(uintptr_t)pBuffer, DmaCcr(16U), Length);
+	}
+
+	template <size_t Length>
+	static void Start(uint8_t (&pBuffer)[Length]) {
+
+		static_assert(ResultBits <= 8U, "adc::Driver: results wider than the uint8_t buffer");
+		static_assert((Length % (2U * ChannelSet::Count)) == 0U, "adc::Driver: buffer halves must hold whole scans");
+		Run((uint32_t)(uintptr_t)pBuffer, DmaCcr(8U), Length);
+	}
+
+private:
+	/* ────────────────────────────────────────────────────────────── /
+	 * Function : Run()
+	 * Purpose  : Program the DMA channel from its image, ADSTART
+	 * Details  : CCR without EN also stops a running transfer,
+	 *            CNDTR/CMAR are only writable with EN = 0
+	 * Runtime  : ~X.Xxx
+	 * ────────────────────────────────────────────────────────────── */
+	static void Run(uint32_t Address, uint32_t Image, uint32_t Length) {
+		DMA_Channel_TypeDef *dma = DMA1_GetChannel(DmaChannel);
+
+		ADC1_Stop();
+		WRITE_REG(dma->CCR, Image);
+		WRITE_REG(dma->CPAR, (uint32_t)(uintptr_t)&Instance::Regs()->DR);
+		WRITE_REG(dma->CMAR, Address);
+		WRITE_REG(dma->CNDTR, Length);
+		WRITE_REG(dma->CCR, Image | DMA_CCR_EN);
+		SET_BIT(Instance::Regs()->CR, ADC_CR_ADSTART);            //DMAEN / DMACFG come with Cfgr1
+	}
+
+	/* ────────────────────────────────────────────────────────────── /
+	 * Function : Disable() / Enable()
+	 * Purpose  : 14.3.4: ADEN = 0 for CFGR2 / RES, then back on
+	 * Details  : Conversions already stopped
+	 * Runtime  : ~X.Xxx
+	 * ────────────────────────────────────────────────────────────── */
+	static void Disable(void) {
+
+		if (Instance::Regs()->CR & ADC_CR_ADEN) {
+			SET_BIT(Instance::Regs()->CR, ADC_CR_ADDIS);
+			while (Instance::Regs()->CR & ADC_CR_ADEN) {                       //ADEN and ADDIS cleared by hardware
+				/*
+				 * ⏳...
+				 */
+			}
+		}
+	}
+
+	static void Enable(void) {
+
+		WRITE_REG(Instance::Regs()->ISR, ADC_ISR_ADRDY);          //Clear ADRDY (write 1)
+		SET_BIT(Instance::Regs()->CR, ADC_CR_ADEN);
+		while (!(Instance::Regs()->ISR & ADC_ISR_ADRDY)) {
+			/*
+			 * ⏳...
+			 */
+		}
+	}
+};
+
+} // namespace adc
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_HPP_ */
@@ -0,0 +1,88 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_async.h                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 28, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Interrupt Sampling - EOC / EOS Callbacks, No Polling  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides interrupt-driven sampling without DMA for low-rate channels: every result      *
+ * is taken from ADC_DR in the EOC interrupt, so nothing ever spins on ADC_ISR.                             *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Per-conversion, per-sequence and overrun callback types, configuration and counters.                 *
+ *   - Continuous start/stop, one-shot ADC1_ReadAsync(), polling and IRQ entry points.                      *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Async_IRQHandler() from ADC1_IRQHandler().                                                       *
+ *   - ADC1_ReadAsync(): one scan of the configured channels, returns at once, the callback gets the        *
+ *     results at EOS. Sleep in __WFI() meanwhile, or poll ADC_Async_IsBusy() / ADC_Async_GetLast().        *
+ *   - ADC_Async_Start(): conversions keep running (CONT, or ADC1_ConfigTimerTrigger() for a low rate),     *
+ *     OnConversion at each EOC and OnSequence at each EOS.                                                 *
+ *   - Not together with the DMA stream: stop it first, DMAEN is cleared here.                              *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h for the scan order (ADC_Scan_GetOrder()) and ADC1_Start() / ADC1_Stop().                       *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_ASYNC_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_ASYNC_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_ASYNC_IRQ_PRIORITY               2U     // Same as the bring-up / AWD users of ADC1_IRQn
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * ADC1 interrupt context. Index is the scan position, pResults holds one result per position in scan
+ * order and is only valid during the call.
+ */
+typedef void (*ADC_ConversionCallback_t)(uint32_t Index, uint8_t Channel, uint16_t Value, void *pCtx);
+typedef void (*ADC_SequenceCallback_t)(const uint16_t *pResults, uint32_t Length, void *pCtx);
+typedef void (*ADC_OverrunCallback_t)(void *pCtx);
+
+typedef struct {
+	ADC_ConversionCallback_t OnConversion;                        //Optional, every EOC
+	ADC_SequenceCallback_t   OnSequence;                          //Optional, every complete scan (EOS)
+	ADC_OverrunCallback_t    OnOverrun;                           //Optional, OVR: a result was lost
+	void                    *pCtx;
+} ADC_AsyncConfig_t;
+
+typedef struct {
+	uint32_t Conversions;                                         //EOC served
+	uint32_t Sequences;                                           //Complete scans delivered
+	uint32_t Overruns;                                            //OVR events
+	uint32_t Incomplete;                                          //Scans dropped after an OVR
+} ADC_AsyncStats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Async_Start(const ADC_AsyncConfig_t *pConfig);
+void ADC_Async_Stop(void);
+bool ADC1_ReadAsync(ADC_SequenceCallback_t Callback, void *pCtx);
+bool ADC_Async_IsBusy(void);
+uint32_t ADC_Async_GetLast(uint16_t *pResults);
+void ADC_Async_GetStats(ADC_AsyncStats_t *pStats);
+void ADC_Async_IRQHandler(void);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_ASYNC_H_ */
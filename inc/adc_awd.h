@@ -0,0 +1,91 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_awd.h                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 30, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Analog Watchdogs - Window Events with Hysteresis      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides the configuration types and prototypes for the three ADC analog               *
+ * watchdogs (AWD1 single/all channels, AWD2/AWD3 single channel).                                          *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Watchdog identifiers, window configuration and event callback type.                                  *
+ *   - Configuration, disable/enable, missed-flag count and IRQ entry points.                               *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - Configure before starting conversions, call ADC_AWD_IRQHandler() from ADC1_IRQHandler() after        *
+ *     ADC_Async_IRQHandler() (both read DR; without DMA the EOC must be taken first).                      *
+ *   - Leave the ADC running (CONT or timer trigger) and sleep in __WFI() until a window event.             *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h for ADC1_Stop() and channel definitions.                                                       *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_AWD_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_AWD_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_AWD_ALL_CHANNELS                 0xFFFFFFFFUL   // AWD1: AWD1SGL = 0
+#define ADC_AWD_THRESHOLD_MAX                0x0FFFU        // HTx/LTx are 12-bit
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	ADC_AWD1 = 0,
+	ADC_AWD2 = 1,
+	ADC_AWD3 = 2,
+	ADC_AWD_COUNT
+} ADC_AWD_t;
+
+typedef enum {
+	ADC_AWD_EVENT_ABOVE  = 0,                                     //Conversion went above High
+	ADC_AWD_EVENT_BELOW  = 1,                                     //Conversion went below Low
+	ADC_AWD_EVENT_INSIDE = 2                                      //Back inside the window (with hysteresis)
+} ADC_AWD_Event_t;
+
+typedef void (*ADC_AWD_Callback_t)(ADC_AWD_t Watchdog, ADC_AWD_Event_t Event, uint16_t Value);
+
+/*
+ * Thresholds and the callback Value are in 12-bit code units (HTx/LTx) at any resolution. Channels:
+ * AWD1 takes one channel bit or ADC_AWD_ALL_CHANNELS, AWD2/AWD3 take one CHSEL bit (AWDxCR). In scans or
+ * under DMA a flag whose DR value no longer explains it is dropped, see ADC_AWD_GetMissed().
+ */
+typedef struct {
+	uint32_t           Channels;
+	uint16_t           Low;
+	uint16_t           High;
+	uint16_t           Hysteresis;                                //Return distance before INSIDE is reported
+	ADC_AWD_Callback_t Callback;
+} ADC_AWD_Config_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_AWD_Config(ADC_AWD_t Watchdog, const ADC_AWD_Config_t *pConfig);
+void ADC_AWD_Disable(ADC_AWD_t Watchdog);
+void ADC_AWD_Enable(ADC_AWD_t Watchdog);
+uint32_t ADC_AWD_GetMissed(ADC_AWD_t Watchdog);
+void ADC_AWD_IRQHandler(void);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_AWD_H_ */
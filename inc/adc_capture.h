@@ -0,0 +1,132 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_capture.h                        ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 18, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Triggered Capture - Pre-Trigger History over DMA      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides an oscilloscope-style capture engine: the circular DMA buffer keeps running    *
+ * until a level, slope or GPIO trigger, then freezes once the post-trigger samples are in.                 *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Trigger sources, capture configuration and the two-segment capture view.                             *
+ *   - Arm, abort, result and IRQ entry points.                                                             *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - Stop the stream, ADC_Capture_Arm(), then poll ADC_Capture_IsDone() or use the Callback.              *
+ *   - ADC DMA handler (DMA1_InitAdc()): ADC_Capture_IRQHandler(Flags) first, ADC_Stream_IRQHandler()       *
+ *     when it returns false. Level/slope triggers arrive through ADC_AWD_IRQHandler() (AWD1), GPIO          *
+ *     triggers need ADC_Capture_EXTI_IRQHandler() in the EXTIx_IRQHandler of the pin.                      *
+ *   - While waiting for the trigger the DMA vector of the ADC channel is masked: give the ADC an           *
+ *     unshared channel (Channel1) when other DMA streams must keep running meanwhile.                      *
+ *   - Read the capture through pFirst/pSecond: samples stay where the DMA wrote them.                      *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - dma.h for ADC_Start_DMA16(), adc_awd.h for the AWD1 trigger, EXTI for GPIO triggers.                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_CAPTURE_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_CAPTURE_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include "dma.h"
+#include "adc_awd.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_CAPTURE_SEARCH                   16U    // Scans searched back from CNDTR for the trigger sample
+#define ADC_CAPTURE_GUARD                    16U    // Samples of slack for DMA ISR latency at freeze
+
+/*
+ * The freeze runs at the next HT/TC after the last post-trigger sample, up to half a buffer later, so
+ * pre + post must fit half the buffer for the pre-trigger history to survive
+ */
+#define ADC_CAPTURE_MAX_SCANS(Length, Scan)  ((((Length) / 2U) - ADC_CAPTURE_GUARD) / (Scan))
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	ADC_TRIG_LEVEL_ABOVE = 0,                                     //First sample > Level (at once if already above)
+	ADC_TRIG_LEVEL_BELOW = 1,                                     //First sample < Level
+	ADC_TRIG_RISING      = 2,                                     //> Level after < Level - Hysteresis
+	ADC_TRIG_FALLING     = 3,                                     //< Level after > Level + Hysteresis
+	ADC_TRIG_GPIO        = 4                                      //EXTI edge on ExtiPort/ExtiPin
+} ADC_TrigSource_t;
+
+typedef enum {
+	ADC_EDGE_RISING  = 1,                                         //RTSR1
+	ADC_EDGE_FALLING = 2,                                         //FTSR1
+	ADC_EDGE_BOTH    = 3
+} ADC_TrigEdge_t;
+
+typedef enum {
+	ADC_CAPTURE_IDLE      = 0,
+	ADC_CAPTURE_PREFILL   = 1,                                    //Filling the pre-trigger history
+	ADC_CAPTURE_ARMED     = 2,                                    //Waiting for the trigger, no interrupts
+	ADC_CAPTURE_TRIGGERED = 3,                                    //Collecting the post-trigger samples
+	ADC_CAPTURE_DONE      = 4                                     //Frozen: ADC and DMA stopped
+} ADC_CaptureState_t;
+
+/*
+ * Samples of the finished capture in time order, straight from the DMA buffer: pFirst[0..FirstLength)
+ * then pSecond[0..SecondLength). Indices count buffer elements, i.e. interleaved scans.
+ */
+typedef struct {
+	const uint16_t *pFirst;
+	uint32_t        FirstLength;
+	const uint16_t *pSecond;                                      //Wrapped part, NULL if none
+	uint32_t        SecondLength;
+	uint32_t        Length;
+	uint32_t        TriggerIndex;                                 //Start of the trigger scan = pre-trigger samples
+	uint32_t        TriggerLatency;                               //Samples written after the trigger when its ISR ran
+	bool            Exact;                                        //Trigger sample found in the data / EXTI
+} ADC_Capture_t;
+
+typedef void (*ADC_CaptureCallback_t)(const ADC_Capture_t *pCapture);
+
+/*
+ * Level and Hysteresis are 12-bit codes (AWD thresholds). Pre/post are counted in scans, the trigger
+ * scan is the first post-trigger one.
+ */
+typedef struct {
+	ADC_TrigSource_t      Source;
+	uint8_t               Channel;                                //Level/slope: watched channel (AWD1)
+	uint16_t              Level;
+	uint16_t              Hysteresis;                             //Re-arm distance; keep above the noise
+	uint8_t               ExtiPort;                               //GPIO: EXTICR code, 0 = PA, 1 = PB, ... 5 = PF
+	uint8_t               ExtiPin;                                //GPIO: 0..15, configured as input by the caller
+	ADC_TrigEdge_t        Edge;
+	uint32_t              PreScans;
+	uint32_t              PostScans;                              //>= 1, includes the trigger scan
+	ADC_CaptureCallback_t Callback;                               //Optional, DMA ISR context
+} ADC_CaptureConfig_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Capture_Arm(uint16_t *pBuffer, uint32_t Length, const ADC_CaptureConfig_t *pConfig);
+void ADC_Capture_Abort(void);
+ADC_CaptureState_t ADC_Capture_GetState(void);
+bool ADC_Capture_IsDone(void);
+bool ADC_Capture_Get(ADC_Capture_t *pCapture);
+bool ADC_Capture_IRQHandler(uint32_t Flags);
+void ADC_Capture_EXTI_IRQHandler(void);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_CAPTURE_H_ */
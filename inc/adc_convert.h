@@ -0,0 +1,114 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_convert.h                        ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 14, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Conversion - Fixed-Point Code to Voltage Kernels      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides compile-time scale factors and block conversion prototypes that turn raw       *
+ * ADC codes into millivolts or Q16.16 volts with integer multiply-shift only.                              *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Scale factors derived from ADC_VREF_mV, the input divider and ADC_RESOLUTION_BITS (adc.h), or any    *
+ *     runtime result width (ADC_CONVERT_MV_Q16_BITS(ADC1_GetResultBits())).                                *
+ *   - Inline single-sample conversion and block conversion prototypes (fixed or runtime mV scale).         *
+ *   - SysTick based cycle comparison against the float formula.                                            *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h for the analog front-end configuration macros.                                                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_CONVERT_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_CONVERT_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           SCALE FACTORS                                                  */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_FULL_SCALE                       ((1UL << ADC_RESOLUTION_BITS) - 1UL)             // 4095 @ 12 bits
+#define ADC_CONVERT_DIV_NUM                  (ADC_DIVIDER_R_TOP + ADC_DIVIDER_R_BOTTOM)       // (47+10)
+#define ADC_CONVERT_DIV_DEN                  (ADC_DIVIDER_R_BOTTOM)                           // 10
+
+/*
+ * mV at the divider input per ADC code, Q16, rounded: VREF * (Rt+Rb) / (Rb * FULL_SCALE).
+ * ADC_CONVERT_MV_Q16_AT() also gives the runtime scale for a measured VDDA (adc_vref.c).
+ * The fixed kernels assume ADC_RESOLUTION_BITS results. After ADC1_ConfigResolution() or oversampling,
+ * pass ADC_CONVERT_MV_Q16_BITS(ADC1_GetResultBits()) to ADC_Convert_Block_mV_Scaled() instead (the
+ * product stays ~VREF * (Rt+Rb) / Rb * 2^16 at any width, so it fits 32 bits for 6..16-bit results).
+ */
+#define ADC_CONVERT_MV_Q16_AT_BITS(vref_mV, bits)                                                     \
+                                             ((uint32_t)(((((uint64_t)(vref_mV) * ADC_CONVERT_DIV_NUM) << 16)  \
+                                               + (((1UL << (bits)) - 1UL) * ADC_CONVERT_DIV_DEN) / 2U)         \
+                                               / (((1UL << (bits)) - 1UL) * ADC_CONVERT_DIV_DEN)))
+#define ADC_CONVERT_MV_Q16_AT(vref_mV)       ADC_CONVERT_MV_Q16_AT_BITS(vref_mV, ADC_RESOLUTION_BITS)
+#define ADC_CONVERT_MV_Q16_BITS(bits)        ADC_CONVERT_MV_Q16_AT_BITS(ADC_VREF_mV, bits)
+#define ADC_CONVERT_MV_Q16                   ADC_CONVERT_MV_Q16_AT(ADC_VREF_mV)
+
+/*
+ * Volts at the divider input per ADC code, Q24, rounded. (code * K) >> 8 gives Q16.16 volts.
+ */
+#define ADC_CONVERT_V_Q24                    ((uint32_t)(((((uint64_t)ADC_VREF_mV * ADC_CONVERT_DIV_NUM) << 24)  \
+                                               + (ADC_FULL_SCALE * ADC_CONVERT_DIV_DEN * 1000U) / 2U)          \
+                                               / (ADC_FULL_SCALE * ADC_CONVERT_DIV_DEN * 1000U)))
+
+_Static_assert(((uint64_t)ADC_FULL_SCALE * ADC_CONVERT_MV_Q16 + 0x8000U) <= 0xFFFFFFFFULL,
+               "ADC_CONVERT_MV_Q16: full-scale product overflows 32 bits");
+_Static_assert(((uint64_t)ADC_FULL_SCALE * ADC_CONVERT_V_Q24 + 0x80U) <= 0xFFFFFFFFULL,
+               "ADC_CONVERT_V_Q24: full-scale product overflows 32 bits");
+_Static_assert((((uint64_t)ADC_FULL_SCALE * ADC_CONVERT_MV_Q16 + 0x8000U) >> 16) <= 0xFFFFU,
+               "ADC_Convert_Block_mV: full-scale millivolts do not fit uint16_t");
+_Static_assert(((uint64_t)0xFFFFU * ADC_CONVERT_MV_Q16_BITS(16) + 0x8000U) <= 0xFFFFFFFFULL,
+               "ADC_CONVERT_MV_Q16_BITS: 16-bit full-scale product overflows 32 bits");
+
+/*
+ * ADC_Convert_Benchmark() limits
+ */
+#define ADC_CONVERT_BENCH_MAX                64U    // Samples per ADC_Convert_Benchmark() call
+#define ADC_CONVERT_BENCH_CHUNK              8U     // Samples per timed run: a few k cycles, < 1 ms tick at 16 MHz
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	uint32_t Samples;                                             //Block length used for the run
+	uint32_t FloatCycles;                                         //Float formula, whole block
+	uint32_t FixedCycles;                                         //ADC_Convert_Block_mV(), whole block
+} ADC_ConvertBench_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DATA PROCESSING                                                */
+/*																						 				    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Convert_mV()
+ * Purpose  : Convert one raw code to millivolts (divider input)
+ * Details  : One MULS, one ADD, one LSR on the M0+.
+ *            ADC_RESOLUTION_BITS codes only
+ * Runtime  : ~4 cycles
+ * ────────────────────────────────────────────────────────────── */
+static inline uint16_t ADC_Convert_mV(uint16_t Raw) {
+	return (uint16_t)(((uint32_t)Raw * ADC_CONVERT_MV_Q16 + 0x8000UL) >> 16);
+}
+
+void ADC_Convert_Block_mV(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length);
+void ADC_Convert_Block_mV_Scaled(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length, uint32_t ScaleQ16);
+void ADC_Convert_Block_Q16(const uint16_t *pRaw, uint32_t *pOut, uint32_t Length);
+bool ADC_Convert_Benchmark(const uint16_t *pRaw, uint32_t Length, ADC_ConvertBench_t *pResult);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_CONVERT_H_ */
@@ -0,0 +1,85 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_decim.h                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 9, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Decimator - CIC + Compensating Q15 FIR on DMA Blocks  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides a streaming decimation stage: a 3rd-order CIC decimating by R, followed by a   *
+ * 16-tap Q15 FIR that flattens the CIC droop and decimates by 2. Total ratio = 2 * R.                      *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Filter limits and output sizing macros.                                                              *
+ *   - Filter state (one per channel, carried across blocks).                                               *
+ *   - Init, reset and block processing prototypes.                                                         *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Decim_Init() once per channel, then ADC_Decim_Process() on every block from the queue.           *
+ *   - For scans, run ADC_Scan_Deinterleave() first and keep one ADC_Decim_t per channel.                   *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - None beyond stdint; ADC1_GetResultBits() (adc.h) gives the InputBits for the current setup.          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_DECIM_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_DECIM_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_DECIM_CIC_ORDER                  3U     // Integrator/comb pairs (unrolled in the kernel)
+#define ADC_DECIM_CIC_MAX                    32U    // R^3 * 2^15 must fit int32
+#define ADC_DECIM_FIR_TAPS                   16U    // Symmetric, even length
+#define ADC_DECIM_FIR_RATIO                  2U     // Fixed final stage
+#define ADC_DECIM_RATIO_MAX                  (ADC_DECIM_CIC_MAX * ADC_DECIM_FIR_RATIO)
+
+/* Worst-case outputs for one call (state may hold up to Ratio - 1 inputs from the previous block) */
+#define ADC_DECIM_OUT_MAX(len, ratio)        (((len) + (ratio) - 1U) / (ratio))
+
+/* Q15 output back to an unsigned code of the given width (-32768 = 0, +32767 = full scale) */
+#define ADC_DECIM_TO_CODE(q15, bits)         ((uint16_t)(((int32_t)(q15) + 32768L) >> (16U - (bits))))
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * One decimator per channel. Everything lives in this struct (SRAM), nothing is static, so any number
+ * of channels can be filtered independently.
+ */
+typedef struct {
+	uint32_t Integrator[ADC_DECIM_CIC_ORDER];                     //Modulo 2^32, wrap is harmless
+	uint32_t Comb[ADC_DECIM_CIC_ORDER];                           //Previous comb inputs (M = 1)
+	int16_t  Delay[2U * ADC_DECIM_FIR_TAPS];                      //Mirrored line, no wrap in the MAC loop
+	uint32_t DelayIndex;
+	uint32_t CicPhase;                                            //Inputs since the last CIC output
+	uint32_t FirPhase;                                            //CIC outputs since the last FIR output
+	uint32_t CicRatio;                                            //R
+	uint32_t CicShift;                                            //ceil(log2(R^3))
+	int32_t  CicCorr;                                             //2^(15 + CicShift) / R^3, Q15
+	uint32_t InputShift;                                          //16 - InputBits
+} ADC_Decim_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Decim_Init(ADC_Decim_t *pDecim, uint32_t Ratio, uint32_t InputBits);
+void ADC_Decim_Reset(ADC_Decim_t *pDecim);
+uint32_t ADC_Decim_Process(ADC_Decim_t *pDecim, const uint16_t *pIn, uint32_t Length, int16_t *pOut);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_DECIM_H_ */
@@ -0,0 +1,83 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_export.h                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Capture Export - Packed Frames over USART2 DMA        ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides the raw-capture export: stream blocks are encoded into adc_pack frames and     *
+ * sent on USART2 TX by a DMA1 channel while acquisition keeps running.                                     *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Frame pool sizing and export counters.                                                               *
+ *   - Init, block, flush, interrupt and statistics prototypes.                                             *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Export_Init() once with the baud rate, ADC_PACK_RAW / ADC_PACK_DELTA and the sample width.       *
+ *   - ADC_Export_Block() per block in the main loop, before ADC_Stream_Release().                          *
+ *   - ADC_Export_IRQHandler() is registered with the DMA channel by ADC_Export_Init().                     *
+ *   - Host side: sim/adc_decode.c checks CRC and sequence and rebuilds the sample stream.                  *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc_pack.h (wire format), usart.h (link), dma.h (USART_Start_DMA()).                                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_EXPORT_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_EXPORT_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_pack.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_EXPORT_FRAMES
+#define ADC_EXPORT_FRAMES                    3U     // One on the wire, one queued, one being filled
+#endif
+#ifndef ADC_EXPORT_FRAME_SAMPLES
+#define ADC_EXPORT_FRAME_SAMPLES             256U   // 16 bytes of framing per 256 samples
+#endif
+
+#define ADC_EXPORT_FRAME_BYTES               ADC_PACK_FRAME_MAX(ADC_EXPORT_FRAME_SAMPLES, 16U)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * DroppedSamples counts samples offered while every frame buffer was queued or on the wire (the link is
+ * slower than the stream). They still advance the sample index, so the host sees the gap exactly.
+ */
+typedef struct {
+	uint32_t Frames;                                              //Frames handed to the DMA
+	uint32_t Bytes;                                               //Frame bytes handed to the DMA
+	uint32_t Samples;                                             //Samples encoded
+	uint32_t DroppedSamples;
+	uint32_t DmaErrors;
+	uint32_t Pending;                                             //Frames queued or on the wire
+	uint32_t BitsPerSampleQ8;                                     //Link bits per sample incl. framing, Q8
+} ADC_ExportStats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool     ADC_Export_Init(uint32_t Baud, ADC_PackMode_t Mode, uint32_t SampleBits);
+uint32_t ADC_Export_Block(const uint16_t *pData, uint32_t Length);
+void     ADC_Export_Flush(void);
+void     ADC_Export_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx);
+void     ADC_Export_GetStats(ADC_ExportStats_t *pStats);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_EXPORT_H_ */
@@ -0,0 +1,124 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_fft.h                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: March 3, 2026                        ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Spectrum - Q15 Real FFT, Window and Band Energies     ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides a spectral analysis stage for DMA blocks: one channel is collected into        *
+ * power-of-two frames, windowed, transformed in place and reduced to a peak and a few band levels.         *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Frame limits, window types, band and configuration types, per-frame result and engine state.         *
+ *   - Init, block update, result and magnitude prototypes, and the bare in-place transform.                *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Fft_Init() with the frame size, window, bands and the scan position to analyse.                  *
+ *   - ADC_Fft_Update() on every block (like ADC_Stats_Update()); each full frame is transformed there.     *
+ *   - ADC_Fft_Get() from any context, or take results from the frame callback. The spectrum itself         *
+ *     (ADC_Fft_GetMagnitude()) is only valid inside the callback: the next samples overwrite it.           *
+ *   - ADC_Fft_Transform() alone for frames the caller already holds.                                       *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - stm32g030xx.h (PRIMASK) in the implementation only.                                                  *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_FFT_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_FFT_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_FFT_MAX_LOG2
+#define ADC_FFT_MAX_LOG2                     8U     // 256 points: 512 bytes of frame per engine
+#endif
+
+#define ADC_FFT_MIN_LOG2                     4U     // 16 points
+#define ADC_FFT_TABLE_LOG2                   9U     // Twiddle table resolution, ADC_FFT_MAX_LOG2 <= this
+#define ADC_FFT_MAX_POINTS                   (1UL << ADC_FFT_MAX_LOG2)
+#define ADC_FFT_MAX_BANDS                    8U
+
+/* Bins 0..N/2 of an N = 2^Log2 point frame (ADC_Fft_GetMagnitude() output length) */
+#define ADC_FFT_BINS(Log2)                   ((1UL << ((Log2) - 1U)) + 1UL)
+
+/* Nearest bin of a frequency, RateHz = samples per second of the analysed channel */
+#define ADC_FFT_BIN(Hz, RateHz, Log2)        ((uint16_t)((((uint32_t)(Hz) << (Log2)) + (RateHz) / 2U) / (RateHz)))
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	ADC_FFT_WINDOW_RECT = 0,                                      //None: bin-centred tones only, ENBW 1 bin
+	ADC_FFT_WINDOW_HANN = 1                                       //Periodic Hann: -31 dB sidelobes, ENBW 1.5 bins
+} ADC_FftWindow_t;
+
+typedef struct {
+	uint16_t Low;                                                 //First bin, >= 1
+	uint16_t High;                                                //Last bin, <= N/2
+} ADC_FftBand_t;
+
+/*
+ * Results of one frame, in raw code units. Q4 fields are 1/16 code as in adc_stats.h. PeakQ4 is the
+ * amplitude of the strongest bin (a bin-centred sine reads its amplitude); BandRmsQ4 is the RMS of the
+ * content within the band, corrected for the window, so the band energy is BandRmsQ4^2 and the squares
+ * of disjoint bands add up to the AC power of the frame.
+ */
+typedef struct {
+	uint32_t Sequence;                                            //Frame number, 1 = first, 0 = none yet
+	uint32_t MeanQ4;                                              //DC, removed before the window
+	uint32_t PeakBin;
+	uint32_t PeakQ4;
+	uint32_t BandRmsQ4[ADC_FFT_MAX_BANDS];
+} ADC_FftResult_t;
+
+typedef void (*ADC_FftCallback_t)(const ADC_FftResult_t *pResult);
+
+typedef struct {
+	uint32_t          Log2Points;                                 //ADC_FFT_MIN_LOG2..ADC_FFT_MAX_LOG2
+	ADC_FftWindow_t   Window;
+	uint32_t          InputBits;                                  //6..16, ADC1_GetResultBits() for the stream
+	uint32_t          Channels;                                   //Samples per scan, 1 = single channel
+	uint32_t          Position;                                   //Scan position analysed, < Channels
+	uint32_t          NumBands;                                   //0..ADC_FFT_MAX_BANDS
+	ADC_FftBand_t     Bands[ADC_FFT_MAX_BANDS];
+	ADC_FftCallback_t Callback;                                   //Optional, called as each frame closes
+} ADC_FftConfig_t;
+
+/* One engine per analysed channel; all state lives here (SRAM), nothing is static */
+typedef struct {
+	ADC_FftConfig_t Config;
+	uint32_t        Points;
+	uint32_t        Filled;                                       //Samples in Frame
+	int32_t         Sum;                                          //Of the samples in Frame, for the mean
+	uint32_t        Phase;                                        //Scan position of the next incoming sample
+	int32_t         Exponent;                                     //Block exponent of the spectrum in Frame
+	ADC_FftResult_t Result;                                       //Last completed frame
+	int16_t         Frame[ADC_FFT_MAX_POINTS];                    //Q14 samples, then the spectrum in place
+} ADC_Fft_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Fft_Init(ADC_Fft_t *pFft, const ADC_FftConfig_t *pConfig);
+void ADC_Fft_Update(ADC_Fft_t *pFft, const uint16_t *pData, uint32_t Length);
+bool ADC_Fft_Get(const ADC_Fft_t *pFft, ADC_FftResult_t *pResult);
+uint32_t ADC_Fft_GetMagnitude(const ADC_Fft_t *pFft, uint32_t *pOut);
+int32_t ADC_Fft_Transform(int16_t *pData, uint32_t Log2Points);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_FFT_H_ */
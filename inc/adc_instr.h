@@ -0,0 +1,115 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_instr.h                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 6, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Instrumentation - ISR Timing and Acquisition Health   ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides always-on instrumentation for the acquisition hot path: per-ISR latency and    *
+ * duration histograms, achieved sample rate, ADC overrun, DMA transfer-error and EOC spin counters.        *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - ISR identifiers, histogram size and the snapshot structure.                                          *
+ *   - ADC_INSTR_ENTER() / ADC_INSTR_EXIT() / ADC_INSTR_READ_SPINS() hooks (empty when disabled).            *
+ *   - Start, snapshot and reset prototypes, and the SysTick interval helper shared with other modules.     *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - Call ADC_Instr_Start() with the block length before ADC_Stream_Start().                              *
+ *   - Wrap the body of each instrumented IRQ handler in ADC_INSTR_ENTER() / ADC_INSTR_EXIT().              *
+ *   - Poll ADC_Instr_GetSnapshot() from the main loop and export it.                                       *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - SysTick running at HCLK (HAL_Init) for durations, HAL_GetTick() for the sample-rate window.          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_INSTR_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_INSTR_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_INSTR_ENABLE
+#define ADC_INSTR_ENABLE                     1      // 0 compiles every hook away
+#endif
+
+#define ADC_INSTR_HIST_BINS                  16U    // Last bin collects everything above
+#define ADC_INSTR_SPS_WINDOW_MS              1000U  // Sample-rate measurement window
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	ADC_INSTR_ISR_DMA = 0,                                        //ADC DMA channel handler (stream HT/TC)
+	ADC_INSTR_ISR_ADC = 1,                                        //ADC1_IRQHandler (bring-up, AWD)
+	ADC_INSTR_ISR_COUNT
+} ADC_InstrIsr_t;
+
+/*
+ * Duration bin n counts ISRs that took [2^n, 2^(n+1)) core cycles (bin 0 also takes 0).
+ * Latency bin n counts entries where DMA had already moved n samples into the next block, i.e. the
+ * ISR started between n and n + 1 sample periods after HT/TC. Only the DMA ISR records latency,
+ * the ADC ISR has no hardware position to measure it against.
+ */
+typedef struct {
+	uint32_t Count;                                               //ISR entries
+	uint32_t MaxCycles;                                           //Longest duration seen
+	uint32_t MaxLatency;                                          //Largest latency seen, in samples
+	uint32_t Duration[ADC_INSTR_HIST_BINS];
+	uint32_t Latency[ADC_INSTR_HIST_BINS];
+} ADC_InstrIsrStats_t;
+
+typedef struct {
+	ADC_InstrIsrStats_t Isr[ADC_INSTR_ISR_COUNT];
+	uint32_t            Samples;                                  //Samples delivered by DMA since start
+	uint32_t            SamplesPerSecond;                         //Last completed window, 0 until then
+	uint32_t            AdcOverruns;                              //ADC_ISR_OVR rising edges
+	uint32_t            DmaErrors;                                //TEIF events of the ADC DMA channel
+	uint32_t            Reads;                                    //ADC1_Read() calls
+	uint32_t            ReadSpins;                                //EOC polls that found no result, total
+	uint32_t            MaxReadSpins;                             //... worst single call
+} ADC_InstrSnapshot_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           HOOKS                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#if ADC_INSTR_ENABLE
+#define ADC_INSTR_ENTER(isr)                 uint32_t adc_instr_start = ADC_Instr_Enter(isr)
+#define ADC_INSTR_EXIT(isr)                  ADC_Instr_Exit((isr), adc_instr_start)
+#define ADC_INSTR_READ_SPINS(spins)          ADC_Instr_ReadSpins(spins)
+#else
+#define ADC_INSTR_ENTER(isr)                 ((void)0)
+#define ADC_INSTR_EXIT(isr)                  ((void)0)
+#define ADC_INSTR_READ_SPINS(spins)          ((void)(spins))
+#endif
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void ADC_Instr_Start(uint32_t BlockLength);
+void ADC_Instr_Reset(void);
+void ADC_Instr_GetSnapshot(ADC_InstrSnapshot_t *pSnapshot);
+
+uint32_t ADC_Instr_Enter(ADC_InstrIsr_t Isr);
+void ADC_Instr_Exit(ADC_InstrIsr_t Isr, uint32_t Start);
+void ADC_Instr_ReadSpins(uint32_t Spins);
+uint32_t ADC_Instr_Elapsed(uint32_t Start, uint32_t End);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_INSTR_H_ */
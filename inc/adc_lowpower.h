@@ -0,0 +1,80 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_lowpower.h                       ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 13, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Low-Power Profile - AUTOFF/WAIT, Sleep, Stop          ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides a low-power acquisition profile: timer-triggered conversions with the ADC      *
+ * powered down between scans, the core asleep between DMA blocks, and Stop mode while acquisition is idle. *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Clock-restore callback and energy metrics types.                                                     *
+ *   - Profile start/end, idle, Stop and metrics prototypes.                                                *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_LowPower_Start() after ADC bring-up, before ADC_Stream_Start(). ADC_PLAN_SPS fills the period    *
+ *     with conversions and leaves no room for tSTAB, ADC_PLAN_TARGET_SPS is the rate to pace at.           *
+ *   - In while(1): drain the queue (ADC_LowPower_BlockDone() per block), then ADC_LowPower_Idle().         *
+ *   - ADC_LowPower_EnterStop() only between acquisitions; it refuses while the stream is running.          *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h for ADC1_ConfigTimerTrigger() / ADC1_ConfigAutoOff(), SysTick + HAL tick for the metrics.      *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_LOWPOWER_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_LOWPOWER_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_LP_WINDOW_MS                     1000U  // Metrics measurement window
+#define ADC_LP_TSTAB_NS                      2000U  // ADC power-up after AUTOFF (datasheet tSTAB)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef void (*ADC_ClockRestore_t)(void);                         //e.g. SystemClock_Config
+
+/*
+ * Per-second figures are from the last completed window. Wake-ups include the 1 kHz HAL SysTick,
+ * AwakeCyclesPerBlock charges all core activity in the window (ISRs included) to the blocks.
+ */
+typedef struct {
+	uint32_t Wakeups;                                             //WFI returns since start
+	uint32_t Blocks;                                              //ADC_LowPower_BlockDone() calls since start
+	uint32_t StopEntries;
+	uint32_t WakeupsPerSecond;
+	uint32_t BlocksPerSecond;
+	uint32_t AwakeCyclesPerBlock;
+	uint32_t AwakePermille;                                       //Share of the window the core ran
+} ADC_LowPowerStats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_LowPower_Start(uint32_t RateHz, ADC_ClockRestore_t Restore, TIM_Timebase_t *pTimebase);
+void ADC_LowPower_End(void);
+void ADC_LowPower_Idle(uint32_t (*pPending)(void));
+void ADC_LowPower_BlockDone(void);
+bool ADC_LowPower_EnterStop(void);
+void ADC_LowPower_GetStats(ADC_LowPowerStats_t *pStats);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_LOWPOWER_H_ */
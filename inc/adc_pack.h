@@ -0,0 +1,124 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_pack.h                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Sample Packing - Bit-Packed / Delta-Rice Frames       ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides the wire format used to take raw ADC captures off the device: samples are      *
+ * bit-packed (12-bit codes in 1.5 bytes) or delta + adaptive Rice coded, framed with a sequence number,    *
+ * the index of the first sample and a CRC-16.                                                              *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Frame layout constants and size macros.                                                              *
+ *   - Incremental frame writer (device side) and frame reader (host decoder, loopback tests).              *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Pack_Begin() on a frame buffer, ADC_Pack_Put() per block until ADC_Pack_IsFull(), then           *
+ *     ADC_Pack_End() for the final length. Samples of one block may span two frames.                       *
+ *   - ADC_Unpack_Frame() on the received bytes; every frame decodes on its own.                            *
+ *                                                                                                          *
+ * Frame layout (little-endian):                                                                            *
+ *   - 0xA5 0x5A | Mode | Bits | Sequence (16) | Count (16) | Payload bytes (16) | First sample (32) |       *
+ *     payload | CRC-16/CCITT-FALSE over Mode .. payload.                                                   *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - None: plain C, builds for the target and for the host decoder.                                       *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_PACK_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_PACK_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_PACK_SYNC0                       0xA5U
+#define ADC_PACK_SYNC1                       0x5AU
+#define ADC_PACK_HEADER_BYTES                14U
+#define ADC_PACK_CRC_BYTES                   2U
+#define ADC_PACK_OVERHEAD                    (ADC_PACK_HEADER_BYTES + ADC_PACK_CRC_BYTES)
+
+#define ADC_PACK_RICE_ESCAPE                 12U    // Unary prefix that escapes to a raw sample
+#define ADC_PACK_RICE_RESET                  16U    // Adaptation window: halve the running sums here
+
+/*
+ * Payload never exceeds the bit-packed size: a delta frame closes early instead (noisy input)
+ */
+#define ADC_PACK_PAYLOAD_MAX(Samples, Bits)  ((((uint32_t)(Samples) * (Bits)) + 7U) / 8U)
+#define ADC_PACK_FRAME_MAX(Samples, Bits)    (ADC_PACK_OVERHEAD + ADC_PACK_PAYLOAD_MAX(Samples, Bits))
+#define ADC_PACK_PAYLOAD_LIMIT               0xFFFFU  // Header payload length is a 16-bit field
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	ADC_PACK_RAW   = 0,                                           //Bits per sample, MSB first, no gaps
+	ADC_PACK_DELTA = 1                                            //First sample raw, then zigzag deltas, Rice(k)
+} ADC_PackMode_t;
+
+typedef enum {
+	ADC_UNPACK_OK      = 0,
+	ADC_UNPACK_SHORT   = 1,                                       //Frame not complete yet: need more bytes
+	ADC_UNPACK_NO_SYNC = 2,                                       //No frame starts here: skip a byte
+	ADC_UNPACK_HEADER  = 3,                                       //Impossible header fields
+	ADC_UNPACK_CRC     = 4,
+	ADC_UNPACK_PAYLOAD = 5                                        //CRC good but payload does not decode
+} ADC_UnpackStatus_t;
+
+/* Writer state of the open frame; the frame buffer needs ADC_PACK_FRAME_MAX(MaxSamples, Bits) bytes */
+typedef struct {
+	uint8_t        *pFrame;
+	uint8_t        *pPayload;
+	uint32_t        Capacity;                                     //Payload bytes
+	uint32_t        Pos;                                          //Payload bytes written
+	uint32_t        Acc;                                          //Bit accumulator, low AccBits are pending
+	uint32_t        AccBits;
+	uint32_t        Count;
+	uint32_t        MaxSamples;
+	uint32_t        Bits;
+	ADC_PackMode_t  Mode;
+	uint32_t        Prev;                                         //Delta: previous sample
+	uint32_t        RiceSum;                                      //Delta: running sum of zigzag deltas
+	uint32_t        RiceN;                                        //Delta: samples in RiceSum
+} ADC_PackWriter_t;
+
+typedef struct {
+	ADC_PackMode_t  Mode;
+	uint32_t        Bits;
+	uint16_t        Sequence;
+	uint32_t        Count;                                        //Samples in the frame
+	uint32_t        FirstSample;                                  //Stream index of the first sample
+	uint32_t        FrameBytes;                                   //Header + payload + CRC
+} ADC_FrameInfo_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+uint16_t ADC_Pack_Crc16(const uint8_t *pData, uint32_t Length, uint16_t Crc);
+
+bool     ADC_Pack_Begin(ADC_PackWriter_t *pWriter, uint8_t *pFrame, ADC_PackMode_t Mode, uint32_t Bits,
+                        uint32_t MaxSamples);
+uint32_t ADC_Pack_Put(ADC_PackWriter_t *pWriter, const uint16_t *pData, uint32_t Length);
+bool     ADC_Pack_IsFull(const ADC_PackWriter_t *pWriter);
+uint32_t ADC_Pack_End(ADC_PackWriter_t *pWriter, uint16_t Sequence, uint32_t FirstSample);
+
+ADC_UnpackStatus_t ADC_Unpack_Frame(const uint8_t *pFrame, uint32_t Length, ADC_FrameInfo_t *pInfo,
+                                    uint16_t *pOut, uint32_t OutMax);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_PACK_H_ */
@@ -0,0 +1,223 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_plan.h                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 23, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Planner - Compile-Time Clock/Sampling Selection       ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header picks CKMODE, PRESC, SMP and resolution at compile time from the target sample rate,         *
+ * SYSCLK and the minimum sampling (settling) time required by the source impedance.                        *
+ *                                                                                                          *
+ * Inputs (override with -D or before including adc.h):                                                     *
+ *   - ADC_PLAN_SYSCLK_HZ   : ADC kernel clock source, SYSCLK from SystemClock_Config() (ADCSEL = 00).      *
+ *   - ADC_PLAN_TARGET_SPS  : minimum conversions per second.                                               *
+ *   - ADC_PLAN_MIN_TSMP_NS : minimum sampling time in ns for the analog source to settle.                  *
+ *   - ADC_PLAN_MAX_RES_BITS: highest resolution to consider (12, 10, 8 or 6), e.g. 8 for byte-packed DMA.  *
+ *                                                                                                          *
+ * Selection policy:                                                                                        *
+ *   1. Highest resolution (12/10/8/6 bits, <= ADC_PLAN_MAX_RES_BITS) for which any configuration exists.   *
+ *   2. Slowest ADC clock (largest PRESC) inside 0.14..35 MHz that still meets the rate.                    *
+ *   3. Longest SMP that fits one sample period, which must be >= ADC_PLAN_MIN_TSMP_NS.                     *
+ *   No match is a build error. Outputs: ADC_PLAN_CKMODE, _PRESC, _SMP, _RES, _RES_BITS, _SPS.              *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Sampling and conversion times are handled in half ADC clock cycles (SMP 1.5 -> 3, 12-bit -> 25).     *
+ *   - ADC_PLAN_SPS is the free-running (CONT) rate; it is >= ADC_PLAN_TARGET_SPS. Use                      *
+ *     ADC1_ConfigTimerTrigger() for an exact rate, the plan then guarantees one scan per trigger period.   *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_PLAN_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_PLAN_H_
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           PLANNER INPUTS                                                 */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_PLAN_SYSCLK_HZ
+#define ADC_PLAN_SYSCLK_HZ                   16000000   // HSI16, SystemClock_Config()
+#endif
+
+#ifndef ADC_PLAN_TARGET_SPS
+#define ADC_PLAN_TARGET_SPS                  5000       // Conversions per second
+#endif
+
+#ifndef ADC_PLAN_MIN_TSMP_NS
+#define ADC_PLAN_MIN_TSMP_NS                 2000       // 47k||10k divider source settling
+#endif
+
+#ifndef ADC_PLAN_MAX_RES_BITS
+#define ADC_PLAN_MAX_RES_BITS                12         // Full resolution unless capped
+#endif
+
+#define ADC_PLAN_FADC_MIN_HZ                 140000     // Datasheet fADC range (Range 1)
+#define ADC_PLAN_FADC_MAX_HZ                 35000000
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           PLANNER ARITHMETIC                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Successive-approximation time in half ADC cycles: 12.5 / 10.5 / 8.5 / 6.5
+ */
+#define ADC_PLAN_TCONV_H(bits)               (((bits) == 12) ? 25 : ((bits) == 10) ? 21 : ((bits) == 8) ? 17 : 13)
+
+/*
+ * Half ADC cycles in one sample period at SYSCLK / div
+ */
+#define ADC_PLAN_AVAIL_H(div)                ((2 * ADC_PLAN_SYSCLK_HZ) / ((div) * ADC_PLAN_TARGET_SPS))
+
+/*
+ * Longest SMP code (0..7) whose sampling + conversion fits the period, -1 if none does
+ */
+#define ADC_PLAN_SMP_I(div, t)               ((ADC_PLAN_AVAIL_H(div) >= 321 + (t)) ? 7 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >= 159 + (t)) ? 6 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=  79 + (t)) ? 5 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=  39 + (t)) ? 4 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=  25 + (t)) ? 3 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=  15 + (t)) ? 2 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=   7 + (t)) ? 1 :  \
+                                              (ADC_PLAN_AVAIL_H(div) >=   3 + (t)) ? 0 : -1)
+
+#define ADC_PLAN_SMP_H(i)                    (((i) == 7) ? 321 : ((i) == 6) ? 159 : ((i) == 5) ? 79 :  \
+                                              ((i) == 4) ?  39 : ((i) == 3) ?  25 : ((i) == 2) ? 15 :  \
+                                              ((i) == 1) ?   7 : 3)
+
+/*
+ * Sampling time in ns: SMP_H / 2 / (SYSCLK / div)
+ */
+#define ADC_PLAN_TSMP_NS(div, t)             (ADC_PLAN_SMP_H(ADC_PLAN_SMP_I(div, t)) * 500000000LL * (div) / ADC_PLAN_SYSCLK_HZ)
+
+#define ADC_PLAN_OK(div, bits)               ((ADC_PLAN_SYSCLK_HZ / (div) >= ADC_PLAN_FADC_MIN_HZ) &&                 \
+                                              (ADC_PLAN_SYSCLK_HZ / (div) <= ADC_PLAN_FADC_MAX_HZ) &&                 \
+                                              (ADC_PLAN_SMP_I(div, ADC_PLAN_TCONV_H(bits)) >= 0) &&                   \
+                                              (ADC_PLAN_TSMP_NS(div, ADC_PLAN_TCONV_H(bits)) >= ADC_PLAN_MIN_TSMP_NS))
+
+#define ADC_PLAN_ANY(bits)                   (ADC_PLAN_OK(256, bits) || ADC_PLAN_OK(128, bits) || ADC_PLAN_OK(64, bits) ||  \
+                                              ADC_PLAN_OK( 32, bits) || ADC_PLAN_OK( 16, bits) || ADC_PLAN_OK(12, bits) ||  \
+                                              ADC_PLAN_OK( 10, bits) || ADC_PLAN_OK(  8, bits) || ADC_PLAN_OK( 6, bits) ||  \
+                                              ADC_PLAN_OK(  4, bits) || ADC_PLAN_OK(  2, bits) || ADC_PLAN_OK( 1, bits))
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           PLANNER OUTPUTS                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_PLAN_CKMODE                      0          // 00: asynchronous clock (RCC ADCSEL = SYSCLK)
+
+/*
+ * 1. Resolution: ADC_CFGR1_RES code
+ */
+#if   (ADC_PLAN_MAX_RES_BITS >= 12) && ADC_PLAN_ANY(12)
+#define ADC_PLAN_RES_BITS                    12
+#define ADC_PLAN_RES                         0
+#define ADC_PLAN_TCONV_STR                   "12.5"
+#elif (ADC_PLAN_MAX_RES_BITS >= 10) && ADC_PLAN_ANY(10)
+#define ADC_PLAN_RES_BITS                    10
+#define ADC_PLAN_RES                         1
+#define ADC_PLAN_TCONV_STR                   "10.5"
+#elif (ADC_PLAN_MAX_RES_BITS >= 8) && ADC_PLAN_ANY(8)
+#define ADC_PLAN_RES_BITS                    8
+#define ADC_PLAN_RES                         2
+#define ADC_PLAN_TCONV_STR                   "8.5"
+#elif ADC_PLAN_ANY(6)
+#define ADC_PLAN_RES_BITS                    6
+#define ADC_PLAN_RES                         3
+#define ADC_PLAN_TCONV_STR                   "6.5"
+#else
+#error "ADC plan: no CKMODE/PRESC/SMP/resolution reaches ADC_PLAN_TARGET_SPS with ADC_PLAN_MIN_TSMP_NS of settling"
+#endif
+
+/*
+ * 2. Prescaler: ADC_CCR_PRESC code, slowest clock first
+ */
+#if   ADC_PLAN_OK(256, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   256
+#define ADC_PLAN_PRESC                       11
+#elif ADC_PLAN_OK(128, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   128
+#define ADC_PLAN_PRESC                       10
+#elif ADC_PLAN_OK(64, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   64
+#define ADC_PLAN_PRESC                       9
+#elif ADC_PLAN_OK(32, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   32
+#define ADC_PLAN_PRESC                       8
+#elif ADC_PLAN_OK(16, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   16
+#define ADC_PLAN_PRESC                       7
+#elif ADC_PLAN_OK(12, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   12
+#define ADC_PLAN_PRESC                       6
+#elif ADC_PLAN_OK(10, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   10
+#define ADC_PLAN_PRESC                       5
+#elif ADC_PLAN_OK(8, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   8
+#define ADC_PLAN_PRESC                       4
+#elif ADC_PLAN_OK(6, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   6
+#define ADC_PLAN_PRESC                       3
+#elif ADC_PLAN_OK(4, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   4
+#define ADC_PLAN_PRESC                       2
+#elif ADC_PLAN_OK(2, ADC_PLAN_RES_BITS)
+#define ADC_PLAN_PRESC_DIV                   2
+#define ADC_PLAN_PRESC                       1
+#else
+#define ADC_PLAN_PRESC_DIV                   1
+#define ADC_PLAN_PRESC                       0
+#endif
+
+/*
+ * 3. Sampling time: ADC_SMPR_SMP1 code
+ */
+#define ADC_PLAN_SMP_SEL                     ADC_PLAN_SMP_I(ADC_PLAN_PRESC_DIV, ADC_PLAN_TCONV_H(ADC_PLAN_RES_BITS))
+
+#if   ADC_PLAN_SMP_SEL == 7
+#define ADC_PLAN_SMP                         7
+#define ADC_PLAN_SMP_STR                     "160.5"
+#elif ADC_PLAN_SMP_SEL == 6
+#define ADC_PLAN_SMP                         6
+#define ADC_PLAN_SMP_STR                     "79.5"
+#elif ADC_PLAN_SMP_SEL == 5
+#define ADC_PLAN_SMP                         5
+#define ADC_PLAN_SMP_STR                     "39.5"
+#elif ADC_PLAN_SMP_SEL == 4
+#define ADC_PLAN_SMP                         4
+#define ADC_PLAN_SMP_STR                     "19.5"
+#elif ADC_PLAN_SMP_SEL == 3
+#define ADC_PLAN_SMP                         3
+#define ADC_PLAN_SMP_STR                     "12.5"
+#elif ADC_PLAN_SMP_SEL == 2
+#define ADC_PLAN_SMP                         2
+#define ADC_PLAN_SMP_STR                     "7.5"
+#elif ADC_PLAN_SMP_SEL == 1
+#define ADC_PLAN_SMP                         1
+#define ADC_PLAN_SMP_STR                     "3.5"
+#else
+#define ADC_PLAN_SMP                         0
+#define ADC_PLAN_SMP_STR                     "1.5"
+#endif
+
+/*
+ * Resulting free-running throughput and sampling time
+ */
+#define ADC_PLAN_FADC_HZ                     (ADC_PLAN_SYSCLK_HZ / ADC_PLAN_PRESC_DIV)
+#define ADC_PLAN_CYCLES_H                    (ADC_PLAN_SMP_H(ADC_PLAN_SMP) + ADC_PLAN_TCONV_H(ADC_PLAN_RES_BITS))
+#define ADC_PLAN_SPS                         ((2 * ADC_PLAN_SYSCLK_HZ) / (ADC_PLAN_PRESC_DIV * ADC_PLAN_CYCLES_H))
+#define ADC_PLAN_TSMP_ACTUAL_NS              ADC_PLAN_TSMP_NS(ADC_PLAN_PRESC_DIV, ADC_PLAN_TCONV_H(ADC_PLAN_RES_BITS))
+
+#if defined(ADC_PLAN_RES_BITS) && (ADC_PLAN_SPS < ADC_PLAN_TARGET_SPS)
+#error "ADC plan: internal error, planned throughput below ADC_PLAN_TARGET_SPS"
+#endif
+
+#define ADC_PLAN_XSTR(x)                     ADC_PLAN_STR(x)
+#define ADC_PLAN_STR(x)                      #x
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_PLAN_H_ */
@@ -0,0 +1,71 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_queue.h                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 27, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Queue - Lock-Free SPSC Block Descriptor Queue         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides a single-producer / single-consumer queue of ADC block descriptors. The        *
+ * DMA interrupt only publishes descriptors, all processing moves to the main loop.                         *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Queue depth configuration.                                                                           *
+ *   - Push (interrupt side), Pop (main loop side) and statistics prototypes.                               *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - Call ADC_Queue_Push() from the ADC_Stream block callback, ADC_Queue_Pop() from while(1).             *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc_stream.h for ADC_Block_t.                                                                        *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_QUEUE_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_QUEUE_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_stream.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_QUEUE_DEPTH
+#define ADC_QUEUE_DEPTH                      4U     // Descriptors, power of two
+#endif
+
+_Static_assert((ADC_QUEUE_DEPTH & (ADC_QUEUE_DEPTH - 1U)) == 0U, "ADC_QUEUE_DEPTH must be a power of two");
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	uint32_t Published;                                           //Descriptors accepted by ADC_Queue_Push()
+	uint32_t Dropped;                                             //Descriptors rejected because the queue was full
+	uint32_t PeakDepth;                                           //Highest fill level seen by the producer
+	uint32_t AdcOverruns;                                         //ADC_ISR_OVR events seen by the producer
+} ADC_QueueStats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void ADC_Queue_Reset(void);
+bool ADC_Queue_Push(const ADC_Block_t *pBlock);
+bool ADC_Queue_Pop(ADC_Block_t *pBlock);
+uint32_t ADC_Queue_Depth(void);
+void ADC_Queue_GetStats(ADC_QueueStats_t *pStats);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_QUEUE_H_ */
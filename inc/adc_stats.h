@@ -0,0 +1,98 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_stats.h                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 11, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Statistics - Single-Pass Windowed Channel Statistics  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides streaming per-channel statistics (min, max, peak-to-peak, mean, RMS, AC RMS)   *
+ * over windows of a fixed number of samples that may span any number of DMA blocks.                        *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Window limits, published result and engine state types.                                              *
+ *   - Init, block update and result read prototypes, the shared 64-bit integer square root.                *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Stats_Init() with the scan length (1 for a single channel) and the window length.                *
+ *   - ADC_Stats_Update() on every block, in the stream callback or in the main loop.                       *
+ *   - ADC_Stats_Get() from any context, or take results from the window callback.                          *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - stm32g030xx.h (PRIMASK) in the implementation only.                                                  *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_STATS_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_STATS_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef ADC_STATS_MAX_CHANNELS
+#define ADC_STATS_MAX_CHANNELS               8U     // Matches the CHSELRMOD = 1 sequence length
+#endif
+
+#define ADC_STATS_WINDOW_MAX                 65536UL  // 16-bit codes: sum stays within uint32
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Results of one completed window, in raw code units. Q4 fields are 1/16 code so averaging gains are
+ * not thrown away: volts = Q4 * Vref / (16 * full scale). AcRms is the RMS about the mean (std. deviation).
+ */
+typedef struct {
+	uint32_t Sequence;                                            //Window number, 1 = first, 0 = none yet
+	uint32_t Count;                                               //Samples in the window
+	uint16_t Min;
+	uint16_t Max;
+	uint16_t PeakToPeak;
+	uint32_t MeanQ4;
+	uint32_t RmsQ4;
+	uint32_t AcRmsQ4;
+} ADC_StatsResult_t;
+
+typedef void (*ADC_StatsCallback_t)(uint32_t Channel, const ADC_StatsResult_t *pResult);
+
+typedef struct {
+	uint32_t Sum;
+	uint64_t SumSq;
+	uint32_t Count;
+	uint16_t Min;
+	uint16_t Max;
+} ADC_StatsAcc_t;
+
+/* One engine per interleaved stream; all state lives here (SRAM), nothing is static */
+typedef struct {
+	uint32_t            Channels;                                 //Samples per scan, 1..ADC_STATS_MAX_CHANNELS
+	uint32_t            Window;                                   //Samples per channel per window
+	uint32_t            Phase;                                    //Channel of the next incoming sample
+	ADC_StatsCallback_t Callback;                                 //Optional, called as each window closes
+	ADC_StatsAcc_t      Acc[ADC_STATS_MAX_CHANNELS];
+	ADC_StatsResult_t   Result[ADC_STATS_MAX_CHANNELS];           //Last completed window per channel
+} ADC_Stats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Stats_Init(ADC_Stats_t *pStats, uint32_t Channels, uint32_t Window, ADC_StatsCallback_t Callback);
+void ADC_Stats_Update(ADC_Stats_t *pStats, const uint16_t *pData, uint32_t Length);
+bool ADC_Stats_Get(const ADC_Stats_t *pStats, uint32_t Channel, ADC_StatsResult_t *pResult);
+uint32_t ADC_Stats_Sqrt64(uint64_t x);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_STATS_H_ */
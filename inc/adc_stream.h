@@ -0,0 +1,80 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_stream.h                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 12, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Streaming - Ping-Pong Block Delivery over DMA         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides the types and function prototypes for double-buffered (ping-pong)              *
+ * ADC acquisition on top of ADC_Start_DMA().                                                               *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Block descriptor handed to the consumer (pointer + length + sequence number).                        *
+ *   - Stream start, block release and IRQ entry points.                                                    *
+ *   - Statistics for delivered blocks and consumer overruns.                                               *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - Call ADC_Stream_IRQHandler(Flags) from the DMA handler registered with DMA1_InitAdc().               *
+ *   - Process each block in place and hand it back with ADC_Stream_Release().                              *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h / dma.h for ADC1_Init(), DMA1_InitAdc() and ADC_Start_DMA().                                   *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_STREAM_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_STREAM_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include "dma.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * One half of the circular DMA buffer. pData points straight into the DMA buffer (zero-copy), so the
+ * block must be handed back with ADC_Stream_Release() before DMA wraps around to it again.
+ * Even sequence numbers are always the first half, odd ones the second half.
+ * Streams started with ADC_Stream_Start8() deliver packed bytes through pData8 instead of pData.
+ */
+typedef struct {
+	union {
+		const uint16_t *pData;                                    //First sample of the block
+		const uint8_t  *pData8;                                   //Same, byte-packed stream
+	};
+	uint32_t        Length;                                       //Number of samples in the block
+	uint32_t        Sequence;                                     //Running block number, no gaps
+	uint8_t         SampleBytes;                                  //1: use pData8, 2: use pData
+} ADC_Block_t;
+
+typedef void (*ADC_BlockCallback_t)(const ADC_Block_t *pBlock);
+
+typedef struct {
+	uint32_t BlocksDelivered;                                     //Blocks handed to the consumer
+	uint32_t Overruns;                                            //DMA re-entered a block that was not released
+	uint32_t LateIRQs;                                            //HT and TC were both pending in one ISR entry
+} ADC_StreamStats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Stream_Start(uint16_t *pBuffer, uint32_t Length, ADC_BlockCallback_t Callback);
+bool ADC_Stream_Start8(uint8_t *pBuffer, uint32_t Length, ADC_BlockCallback_t Callback);
+void ADC_Stream_Release(const ADC_Block_t *pBlock);
+void ADC_Stream_GetStats(ADC_StreamStats_t *pStats);
+void ADC_Stream_IRQHandler(uint32_t Flags);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_STREAM_H_ */
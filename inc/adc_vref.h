@@ -0,0 +1,99 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_vref.h                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 23, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Supply Tracking - VREFINT Ratiometric Correction      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides VDDA tracking from the internal reference: VREFINT (and optionally the         *
+ * temperature sensor) is converted in the same DMA scan as the user channels, VDDA is computed from the    *
+ * factory VREFINT_CAL word and cached as a Q16 millivolt scale for the block conversion.                   *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Internal channel numbers, factory calibration addresses and sensor constants.                        *
+ *   - Scan helper, start/stop, block update, cached-scale conversion and result read prototypes.           *
+ *                                                                                                          *
+ * Intended Use:                                                                                            *
+ *   - ADC_Vref_AddChannels() on the scan configuration, ADC1_ConfigScan(), ADC_Vref_Start(), then start    *
+ *     the stream.                                                                                          *
+ *   - ADC_Vref_Update() on every block, then ADC_Vref_Convert_Block_mV() instead of                        *
+ *     ADC_Convert_Block_mV(): the scale follows the supply, no extra conversion per reading.               *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - adc.h for the scan order, adc_convert.h for the mV kernel.                                           *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_ADC_INC_ADC_VREF_H_
+#define CUSTOM_DRIVERS_ADC_INC_ADC_VREF_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc.h"
+#include "adc_convert.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ADC_VREF_CHANNEL_TSENSE              12U    // CHSEL12: temperature sensor (TSEN)
+#define ADC_VREF_CHANNEL_VREFINT             13U    // CHSEL13: internal reference (VREFEN)
+
+/*
+ * Factory calibration words in system memory (also defined by stm32g0xx_ll_adc.h), 12-bit right-aligned
+ * codes measured at VDDA = 3.0 V and 30 degC
+ */
+#ifndef VREFINT_CAL_ADDR
+#define VREFINT_CAL_ADDR                     ((const uint16_t *)0x1FFF75AAUL)
+#endif
+#ifndef TEMPSENSOR_CAL1_ADDR
+#define TEMPSENSOR_CAL1_ADDR                 ((const uint16_t *)0x1FFF75A8UL)
+#endif
+
+#define ADC_VREF_CAL_mV                      3000U  // VDDA during the factory measurement
+#define ADC_VREF_CAL_DEGC                    30     // TS_CAL1 temperature
+#define ADC_VREF_TS_SLOPE_uV                 2500U  // Avg_Slope (datasheet typ.), uV per degC
+#define ADC_VREF_VDDA_MIN_mV                 1700U  // Operating range: results outside are rejected
+#define ADC_VREF_VDDA_MAX_mV                 3600U
+#define ADC_VREF_TSMP_MIN_NS                 5000U  // ts_vrefint 4 us, ts_temp 5 us (datasheet min)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	uint32_t Sequence;                                            //Accepted windows, 0 = nominal scale still in use
+	uint32_t Vdda_mV;
+	uint32_t ScaleQ16;                                            //mV at the divider input per code, Q16
+	int32_t  Temp_dC;                                             //0.1 degC, INT32_MIN without TSENSE
+	uint32_t Rejected;                                            //Windows with VDDA out of range
+} ADC_VrefResult_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DATA PROCESSING                                                */
+/*																						 				    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void ADC_Vref_Update(const uint16_t *pData, uint32_t Length);
+void ADC_Vref_Convert_Block_mV(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length);
+uint32_t ADC_Vref_GetScale(void);
+bool ADC_Vref_Get(ADC_VrefResult_t *pResult);
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool ADC_Vref_AddChannels(ADC_ScanConfig_t *pConfig, bool Temperature);
+bool ADC_Vref_Start(uint32_t Window);
+bool ADC_Vref_Stop(void);
+
+#endif /* CUSTOM_DRIVERS_ADC_INC_ADC_VREF_H_ */
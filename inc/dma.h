@@ -13,11 +13,15 @@
  *                                                                                                          *
  * Contents:                                                                                                *
  *   - Function prototypes for DMA initialization and transfer control.                                     *
- *   - Definitions for DMA Peripheral addresses.                                                            *
- *   - External variables for DMA status or callback tracking.                                              *
+ *   - Definitions for DMA Peripheral addresses and DMAMUX request IDs.                                     *
+ *   - Channel allocator: any free DMA1 channel per request, DMAMUX routing, per-channel handlers behind    *
+ *     the three shared G0 vectors.                                                                         *
  *                                                                                                          *
  * Intended Use:                                                                                            *
  *   - Include in application files (e.g., app.c, main.c) to access DMA driver APIs.                        *
+ *   - DMA1_Init(), then DMA1_InitAdc() / DMA1_InitUsartTx() or DMA1_Alloc() for other peripherals. dma.c   *
+ *     defines DMA1_Channel1_IRQHandler(), DMA1_Channel2_3_IRQHandler() and                                 *
+ *     DMA1_Ch4_5_DMAMUX1_OVR_IRQHandler(): do not define them elsewhere.                                   *
  *                                                                                                          *
  * Dependencies:                                                                                            *
  *   - CMSIS device headers (e.g., stm32g030xx.h) for register definitions.                                 *
@@ -44,7 +48,69 @@
 /*                                                                                  						*/
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 #define ADC1_DR_ADDRESS                       (ADC1_BASE + 0x40UL)  //(uint32_t)&ADC1->DR;
-#define DMAMUX_ADC_DMA                        (5 << DMAMUX_CxCR_DMAREQ_ID_Pos)
+
+/*
+ * DMAMUX request IDs (DMAREQ_ID), DMA_ChannelConfig_t.Request
+ */
+#define DMA_REQ_ADC                           5U
+#define DMA_REQ_SPI1_RX                       16U
+#define DMA_REQ_SPI1_TX                       17U
+#define DMA_REQ_SPI2_RX                       18U
+#define DMA_REQ_SPI2_TX                       19U
+#define DMA_REQ_USART1_RX                     50U
+#define DMA_REQ_USART1_TX                     51U
+#define DMA_REQ_USART2_RX                     52U
+#define DMA_REQ_USART2_TX                     53U
+
+#define DMA1_CHANNELS                         5U                    //DMA1 Channel1..5 <- DMAMUX channel 0..4
+#define DMA1_CHANNEL_ANY                      0U                    //Lowest free channel / no channel
+
+/*
+ * Per-channel flags as passed to DMA_Handler_t: the channel's nibble of DMA_ISR / DMA_IFCR, which also
+ * matches the TCIE/HTIE/TEIE positions in DMA_CCR
+ */
+#define DMA_FLAG_GI                           0x1UL
+#define DMA_FLAG_TC                           0x2UL
+#define DMA_FLAG_HT                           0x4UL
+#define DMA_FLAG_TE                           0x8UL
+#define DMA_FLAG_ALL                          0xFUL
+
+/*
+ * PSIZE / MSIZE encodings
+ */
+#define DMA_SIZE_8BIT                         0x0UL                 //00: 8 bits
+#define DMA_SIZE_16BIT                        0x1UL                 //01: 16 bits
+#define DMA_SIZE_32BIT                        0x2UL                 //10: 32 bits
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * DMA_CCRx PL: arbitration between channels requesting at the same time (ties go to the lower channel)
+ */
+typedef enum {
+	DMA_PRIORITY_LOW       = 0,                                   //00
+	DMA_PRIORITY_MEDIUM    = 1,                                   //01
+	DMA_PRIORITY_HIGH      = 2,                                   //10
+	DMA_PRIORITY_VERY_HIGH = 3                                    //11
+} DMA_Priority_t;
+
+/*
+ * Interrupt context. Flags = DMA_FLAG_x of this channel at vector entry, not cleared: the handler clears
+ * what it served with DMA1_ClearFlags().
+ */
+typedef void (*DMA_Handler_t)(uint32_t Channel, uint32_t Flags, void *pCtx);
+
+typedef struct {
+	uint32_t       Request;                                       //DMA_REQ_x
+	uint32_t       Channel;                                       //1..DMA1_CHANNELS, DMA1_CHANNEL_ANY = lowest free
+	DMA_Priority_t Priority;
+	uint32_t       IrqPriority;                                   //NVIC 0..3, shared vectors keep the most urgent
+	DMA_Handler_t  Handler;                                       //NULL: no interrupt for this channel
+	void          *pCtx;
+} DMA_ChannelConfig_t;
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /*																											*/
@@ -52,12 +118,30 @@
 /*																										    */
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 void DMA1_Init(void);
+uint32_t DMA1_InitAdc(const DMA_ChannelConfig_t *pConfig);
+uint32_t DMA1_InitUsartTx(const DMA_ChannelConfig_t *pConfig);
+void DMA1_ConfigDataWidth(DMA_Channel_TypeDef *DMA_Channelx, uint32_t DataBits);
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CHANNEL ALLOCATION                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+uint32_t DMA1_Alloc(const DMA_ChannelConfig_t *pConfig);
+void DMA1_Free(uint32_t Channel);
+uint32_t DMA1_GetAdcChannel(void);
+DMA_Channel_TypeDef *DMA1_GetChannel(uint32_t Channel);
+IRQn_Type DMA1_GetIRQn(uint32_t Channel);
+uint32_t DMA1_GetFlags(uint32_t Channel);
+void DMA1_ClearFlags(uint32_t Channel, uint32_t Flags);
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /*																											*/
 /*                                           LOW-LEVEL FUNCTIONS                                            */
 /*																										    */
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
-void ADC_Start_DMA(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint32_t *pData, uint32_t DataLength);
+bool ADC_Start_DMA16(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint16_t *pData, uint32_t DataLength);
+bool ADC_Start_DMA8(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint8_t *pData, uint32_t DataLength);
+bool USART_Start_DMA(USART_TypeDef *USARTx, DMA_Channel_TypeDef *DMA_Channelx, const uint8_t *pData, uint32_t DataLength);
 
 #endif /* CUSTOM_DRIVERS_DMA_INC_DMA_H_ */
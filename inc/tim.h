@@ -0,0 +1,68 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: tim.h                                ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 20, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 TIM Driver - ADC Trigger Timebase                         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides function prototypes and definitions for the timer used as the ADC              *
+ * conversion trigger (TIM3 TRGO on update event).                                                          *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Timebase result (timer clock, divider, achieved rate).                                               *
+ *   - Prototypes to program, start and stop the trigger timer.                                             *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - CMSIS device headers (e.g., stm32g030xx.h) for register definitions.                                 *
+ *   - tim.c implementation file containing the function bodies.                                            *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_TIM_INC_TIM_H_
+#define CUSTOM_DRIVERS_TIM_INC_TIM_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "stm32g030xx.h"
+#include "stm32g0xx_hal.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define TIM_TRGO_MAX_HZ                      2500000U   // ADC ceiling: 2.5 Msps
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * The exact trigger rate is TimerClockHz / Divider (Divider = (PSC + 1) * (ARR + 1)).
+ */
+typedef struct {
+	uint32_t TimerClockHz;                                        //TIM3 kernel clock
+	uint32_t Divider;                                             //Timer clocks per trigger
+	uint32_t AchievedMilliHz;                                     //TimerClockHz / Divider, in mHz
+} TIM_Timebase_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+uint32_t TIM3_GetClockHz(void);
+bool TIM3_ConfigTRGO(uint32_t RateHz, TIM_Timebase_t *pTimebase);
+void TIM3_Start(void);
+void TIM3_Stop(void);
+
+#endif /* CUSTOM_DRIVERS_TIM_INC_TIM_H_ */
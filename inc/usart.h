@@ -0,0 +1,52 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: usart.h                              ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 USART Driver - DMA Transmit Link                          ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides function prototypes and definitions for USART2 used as a transmit-only        *
+ * data link (TX on PA2), fed by DMA.                                                                       *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Baud rate limits.                                                                                    *
+ *   - Prototypes to bring the link up and query its byte time.                                             *
+ *                                                                                                          *
+ * Dependencies:                                                                                            *
+ *   - CMSIS device headers (e.g., stm32g030xx.h) for register definitions.                                 *
+ *   - usart.c implementation file containing the function bodies.                                          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef CUSTOM_DRIVERS_USART_INC_USART_H_
+#define CUSTOM_DRIVERS_USART_INC_USART_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "stm32g030xx.h"
+#include "stm32g0xx_hal.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define USART_BRR_MIN                        16U    // Oversampling by 16: BRR >= 16
+#define USART_FRAME_BITS                     10U    // 8N1: start + 8 data + stop
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+bool USART2_InitTx(uint32_t Baud, uint32_t *pAchievedBaud);
+uint32_t USART2_BytesPerSecond(void);
+
+#endif /* CUSTOM_DRIVERS_USART_INC_USART_H_ */
@@ -0,0 +1,739 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_bench.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 20, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Waveform Replay Benchmark                      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Replays synthetic or recorded waveforms through the acquisition path of src/main.c on the peripheral     *
+ * model (DMA HT/TC handoff, SPSC queue, conversion, decimation, statistics, export packing) and times      *
+ * every stage on the host, so hot-path regressions show up before field units are flashed.                 *
+ *                                                                                                          *
+ * Usage:                                                                                                   *
+ *   ./adc_bench [options] [wave ...]   waves: sine, step, noise, ramp (default: all four), or a recording  *
+ *                                      file.csv ("index,code" or "code" per line, e.g. from adc_decode)    *
+ *                                      or file.bin (raw ADC_Export capture, e.g. adc_export.bin)           *
+ *   -s seconds      simulated time per synthetic wave (default 1), recordings play once                    *
+ *   -r runs         repetitions per wave, the fastest one counts (default 3)                               *
+ *   -o baseline     write the results as a baseline file                                                   *
+ *   -c baseline     compare: changed checksum or register count, or slower by more than -t %               *
+ *   -t percent      cycles/sample tolerance for -c (default 25)                                            *
+ *                                                                                                          *
+ * Reported per wave and stage:                                                                             *
+ *   - Host cycles/sample (TSC on x86, ns elsewhere) from the median block of the fastest run, so a         *
+ *     preempted block does not move it; mean, p99 and worst block, register accesses per block and         *
+ *     an FNV-1a checksum of the stage output.                                                              *
+ *   - Block latency: DMA ISR handoff + every stage of the main-loop path for one block, p99 and worst.     *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Host cycles are not M0+ cycles: compare runs on one machine, use ADC_Convert_Benchmark() and the     *
+ *     ADC_INSTR histograms on the target for absolute numbers. Register accesses per block carry over.     *
+ *   - The handoff includes the register model behind the DMA/ADC accesses of the ISR.                      *
+ *   - "float" is the formula the DMA ISR used before ADC_Convert_Block_mV(), kept as a reference; it       *
+ *     is not part of the block latency.                                                                    *
+ *                                                                                                          *
+ * Exit status:                                                                                             *
+ *   - 0 on success; 1 on lost samples, runs that disagree, rule violations or a -c regression.             *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define _POSIX_C_SOURCE 199309L                                  //clock_gettime()
+
+#include "sim.h"
+#include "adc.h"
+#include "dma.h"
+#include "adc_stream.h"
+#include "adc_convert.h"
+#include "adc_queue.h"
+#include "adc_decim.h"
+#include "adc_stats.h"
+#include "adc_pack.h"
+#include "adc_export.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ADC_BUFFER_LEN                       32U    // Same as src/main.c
+#define DECIM_RATIO                          8U
+#define BENCH_BLOCK                          (ADC_BUFFER_LEN / 2U)
+#define BENCH_RUNS_MAX                       16U
+#define BENCH_WAVES_MAX                      16U
+#define BENCH_FNV_BASIS                      2166136261UL
+#define BENCH_FNV_PRIME                      16777619UL
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           TYPES                                                          */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	BENCH_HANDOFF = 0,                                            //DMA ISR: HT/TC -> block descriptor -> queue
+	BENCH_MV      = 1,                                            //ADC_Convert_Block_mV()
+	BENCH_DECIM   = 2,                                            //ADC_Decim_Process()
+	BENCH_STATS   = 3,                                            //ADC_Stats_Update()
+	BENCH_PACK    = 4,                                            //ADC_Pack_Put() delta frames, last path stage
+	BENCH_Q16     = 5,                                            //ADC_Convert_Block_Q16(), not in the path
+	BENCH_FLOAT   = 6,                                            //Original float formula, not in the path
+	BENCH_STAGES  = 7
+} Bench_Stage_t;
+
+typedef struct {
+	uint64_t  Ticks;                                              //Sum over the run
+	uint64_t *pBlock;                                             //Per block, sorted after the run
+	uint64_t  Registers;                                          //Simulated register accesses
+	uint32_t  Checksum;                                           //FNV-1a of the stage output
+} Bench_StageRun_t;
+
+typedef struct {
+	Bench_StageRun_t Stage[BENCH_STAGES];
+	uint64_t        *pLatency;                                    //Per block, sorted after the run
+	uint64_t         Blocks;
+	uint64_t         Samples;
+	bool             Lossless;
+} Bench_Run_t;
+
+typedef struct {
+	const char *pName;
+	uint16_t   *pCodes;                                           //Recording, 12-bit codes
+	size_t      Length;
+	size_t      Next;
+	SIM_Wave_t  Wave;                                             //Synthetic
+} Bench_Wave_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           BENCH STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static const char *const stage_names[BENCH_STAGES] = { "handoff", "mV", "decim", "stats", "pack", "Q16", "float" };
+
+uint16_t adc_buffer[ADC_BUFFER_LEN];                              //Global: CMAR must stay below 4 GB
+static uint16_t adc_mV[BENCH_BLOCK];
+static uint32_t adc_q16[BENCH_BLOCK];
+static float    adc_float[BENCH_BLOCK];
+static int16_t  adc_filtered[ADC_DECIM_OUT_MAX(BENCH_BLOCK, DECIM_RATIO)];
+static uint8_t  pack_frame[ADC_EXPORT_FRAME_BYTES];
+
+static ADC_Decim_t      decim;
+static ADC_Stats_t      stats;
+static ADC_PackWriter_t pack;
+static uint16_t         pack_sequence;
+static uint32_t         pack_first;
+static Bench_Run_t     *pRun;                                     //Run being recorded
+static uint64_t         handoff_ticks[ADC_QUEUE_DEPTH];           //ISR cost of the block, by Sequence
+static uint32_t         handoff_sequence;
+static uint64_t         tick_overhead;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           TIMING / CHECKSUMS                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static inline uint64_t Bench_Ticks(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();                                //x86intrin.h clashes with the CMSIS __I
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static double Host_Seconds(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Bench_Calibrate()
+ * Purpose  : Ticks per ns and the cost of an empty measurement
+ * Details  : The overhead is the fastest of 1000 back-to-back
+ *            reads and is subtracted from every stage sample
+ * Runtime  : ~50 ms
+ * ────────────────────────────────────────────────────────────── */
+static double Bench_Calibrate(void) {
+	double   t0 = Host_Seconds(), t1;
+	uint64_t k0 = Bench_Ticks(), k1;
+
+	tick_overhead = UINT64_MAX;
+	for (uint32_t i = 0; i < 1000U; i++) {
+		uint64_t a = Bench_Ticks();
+		uint64_t b = Bench_Ticks();
+
+		tick_overhead = ((b - a) < tick_overhead) ? (b - a) : tick_overhead;
+	}
+	do {
+		t1 = Host_Seconds();
+	} while ((t1 - t0) < 0.05);
+	k1 = Bench_Ticks();
+
+	return (double)(k1 - k0) / ((t1 - t0) * 1e9);
+}
+
+static uint32_t Bench_Fnv(uint32_t Hash, const void *pData, size_t Length) {
+	const uint8_t *p = (const uint8_t *)pData;
+
+	while (Length--) {
+		Hash = (Hash ^ *p++) * BENCH_FNV_PRIME;
+	}
+	return Hash;
+}
+
+static uint64_t Bench_Account(Bench_Stage_t Stage, uint64_t T0, uint64_t R0) {
+	uint64_t          dt = Bench_Ticks() - T0;
+	Bench_StageRun_t *s  = &pRun->Stage[Stage];
+
+	dt = (dt > tick_overhead) ? (dt - tick_overhead) : 0U;
+	s->Ticks     += dt;
+	s->Registers += sim_stats.RegisterAccesses - R0;
+	if (Stage != BENCH_HANDOFF) {
+		s->pBlock[pRun->Blocks] = dt;                             //Handoff: stored when the block is popped
+	}
+	return dt;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INTERRUPT HANDLERS                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static void ADC_DMA_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx) {
+	uint64_t r0 = sim_stats.RegisterAccesses;
+	uint64_t t0 = Bench_Ticks();
+	uint64_t dt;
+
+	(void)Channel;
+	(void)pCtx;
+	handoff_sequence = UINT32_MAX;
+	ADC_Stream_IRQHandler(Flags);
+	dt = Bench_Account(BENCH_HANDOFF, t0, r0);
+	if (handoff_sequence != UINT32_MAX) {
+		handoff_ticks[handoff_sequence % ADC_QUEUE_DEPTH] = dt;
+	}
+}
+
+void ADC1_IRQHandler(void) {
+	ADC1_Init_IRQHandler();
+}
+
+static void ADC_BlockReady(const ADC_Block_t *pBlock) {
+
+	handoff_sequence = pBlock->Sequence;
+	if (!ADC_Queue_Push(pBlock)) {
+		ADC_Stream_Release(pBlock);
+	}
+}
+
+static void Stats_Window(uint32_t Channel, const ADC_StatsResult_t *pResult) {
+	uint32_t *sum = &pRun->Stage[BENCH_STATS].Checksum;
+
+	(void)Channel;
+	*sum = Bench_Fnv(*sum, &pResult->Min, sizeof(pResult->Min));
+	*sum = Bench_Fnv(*sum, &pResult->Max, sizeof(pResult->Max));
+	*sum = Bench_Fnv(*sum, &pResult->MeanQ4, sizeof(pResult->MeanQ4));
+	*sum = Bench_Fnv(*sum, &pResult->RmsQ4, sizeof(pResult->RmsQ4));
+	*sum = Bench_Fnv(*sum, &pResult->AcRmsQ4, sizeof(pResult->AcRmsQ4));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Pack_Block()
+ * Purpose  : Delta-code one block into export frames
+ * Details  : Same loop as ADC_Export_Block() without the USART:
+ *            each closed frame goes into the checksum
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void Pack_Block(const uint16_t *pData, uint32_t Length) {
+	uint32_t taken = 0;
+
+	while (taken < Length) {
+		taken += ADC_Pack_Put(&pack, &pData[taken], Length - taken);
+		if (ADC_Pack_IsFull(&pack)) {
+			uint32_t  bytes = ADC_Pack_End(&pack, pack_sequence++, pack_first);
+			uint32_t *sum   = &pRun->Stage[BENCH_PACK].Checksum;
+
+			*sum       = Bench_Fnv(*sum, pack_frame, bytes);
+			pack_first += pack.Count;
+			ADC_Pack_Begin(&pack, pack_frame, ADC_PACK_DELTA, ADC_RESOLUTION_BITS, ADC_EXPORT_FRAME_SAMPLES);
+		}
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Bench_Block()
+ * Purpose  : Main-loop path of src/main.c on one popped block
+ * Details  : Every stage is timed on its own; the block latency
+ *            is the ISR handoff plus the path stages
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void Bench_Block(const ADC_Block_t *pBlock) {
+	const uint16_t *pData = pBlock->pData;
+	uint32_t        n = pBlock->Length;
+	uint64_t        latency = handoff_ticks[pBlock->Sequence % ADC_QUEUE_DEPTH];
+	uint64_t        t0, r0;
+	uint32_t        out;
+
+	pRun->Stage[BENCH_HANDOFF].pBlock[pRun->Blocks] = latency;
+	pRun->Stage[BENCH_HANDOFF].Checksum = Bench_Fnv(pRun->Stage[BENCH_HANDOFF].Checksum, pData, n * 2U);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	ADC_Convert_Block_mV(pData, adc_mV, n);
+	latency += Bench_Account(BENCH_MV, t0, r0);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	out = ADC_Decim_Process(&decim, pData, n, adc_filtered);
+	latency += Bench_Account(BENCH_DECIM, t0, r0);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	ADC_Stats_Update(&stats, pData, n);
+	latency += Bench_Account(BENCH_STATS, t0, r0);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	Pack_Block(pData, n);
+	latency += Bench_Account(BENCH_PACK, t0, r0);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	ADC_Convert_Block_Q16(pData, adc_q16, n);
+	(void)Bench_Account(BENCH_Q16, t0, r0);
+
+	r0 = sim_stats.RegisterAccesses;
+	t0 = Bench_Ticks();
+	for (uint32_t i = 0; i < n; i++) {
+		adc_float[i] = (ADC_VREF_mV / 1000.0f * pData[i] / ADC_FULL_SCALE) * (ADC_DIVIDER_R_TOP + ADC_DIVIDER_R_BOTTOM) /
+		               ADC_DIVIDER_R_BOTTOM;
+	}
+	(void)Bench_Account(BENCH_FLOAT, t0, r0);
+
+	pRun->Stage[BENCH_MV].Checksum    = Bench_Fnv(pRun->Stage[BENCH_MV].Checksum, adc_mV, n * 2U);
+	pRun->Stage[BENCH_DECIM].Checksum = Bench_Fnv(pRun->Stage[BENCH_DECIM].Checksum, adc_filtered, out * 2U);
+	pRun->Stage[BENCH_Q16].Checksum   = Bench_Fnv(pRun->Stage[BENCH_Q16].Checksum, adc_q16, n * 4U);
+	pRun->Stage[BENCH_FLOAT].Checksum = Bench_Fnv(pRun->Stage[BENCH_FLOAT].Checksum, adc_float, n * 4U);
+
+	pRun->pLatency[pRun->Blocks++] = latency;
+	pRun->Samples += n;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           WAVEFORMS                                                      */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Replay_Input()
+ * Purpose  : SIM_WaveFn_t of a recording
+ * Details  : One call per conversion of the channel: the next
+ *            code, as the voltage the model converts back to it
+ *            (CALFACT removes the model offset). Loops at the end.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static double Replay_Input(uint32_t Channel, uint64_t TimeNs, void *pCtx) {
+	Bench_Wave_t *w = (Bench_Wave_t *)pCtx;
+	uint16_t      code = w->pCodes[w->Next];
+
+	(void)Channel;
+	(void)TimeNs;
+	w->Next = (w->Next + 1U < w->Length) ? (w->Next + 1U) : 0U;
+	return ((double)code * SIM_GetSupply()) / 4095.0;
+}
+
+static bool Replay_Append(Bench_Wave_t *pWave, size_t *pSize, uint32_t Code) {
+
+	if (pWave->Length == *pSize) {
+		*pSize = (*pSize != 0U) ? (2U * *pSize) : 4096U;
+		pWave->pCodes = realloc(pWave->pCodes, *pSize * sizeof(uint16_t));
+		if (pWave->pCodes == NULL) {
+			return false;
+		}
+	}
+	pWave->pCodes[pWave->Length++] = (uint16_t)((Code > 4095U) ? 4095U : Code);
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Replay_Load()
+ * Purpose  : Read a recording into 12-bit codes
+ * Details  : .bin: ADC_Export frames decoded with adc_pack.c,
+ *            lower resolutions scaled up. Otherwise text, the
+ *            last number of each line is the code.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Replay_Load(Bench_Wave_t *pWave, const char *pPath) {
+	static uint16_t out[UINT16_MAX];
+	const size_t    len = strlen(pPath);
+	size_t          size = 0;
+	FILE           *pIn = fopen(pPath, "rb");
+
+	if (pIn == NULL) {
+		perror(pPath);
+		return false;
+	}
+
+	if ((len > 4U) && (strcmp(&pPath[len - 4U], ".bin") == 0)) {
+		uint8_t        *pData = NULL;
+		size_t          bytes = 0, pos = 0, cap = 0, got;
+		ADC_FrameInfo_t info;
+
+		do {
+			cap   = (cap != 0U) ? (2U * cap) : 65536U;
+			pData = realloc(pData, cap);
+			got   = (pData != NULL) ? fread(&pData[bytes], 1U, cap - bytes, pIn) : 0U;
+			bytes += got;
+		} while ((pData != NULL) && (bytes == cap));
+
+		while ((pData != NULL) && (pos < bytes)) {
+			ADC_UnpackStatus_t status = ADC_Unpack_Frame(&pData[pos], (uint32_t)(bytes - pos), &info, out,
+			                                             UINT16_MAX);
+
+			if (status == ADC_UNPACK_SHORT) {
+				break;
+			}
+			if (status != ADC_UNPACK_OK) {
+				pos++;
+				continue;
+			}
+			for (uint32_t i = 0; i < info.Count; i++) {
+				Replay_Append(pWave, &size, (uint32_t)out[i] << (12U - info.Bits));
+			}
+			pos += info.FrameBytes;
+		}
+		free(pData);
+	} else {
+		char line[128];
+
+		while (fgets(line, sizeof(line), pIn) != NULL) {
+			char *p = strrchr(line, ',');
+
+			p = (p != NULL) ? (p + 1) : line;
+			if ((*p >= '0') && (*p <= '9')) {
+				Replay_Append(pWave, &size, (uint32_t)strtoul(p, NULL, 10));
+			}
+		}
+	}
+	fclose(pIn);
+
+	if (pWave->Length == 0U) {
+		fprintf(stderr, "%s: no samples\n", pPath);
+		return false;
+	}
+	pWave->pName = pPath;
+	return true;
+}
+
+static bool Wave_Builtin(Bench_Wave_t *pWave, const char *pName) {
+	static const struct {
+		const char *pName;
+		SIM_Wave_t  Wave;
+	} builtin[] = {
+		{ "sine",  { .Kind = SIM_WAVE_SINE,   .Offset_V = 1.65, .Amplitude_V = 1.2, .Freq_Hz = 50.0, .Noise_V = 0.002 } },
+		{ "step",  { .Kind = SIM_WAVE_SQUARE, .Offset_V = 1.65, .Amplitude_V = 1.2, .Freq_Hz = 5.0,  .Noise_V = 0.002 } },
+		{ "noise", { .Kind = SIM_WAVE_DC,     .Offset_V = 1.65, .Noise_V = 0.3 } },
+		{ "ramp",  { .Kind = SIM_WAVE_RAMP,   .Offset_V = 0.2,  .Amplitude_V = 2.9, .Freq_Hz = 10.0, .Noise_V = 0.002 } },
+	};
+
+	for (size_t i = 0; i < sizeof(builtin) / sizeof(builtin[0]); i++) {
+		if (strcmp(pName, builtin[i].pName) == 0) {
+			pWave->pName = builtin[i].pName;
+			pWave->Wave  = builtin[i].Wave;
+			return true;
+		}
+	}
+	return false;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           RUN                                                            */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static int Ticks_Compare(const void *pA, const void *pB) {
+	uint64_t a = *(const uint64_t *)pA, b = *(const uint64_t *)pB;
+
+	return (a > b) - (a < b);
+}
+
+static uint64_t *Ticks_Alloc(uint64_t Count) {
+	uint64_t *p = calloc(Count, sizeof(uint64_t));
+
+	if (p == NULL) {
+		abort();
+	}
+	return p;
+}
+
+/* Percentile of a sorted per-block array, 0 for an empty run */
+static uint64_t Ticks_At(const uint64_t *pSorted, uint64_t Count, uint32_t Percent) {
+	return (Count != 0U) ? pSorted[((Count - 1U) * Percent) / 100U] : 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Bench_RunWave()
+ * Purpose  : One run of one wave from a fresh model
+ * Details  : Bring-up as src/main.c, then the stream until the
+ *            simulated time is up. Lossless = no overrun, drop,
+ *            OVR or rule violation.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void Bench_RunWave(Bench_Wave_t *pWave, uint64_t DurationNs, Bench_Run_t *pResult) {
+	uint64_t          max_blocks = (DurationNs / 1000000000ULL + 2U) * ADC_PLAN_SPS / BENCH_BLOCK + 16U;
+	const DMA_ChannelConfig_t adc_dma = { .Channel = DMA1_CHANNEL_ANY, .Priority = DMA_PRIORITY_HIGH,
+	                                      .IrqPriority = 1U, .Handler = ADC_DMA_IRQHandler };
+	uint64_t          end_ns;
+	ADC_Block_t       block;
+	ADC_StreamStats_t stream;
+	ADC_QueueStats_t  queue;
+
+	memset(pResult, 0, sizeof(*pResult));
+	pResult->pLatency = Ticks_Alloc(max_blocks);
+	for (uint32_t s = 0; s < BENCH_STAGES; s++) {
+		pResult->Stage[s].pBlock   = Ticks_Alloc(max_blocks);
+		pResult->Stage[s].Checksum = BENCH_FNV_BASIS;
+	}
+	pRun = pResult;
+
+	SIM_Reset(NULL);
+	if (pWave->pCodes != NULL) {
+		pWave->Next = 0;
+		SIM_SetWaveform(0, Replay_Input, pWave);
+	} else {
+		SIM_SetWave(0, &pWave->Wave);
+	}
+
+	HAL_Init();
+	ADC1_InitAsync(ADC_INIT_FLAG_IRQ);
+	DMA1_Init();
+	DMA1_InitAdc(&adc_dma);
+	while (ADC1_InitPoll() < ADC_INIT_READY) {
+	}
+
+	ADC_Decim_Init(&decim, DECIM_RATIO, ADC1_GetResultBits());
+	ADC_Stats_Init(&stats, 1U, ADC_PLAN_SPS / 10U, Stats_Window);
+	ADC_Pack_Begin(&pack, pack_frame, ADC_PACK_DELTA, ADC_RESOLUTION_BITS, ADC_EXPORT_FRAME_SAMPLES);
+	pack_sequence = 0;
+	pack_first    = 0;
+	ADC_Queue_Reset();
+	ADC_Stream_Start(adc_buffer, ADC_BUFFER_LEN, ADC_BlockReady);
+
+	end_ns = SIM_GetTimeNs() + DurationNs;
+	while (SIM_GetTimeNs() < end_ns) {
+		while ((pResult->Blocks < max_blocks) && ADC_Queue_Pop(&block)) {
+			Bench_Block(&block);
+			ADC_Stream_Release(&block);
+		}
+		__WFI();
+	}
+	ADC1_Stop();
+
+	ADC_Stream_GetStats(&stream);
+	ADC_Queue_GetStats(&queue);
+	pResult->Lossless = (stream.Overruns == 0U) && (queue.Dropped == 0U) && (sim_stats.Overruns == 0U) &&
+	                    (sim_stats.Violations == 0U);
+	pResult->Lossless &= (pResult->Blocks != 0U);
+	qsort(pResult->pLatency, pResult->Blocks, sizeof(uint64_t), Ticks_Compare);
+	for (uint32_t s = 0; s < BENCH_STAGES; s++) {
+		qsort(pResult->Stage[s].pBlock, pResult->Blocks, sizeof(uint64_t), Ticks_Compare);
+	}
+}
+
+static void Bench_FreeRun(Bench_Run_t *pRunResult) {
+
+	free(pRunResult->pLatency);
+	for (uint32_t s = 0; s < BENCH_STAGES; s++) {
+		free(pRunResult->Stage[s].pBlock);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Baseline_Check()
+ * Purpose  : Compare one wave/stage result with a baseline file
+ * Details  : Line format: wave stage cycles/sample*100
+ *            registers/block*100 checksum. Unknown entries pass.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Baseline_Check(FILE *pBase, const char *pWave, const char *pStage, uint64_t Cycles100,
+                           uint64_t Regs100, uint32_t Checksum, uint32_t Tolerance, const char **ppWhy) {
+	char               wave[256], stage[32];
+	unsigned long long cycles, regs;
+	unsigned long      sum;
+
+	rewind(pBase);
+	while (fscanf(pBase, "%255s %31s %llu %llu %lx", wave, stage, &cycles, &regs, &sum) == 5) {
+		if ((strcmp(wave, pWave) != 0) || (strcmp(stage, pStage) != 0)) {
+			continue;
+		}
+		if ((uint32_t)sum != Checksum) {
+			*ppWhy = "output changed";
+			return false;
+		}
+		if (Regs100 > regs) {
+			*ppWhy = "more register accesses";
+			return false;
+		}
+		if (Cycles100 * 100U > cycles * (100U + Tolerance)) {
+			*ppWhy = "slower";
+			return false;
+		}
+		*ppWhy = "ok";
+		return true;
+	}
+	*ppWhy = "new";
+	return true;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MAIN                                                           */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+int main(int argc, char **argv) {
+	static Bench_Wave_t waves[BENCH_WAVES_MAX];
+	static Bench_Run_t  runs[BENCH_RUNS_MAX];
+	static const char  *defaults[] = { "sine", "step", "noise", "ramp" };
+	double      seconds = 1.0, ticks_per_ns;
+	uint32_t    nwaves = 0, nruns = 3U, tolerance = 25U;
+	const char *pSave = NULL, *pCheck = NULL;
+	FILE       *pOut = NULL, *pBase = NULL;
+	bool        failed = false;
+
+	for (int a = 1; a < argc; a++) {
+		if ((argv[a][0] == '-') && (argv[a][1] != '\0') && (argv[a][2] == '\0') && (a + 1 < argc)) {
+			switch (argv[a][1]) {
+			case 's': seconds   = atof(argv[++a]);                       break;
+			case 'r': nruns     = (uint32_t)strtoul(argv[++a], NULL, 10); break;
+			case 'o': pSave     = argv[++a];                             break;
+			case 'c': pCheck    = argv[++a];                             break;
+			case 't': tolerance = (uint32_t)strtoul(argv[++a], NULL, 10); break;
+			default:  fprintf(stderr, "unknown option %s\n", argv[a]); return 2;
+			}
+		} else if (nwaves < BENCH_WAVES_MAX) {
+			if (!Wave_Builtin(&waves[nwaves], argv[a]) && !Replay_Load(&waves[nwaves], argv[a])) {
+				return 2;
+			}
+			nwaves++;
+		}
+	}
+	if (nwaves == 0U) {
+		for (size_t i = 0; i < sizeof(defaults) / sizeof(defaults[0]); i++) {
+			Wave_Builtin(&waves[nwaves++], defaults[i]);
+		}
+	}
+	nruns = (nruns == 0U) ? 1U : (nruns > BENCH_RUNS_MAX) ? BENCH_RUNS_MAX : nruns;
+
+	if ((pSave != NULL) && ((pOut = fopen(pSave, "w")) == NULL)) {
+		perror(pSave);
+		return 2;
+	}
+	if ((pCheck != NULL) && ((pBase = fopen(pCheck, "r")) == NULL)) {
+		perror(pCheck);
+		return 2;
+	}
+
+	ticks_per_ns = Bench_Calibrate();
+	printf("plan           : %s, %u sps, %u-sample blocks (%.0f us), %u target cycles/sample at %u Hz\n",
+	       ADC_PLAN_TCONV_STR, (unsigned)ADC_PLAN_SPS, (unsigned)BENCH_BLOCK, BENCH_BLOCK * 1e6 / ADC_PLAN_SPS,
+	       (unsigned)(SIM_SYSCLK_HZ / ADC_PLAN_SPS), (unsigned)SIM_SYSCLK_HZ);
+	printf("host clock     : %.3f ticks/ns (%s), %lu ticks measurement overhead removed, best of %lu runs\n",
+	       ticks_per_ns,
+#if defined(__x86_64__) || defined(__i386__)
+	       "TSC",
+#else
+	       "CLOCK_MONOTONIC",
+#endif
+	       (unsigned long)tick_overhead, (unsigned long)nruns);
+
+	for (uint32_t w = 0; w < nwaves; w++) {
+		Bench_Wave_t *wave = &waves[w];
+		uint64_t      duration = (wave->pCodes != NULL)
+		                         ? (uint64_t)((double)wave->Length * 1e9 / ADC_PLAN_SPS) + 1000000ULL
+		                         : (uint64_t)(seconds * 1e9);
+		Bench_Run_t  *best = &runs[0];
+		bool          agree = true, lossless = true;
+
+		for (uint32_t r = 0; r < nruns; r++) {
+			Bench_RunWave(wave, duration, &runs[r]);
+			lossless &= runs[r].Lossless;
+			agree    &= (runs[r].Blocks == runs[0].Blocks);
+			for (uint32_t s = 0; s < BENCH_STAGES; s++) {
+				agree &= (runs[r].Stage[s].Checksum == runs[0].Stage[s].Checksum) &&
+				         (runs[r].Stage[s].Registers == runs[0].Stage[s].Registers);
+			}
+			if (Ticks_At(runs[r].pLatency, runs[r].Blocks, 50U) < Ticks_At(best->pLatency, best->Blocks, 50U)) {
+				best = &runs[r];                                  //Lowest median block latency
+			}
+		}
+		failed |= !agree || !lossless;
+
+		printf("\n%s: %llu samples, %llu blocks%s%s\n", wave->pName, (unsigned long long)best->Samples,
+		       (unsigned long long)best->Blocks, lossless ? "" : (best->Blocks != 0U) ? ", SAMPLES LOST" : ", NO BLOCKS",
+		       agree ? "" : ", RUNS DISAGREE (nondeterministic output)");
+		printf("  %-8s %11s %8s %8s %10s %10s %9s %9s\n", "stage", "cycles/smp", "mean", "ns/smp", "p99 block",
+		       "worst", "regs/blk", "checksum");
+
+		for (uint32_t s = 0; s < BENCH_STAGES; s++) {
+			const Bench_StageRun_t *st = &best->Stage[s];
+			uint64_t    blocks  = (best->Blocks != 0U) ? best->Blocks : 1U;
+			uint64_t    cyc100  = UINT64_MAX;
+			uint64_t    regs100 = (st->Registers * 100U) / blocks;
+			const char *why = "";
+
+			for (uint32_t r = 0; r < nruns; r++) {                //Fastest run's median block per stage
+				uint64_t c = (Ticks_At(runs[r].Stage[s].pBlock, runs[r].Blocks, 50U) * 100U) / BENCH_BLOCK;
+
+				cyc100 = (c < cyc100) ? c : cyc100;
+			}
+			if ((pBase != NULL) &&
+			    !Baseline_Check(pBase, wave->pName, stage_names[s], cyc100, regs100, st->Checksum, tolerance, &why)) {
+				failed = true;
+			}
+			if (pOut != NULL) {
+				fprintf(pOut, "%s %s %llu %llu %08lx\n", wave->pName, stage_names[s], (unsigned long long)cyc100,
+				        (unsigned long long)regs100, (unsigned long)st->Checksum);
+			}
+
+			printf("  %-8s %8llu.%02u %8.2f %8.2f %10llu %10llu %9.2f  %08lx%s%s\n", stage_names[s],
+			       (unsigned long long)(cyc100 / 100U), (unsigned)(cyc100 % 100U),
+			       (double)st->Ticks / (double)((best->Samples != 0U) ? best->Samples : 1U),
+			       (double)cyc100 / 100.0 / ticks_per_ns, (unsigned long long)Ticks_At(st->pBlock, best->Blocks, 99U),
+			       (unsigned long long)Ticks_At(st->pBlock, best->Blocks, 100U), (double)regs100 / 100.0,
+			       (unsigned long)st->Checksum, (*why != '\0') ? " " : "", why);
+		}
+
+		printf("  latency  : handoff..pack per block, median %llu, p99 %llu, worst %llu ticks (%.2f us of %.0f us)\n",
+		       (unsigned long long)Ticks_At(best->pLatency, best->Blocks, 50U),
+		       (unsigned long long)Ticks_At(best->pLatency, best->Blocks, 99U),
+		       (unsigned long long)Ticks_At(best->pLatency, best->Blocks, 100U),
+		       (double)Ticks_At(best->pLatency, best->Blocks, 100U) / ticks_per_ns * 1e-3,
+		       BENCH_BLOCK * 1e6 / ADC_PLAN_SPS);
+
+		for (uint32_t r = 0; r < nruns; r++) {
+			Bench_FreeRun(&runs[r]);
+		}
+		free(wave->pCodes);
+	}
+
+	if (pOut != NULL) {
+		fclose(pOut);
+		printf("\nbaseline       : %s written\n", pSave);
+	}
+	if (pBase != NULL) {
+		fclose(pBase);
+		printf("\nbaseline       : %s, tolerance %u %%: %s\n", pCheck, (unsigned)tolerance,
+		       failed ? "REGRESSION" : "ok");
+	}
+
+	return failed ? 1 : 0;
+}
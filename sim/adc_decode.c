@@ -0,0 +1,125 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_decode.c                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Tool - ADC Capture Decoder                                 ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Rebuilds the sample stream from a raw USART capture of ADC_Export frames (a serial terminal log or       *
+ * the adc_export.bin written by adc_sim) with the device's own src/adc_pack.c.                             *
+ *                                                                                                          *
+ * Usage:                                                                                                   *
+ *   ./adc_decode capture.bin [samples.csv]                                                                 *
+ *   samples.csv gets "index,code" per sample; an index jump is a gap (samples dropped on the device).      *
+ *                                                                                                          *
+ * Checks:                                                                                                  *
+ *   - CRC of every frame (bad frames are skipped byte by byte until the next valid sync), sequence         *
+ *     continuity (lost frames), first-sample continuity (device-side drops), truncated last frame.         *
+ *                                                                                                          *
+ * Exit status:                                                                                             *
+ *   - 0 when every frame decoded and no frame is missing, 1 otherwise.                                     *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DECODE_SAMPLES_MAX                   UINT16_MAX  // Count is a 16-bit field
+
+int main(int argc, char **argv) {
+	static uint16_t out[DECODE_SAMPLES_MAX];
+	FILE           *pIn, *pCsv = NULL;
+	uint8_t        *pData;
+	long            size;
+	size_t          pos = 0;
+	ADC_FrameInfo_t info;
+	uint32_t        frames = 0, bad = 0, lost_frames = 0, gaps = 0;
+	uint64_t        samples = 0, dropped = 0, lost = 0, next_index = 0;
+	uint32_t        expect = 0;
+	bool            first = true;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s capture.bin [samples.csv]\n", argv[0]);
+		return 2;
+	}
+
+	pIn = fopen(argv[1], "rb");
+	if ((pIn == NULL) || (fseek(pIn, 0, SEEK_END) != 0) || ((size = ftell(pIn)) < 0)) {
+		perror(argv[1]);
+		return 2;
+	}
+	rewind(pIn);
+	pData = malloc((size_t)size + 1U);
+	if ((pData == NULL) || (fread(pData, 1U, (size_t)size, pIn) != (size_t)size)) {
+		perror(argv[1]);
+		return 2;
+	}
+	fclose(pIn);
+
+	if ((argc > 2) && ((pCsv = fopen(argv[2], "w")) == NULL)) {
+		perror(argv[2]);
+		return 2;
+	}
+
+	while (pos < (size_t)size) {
+		ADC_UnpackStatus_t status = ADC_Unpack_Frame(&pData[pos], (uint32_t)((size_t)size - pos), &info,
+		                                             out, DECODE_SAMPLES_MAX);
+
+		if (status == ADC_UNPACK_SHORT) {
+			fprintf(stderr, "truncated frame at byte %lu\n", (unsigned long)pos);
+			bad++;
+			break;
+		}
+		if (status != ADC_UNPACK_OK) {
+			if (status != ADC_UNPACK_NO_SYNC) {
+				fprintf(stderr, "bad frame at byte %lu (status %d)\n", (unsigned long)pos, (int)status);
+				bad++;
+			}
+			pos++;
+			continue;
+		}
+
+		if (!first && (info.Sequence != (uint16_t)expect)) {
+			lost_frames += (uint16_t)(info.Sequence - expect);
+			lost        += (uint32_t)(info.FirstSample - (uint32_t)next_index);  //Went down with the frames
+		} else if (!first && (info.FirstSample != (uint32_t)next_index)) {
+			gaps++;
+			dropped += (uint32_t)(info.FirstSample - (uint32_t)next_index);
+		}
+		expect     = info.Sequence + 1U;
+		next_index = (uint64_t)info.FirstSample + info.Count;
+		first      = false;
+
+		if (pCsv != NULL) {
+			for (uint32_t i = 0; i < info.Count; i++) {
+				fprintf(pCsv, "%lu,%u\n", (unsigned long)(info.FirstSample + i), out[i]);
+			}
+		}
+		samples += info.Count;
+		frames++;
+		pos += info.FrameBytes;
+	}
+
+	printf("frames         : %lu (%lu bad, %lu lost in transit with %llu samples)\n", (unsigned long)frames,
+	       (unsigned long)bad, (unsigned long)lost_frames, (unsigned long long)lost);
+	printf("samples        : %llu decoded, %llu dropped on the device in %lu gaps\n",
+	       (unsigned long long)samples, (unsigned long long)dropped, (unsigned long)gaps);
+	if (samples != 0U) {
+		printf("link cost      : %.2f bits/sample\n", (double)size * 8.0 / (double)samples);
+	}
+
+	if (pCsv != NULL) {
+		fclose(pCsv);
+	}
+	free(pData);
+
+	return ((bad != 0U) || (lost_frames != 0U)) ? 1 : 0;
+}
@@ -0,0 +1,238 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_hpp_check.cpp                    ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: March 5, 2026                        ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - C++ Driver Register Check                      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Builds inc/adc.hpp against the register model and runs a few adc::Driver instantiations through          *
+ * Attach(), Configure() and Start() next to the C calls they stand for.                                    *
+ *                                                                                                          *
+ * Checks, per driver:                                                                                      *
+ *   - CFGR1, CFGR2, SMPR, CHSELR and CCR.PRESC match ADC1_ConfigResolution() + ADC1_ConfigScan(), scan     *
+ *     order and result bits match, VREFEN / TSEN follow the channel set.                                   *
+ *   - A watchdog armed with ADC_AWD_Config() before Configure() keeps its CFGR1 fields and still fires.    *
+ *   - Start(): DMA CCR equals DmaCcr(), half/full buffer interrupts arrive, every scan position holds      *
+ *     its input within 8 codes, and the model reports no rule violation.                                   *
+ *                                                                                                          *
+ * Exit status:                                                                                             *
+ *   - 0 when every driver matches, 1 otherwise.                                                            *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+extern "C" {
+#include "sim.h"
+#include "adc_awd.h"
+}
+#include "adc.hpp"
+#include <stdio.h>
+#include <math.h>
+
+#define CHECK_SUPPLY_V                       3.3
+#define CHECK_RUN_NS                         20000000ULL // 20 ms of streaming per driver
+#define CHECK_TOLERANCE                      8.0         // Codes at the converter resolution
+
+/*
+ * Rising bitmask scan with VREFINT, sequencer scan at 8 bits into bytes, backward scan left aligned
+ */
+using Rise = adc::Driver<adc::Adc1, adc::Channels<0, 13>, ADC_RES_12BIT, ADC_SMP_39_5, 1>;
+using Seq  = adc::Driver<adc::Adc1, adc::Channels<13, 0, 1>, ADC_RES_8BIT, ADC_SMP_79_5, 4>;
+using Back = adc::Driver<adc::Adc1, adc::Channels<5, 1>, ADC_RES_12BIT, ADC_SMP_19_5, 2, DMA_PRIORITY_HIGH,
+                         ADC_ALIGN_LEFT>;
+
+static uint16_t rise_buffer[32];                                  //Globals: CMAR must stay below 4 GB
+static uint8_t  seq_buffer[48];
+static uint16_t back_buffer[32];
+
+static const double input_v[ADC_MAX_CHANNEL + 1U] = { 1.000, 2.000, 0.0, 0.0, 0.0, 0.500 };  //DC per channel
+
+static volatile uint32_t halves;
+static volatile uint32_t awd_events;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INTERRUPT HANDLERS                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+extern "C" void ADC1_IRQHandler(void) {
+	ADC_AWD_IRQHandler();
+}
+
+static void Check_DmaHandler(uint32_t Channel, uint32_t Flags, void *pCtx) {
+	(void)pCtx;
+
+	DMA1_ClearFlags(Channel, Flags & (DMA_FLAG_HT | DMA_FLAG_TC));
+	halves++;
+}
+
+static void Check_Window(ADC_AWD_t Watchdog, ADC_AWD_Event_t Event, uint16_t Value) {
+	(void)Watchdog;
+	(void)Event;
+	(void)Value;
+
+	awd_events++;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CHECKS                                                         */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Expected()
+ * Purpose  : Result word of one channel at the driver's format
+ * Details  : VREFINT from VREFINT_CAL (3.0 V), inputs from
+ *            input_v, left alignment shifts into ResultBits
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static double Expected(uint8_t Channel, uint32_t ResolutionBits, uint32_t ResultBits, bool Left) {
+	const double full = (double)((1UL << ResolutionBits) - 1U);
+	double       code;
+
+	if (Channel == ADC_VREF_CHANNEL_VREFINT) {
+		code = 3.0 / CHECK_SUPPLY_V * (double)*VREFINT_CAL_ADDR * full / 4095.0;
+	} else {
+		code = input_v[Channel] / CHECK_SUPPLY_V * full;
+	}
+	return Left ? code * (double)(1UL << (ResultBits - ResolutionBits)) : code;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Driver_Check()
+ * Purpose  : One adc::Driver against the equivalent C calls
+ * Details  : C path first, register snapshot, AWD1 on the first
+ *            external channel, then Configure() and Start().
+ *            Returns false on any mismatch.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+template <class D, class Set, typename T, size_t Length>
+static bool Driver_Check(const char *pName, const ADC_ScanConfig_t &Scan, ADC_Resolution_t Res, ADC_Align_t Align,
+                         T (&pBuffer)[Length], uint32_t DmaChannel) {
+	const uint32_t   awd_mask = D::Cfgr1Keep;
+	const uint32_t   c_mask   = ~(uint32_t)(awd_mask | ADC_CFGR1_DMAEN | ADC_CFGR1_DMACFG);  //DMA bits come with the start
+	const uint32_t   vref     = ADC_CCR_VREFEN | ADC_CCR_TSEN;
+	uint8_t          c_order[ADC_SCAN_MAX_CHANNELS], order[ADC_SCAN_MAX_CHANNELS];
+	uint32_t         c_cfgr1, c_cfgr2, c_smpr, c_chselr, c_ccr, c_length, c_bits, awd_cfgr1;
+	uint32_t         cfgr1, cfgr2, smpr, chselr, ccr, length;
+	ADC_AWD_Config_t awd = { 0U, 0U, 100U, 16U, Check_Window };  //Every input is above 100 codes
+	double           worst = 0.0;
+	SIM_Stats_t      sim;
+	bool             regs, data, ok;
+
+	/*
+	 * Reference: the C driver
+	 */
+	ADC1_Stop();
+	ok = ADC1_ConfigResolution(Res, Align) && ADC1_ConfigScan(&Scan);
+	c_cfgr1  = READ_REG(ADC1->CFGR1);
+	c_cfgr2  = READ_REG(ADC1->CFGR2);
+	c_smpr   = READ_REG(ADC1->SMPR);
+	c_chselr = READ_REG(ADC1->CHSELR);
+	c_ccr    = READ_REG(ADC->CCR);
+	c_length = ADC_Scan_GetOrder(c_order);
+	c_bits   = ADC1_GetResultBits();
+
+	for (uint32_t i = 0; i < Set::Count; i++) {
+		if (Set::Order[i] != ADC_VREF_CHANNEL_VREFINT) {
+			awd.Channels = 1UL << Set::Order[i];
+			break;
+		}
+	}
+	ok = ok && ADC_AWD_Config(ADC_AWD1, &awd);
+	awd_cfgr1 = READ_REG(ADC1->CFGR1) & awd_mask;
+
+	/*
+	 * Same configuration from the folded images
+	 */
+	ok = ok && D::Attach(1U, Check_DmaHandler);
+	D::Configure();
+	cfgr1  = READ_REG(ADC1->CFGR1);
+	cfgr2  = READ_REG(ADC1->CFGR2);
+	smpr   = READ_REG(ADC1->SMPR);
+	chselr = READ_REG(ADC1->CHSELR);
+	ccr    = READ_REG(ADC->CCR);
+	length = ADC_Scan_GetOrder(order);
+
+	regs = ((cfgr1 & c_mask) == (c_cfgr1 & c_mask)) && ((cfgr1 & awd_mask) == awd_cfgr1) && (awd_cfgr1 != 0U) &&
+	       (cfgr2 == c_cfgr2) && (smpr == c_smpr) && (chselr == c_chselr) &&
+	       ((ccr & ADC_CCR_PRESC) == (c_ccr & ADC_CCR_PRESC)) && ((ccr & vref) == (D::Ccr & vref)) &&
+	       (length == c_length) && (ADC1_GetResultBits() == c_bits) && (c_bits == D::ResultBits);
+	for (uint32_t i = 0; regs && (i < length); i++) {
+		regs = (order[i] == c_order[i]);
+	}
+	printf("%-5s: CFGR1 %08lx (C %08lx), SMPR %08lx (C %08lx), CHSELR %08lx (C %08lx), AWD1 %08lx kept: %s\n",
+	       pName, (unsigned long)cfgr1, (unsigned long)c_cfgr1, (unsigned long)smpr, (unsigned long)c_smpr,
+	       (unsigned long)chselr, (unsigned long)c_chselr, (unsigned long)awd_cfgr1, regs ? "ok" : "FAIL");
+
+	/*
+	 * Stream from the image and look at the data
+	 */
+	halves     = 0;
+	awd_events = 0;
+	D::Start(pBuffer);
+	SIM_Run(CHECK_RUN_NS);
+	ADC1_Stop();
+	CLEAR_BIT(DMA1_GetChannel(DmaChannel)->CCR, DMA_CCR_EN);
+	ADC_AWD_Disable(ADC_AWD1);
+
+	for (uint32_t i = 0; i < Length; i++) {
+		double expect = Expected(Set::Order[i % Set::Count], D::ResolutionBits, D::ResultBits, Align == ADC_ALIGN_LEFT);
+		double error  = fabs((double)pBuffer[i] - expect) / (double)(1UL << (D::ResultBits - D::ResolutionBits));
+
+		worst = (error > worst) ? error : worst;
+	}
+	SIM_GetStats(&sim);
+	data = (sim_dma1_ch[DmaChannel - 1U].CCR == (D::DmaCcr(8U * sizeof(T)))) && (halves >= 2U) &&
+	       (awd_events >= 1U) && (worst <= CHECK_TOLERANCE) && (sim.Violations == 0U);
+	printf("       %lu-bit results, %lu halves, %lu AWD1 events, worst %.1f codes off, %u violations: %s\n",
+	       (unsigned long)D::ResultBits, (unsigned long)halves, (unsigned long)awd_events, worst,
+	       (unsigned)sim.Violations, data ? "ok" : "FAIL");
+
+	return ok && regs && data;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MAIN                                                           */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+int main(void) {
+	const ADC_ScanConfig_t rise = { ADC_SCAN_BITMASK, false, 2U, { 0U, 13U }, { ADC_SMP_39_5, ADC_SMP_39_5 } };
+	const ADC_ScanConfig_t seq  = { ADC_SCAN_SEQUENCE, false, 3U, { 13U, 0U, 1U },
+	                                { ADC_SMP_79_5, ADC_SMP_79_5, ADC_SMP_79_5 } };
+	const ADC_ScanConfig_t back = { ADC_SCAN_BITMASK, true, 2U, { 5U, 1U }, { ADC_SMP_19_5, ADC_SMP_19_5 } };
+	bool                   ok;
+
+	SIM_Reset(NULL);
+	HAL_Init();
+	SIM_SetSupply(CHECK_SUPPLY_V);
+	for (uint32_t ch = 0; ch <= 5U; ch++) {
+		const SIM_Wave_t dc = { SIM_WAVE_DC, input_v[ch], 0.0, 0.0, 0.0 };
+		SIM_SetWave(ch, &dc);
+	}
+
+	ADC1_InitAsync(0);
+	DMA1_Init();
+	while (ADC1_InitPoll() < ADC_INIT_READY) {
+		/*
+		 * ⏳...
+		 */
+	}
+	if (ADC1_InitPoll() == ADC_INIT_ERROR) {
+		printf("ADC calibration could not start\n");
+		return 1;
+	}
+
+	ok = Driver_Check<Rise, adc::Channels<0, 13>>("Rise", rise, ADC_RES_12BIT, ADC_ALIGN_RIGHT, rise_buffer, 1U);
+	ok = Driver_Check<Seq, adc::Channels<13, 0, 1>>("Seq", seq, ADC_RES_8BIT, ADC_ALIGN_RIGHT, seq_buffer, 4U) && ok;
+	ok = Driver_Check<Back, adc::Channels<5, 1>>("Back", back, ADC_RES_12BIT, ADC_ALIGN_LEFT, back_buffer, 2U) && ok;
+
+	return ok ? 0 : 1;
+}
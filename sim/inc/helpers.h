@@ -0,0 +1,20 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: helpers.h (sim)                      ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Helper Replacement                             ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef SIM_INC_HELPERS_H_
+#define SIM_INC_HELPERS_H_
+
+#include <stdint.h>
+
+void TimeOut(uint32_t ms);                                        //Advances simulated time
+
+#endif /* SIM_INC_HELPERS_H_ */
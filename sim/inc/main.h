@@ -0,0 +1,20 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: main.h (sim)                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Application Header Replacement                 ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef SIM_INC_MAIN_H_
+#define SIM_INC_MAIN_H_
+
+#include "stm32g0xx_hal.h"
+
+void Error_Handler(void);
+
+#endif /* SIM_INC_MAIN_H_ */
@@ -0,0 +1,186 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim.h                                ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - ADC1 / DMA1 / DMAMUX / TIM3 Peripheral Model   ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This header file provides the control API of the host-side register-level simulator. The unmodified      *
+ * driver sources are compiled against sim/inc and run on Linux, with the peripheral registers backed       *
+ * by a discrete-event model running on simulated time.                                                     *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Time base: SIM_Run(), SIM_GetTimeNs().                                                               *
+ *   - Analog inputs: pluggable waveform per channel (DC, sine, square, ramp, noise, user callback).        *
+ *   - Supply and die temperature: SIM_SetSupply() moves VREF+ under the converter (VREFINT stays),         *
+ *     SIM_SetTemperature() moves the sensor output; factory VREFINT_CAL / TS_CAL1 words to match.          *
+ *   - USART2 TX sink: the bytes a host on the other end of the link would receive.                         *
+ *   - GPIO edges on EXTI lines: SIM_EXTI_Edge().                                                           *
+ *   - Model parameters (offset error corrected by calibration, warm / cold start).                         *
+ *   - Counters for conversions, DMA transfers, overruns and dispatched interrupts.                         *
+ *                                                                                                          *
+ * Modelled behaviour:                                                                                      *
+ *   - ADC: ADVREGEN, ADCAL -> EOCAL + CALFACT, ADEN -> ADRDY, ADSTART/ADSTP, CONT/single, software or      *
+ *     TIM3 TRGO trigger, bitmask and sequence scan, SMP1/SMP2, RES, ALIGN, oversampling, EOC/EOS,          *
+ *     OVR (OVRMOD), AWD1..3, CCRDY, VREFINT / TSENSE switched by CCR.VREFEN / TSEN (0 V when off).         *
+ *   - DMA: DMAMUX request routing, PSIZE/MSIZE, MINC, CIRC reload, HT/TC/TE flags, IFCR.                   *
+ *   - USART2: TX shift timing from BRR, TXE/TC, DMA transmit requests, bytes out to a host sink.           *
+ *   - EXTI: RTSR1/FTSR1 edge select, RPR1/FPR1 (write 1 to clear), SWIER1, IMR1, three NVIC lines.         *
+ *   - NVIC: enable, priority, PRIMASK, level-triggered lines, preemption by higher priority only.          *
+ *   - SysTick: VAL/COUNTFLAG derived from simulated time.                                                  *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - The CPU itself is not timed: each peripheral register access costs SIM_ACCESS_NS, everything else    *
+ *     between accesses is free. Host wall-clock time is the measure of software cost.                     *
+ *   - Interrupt handlers are called synchronously from inside register accesses and SIM_Run(), exactly    *
+ *     where an interrupt could preempt on the target.                                                      *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef SIM_INC_SIM_H_
+#define SIM_INC_SIM_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "stm32g030xx.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DEFINES                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#ifndef SIM_SYSCLK_HZ
+#define SIM_SYSCLK_HZ                        16000000U  // HSI16, matches SystemClock_Config()
+#endif
+#ifndef SIM_ACCESS_NS
+#define SIM_ACCESS_NS                        125U       // Simulated cost of one register access (2 cycles)
+#endif
+
+#define SIM_ADC_CHANNELS                     19U        // CHSEL0..CHSEL18
+#define SIM_ADC_VREF_V                       3.3        // VREF+ (= VDDA) after reset, see SIM_SetSupply()
+#define SIM_ADC_CH_TSENSE                    12U        // Temperature sensor, needs CCR.TSEN
+#define SIM_ADC_CH_VREFINT                   13U        // Internal reference, needs CCR.VREFEN
+#define SIM_VREFINT_V                        1.212      // VREFINT output
+#define SIM_TS_V30                           0.760      // Sensor output at 30 degC
+#define SIM_TS_SLOPE_V                       0.0025     // Sensor slope per degC
+#define SIM_VREFINT_CAL                      1654U      // VREFINT at 3.0 V: 1.212 / 3.0 * 4095
+#define SIM_TS_CAL1                          1037U      // Sensor at 30 degC, 3.0 V: 0.760 / 3.0 * 4095
+#define SIM_ADC_TSTAB_NS                     2000U      // ADEN -> ADRDY
+#define SIM_ADC_TCAL_CYCLES                  82U        // ADCAL duration in ADC clock cycles
+#define SIM_DMAMUX_REQ_ADC                   5U         // DMAREQ_ID of ADC1
+#define SIM_DMAMUX_REQ_USART2_TX             53U        // DMAREQ_ID of USART2_TX
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TYPES                                                          */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * Input voltage (V) of one channel at simulated time TimeNs
+ */
+typedef double (*SIM_WaveFn_t)(uint32_t Channel, uint64_t TimeNs, void *pCtx);
+
+/*
+ * Receives every byte USART2 shifts out on TX (the far end of the link)
+ */
+typedef void (*SIM_UsartSink_t)(uint8_t Byte, void *pCtx);
+
+typedef enum {
+	SIM_WAVE_DC     = 0,
+	SIM_WAVE_SINE   = 1,
+	SIM_WAVE_SQUARE = 2,
+	SIM_WAVE_RAMP   = 3                                           //Sawtooth, Offset -> Offset + Amplitude
+} SIM_WaveKind_t;
+
+typedef struct {
+	SIM_WaveKind_t Kind;
+	double         Offset_V;
+	double         Amplitude_V;
+	double         Freq_Hz;
+	double         Noise_V;                                       //Gaussian, RMS, added to any kind
+} SIM_Wave_t;
+
+typedef struct {
+	uint32_t       OffsetLsb;                                     //Converter offset (0..127), removed by CALFACT
+	uint32_t       Seed;                                          //Noise generator seed
+	bool           ColdStart;                                     //false: TAMP backup registers survive (warm boot)
+} SIM_Params_t;
+
+typedef struct {
+	uint64_t       Conversions;                                   //Results written to ADC_DR
+	uint64_t       Sequences;                                     //EOS events
+	uint64_t       Triggers;                                      //TIM3 TRGO edges seen by the ADC
+	uint64_t       MissedTriggers;                                //Triggers while a scan was running
+	uint64_t       Overruns;                                      //OVR events
+	uint64_t       DmaTransfers;
+	uint64_t       DmaErrors;
+	uint64_t       UsartBytes;                                    //Frames shifted out on USART2 TX
+	uint64_t       Irqs[SIM_IRQ_COUNT];                           //Handler invocations per IRQn
+	uint64_t       RegisterAccesses;
+	uint32_t       Violations;                                    //Writes the reference manual forbids
+} SIM_Stats_t;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONTROL                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void     SIM_Reset(const SIM_Params_t *pParams);
+void     SIM_Run(uint64_t DurationNs);
+uint64_t SIM_GetTimeNs(void);
+void     SIM_GetStats(SIM_Stats_t *pStats);
+
+void     SIM_SetWave(uint32_t Channel, const SIM_Wave_t *pWave);
+void     SIM_SetWaveform(uint32_t Channel, SIM_WaveFn_t Fn, void *pCtx);
+double   SIM_GetInput(uint32_t Channel, uint64_t TimeNs);
+void     SIM_SetSupply(double Vdda_V);
+double   SIM_GetSupply(void);
+void     SIM_SetTemperature(double DegC);
+void     SIM_USART_SetSink(SIM_UsartSink_t Sink, void *pCtx);
+void     SIM_EXTI_Edge(uint32_t Line, bool Rising);
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           MODEL INTERNALS                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+extern SIM_Stats_t sim_stats;
+
+void     SIM_Violation(const char *pWhat);
+
+void     SIM_ADC_Reset(const SIM_Params_t *pParams);
+void     SIM_ADC_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value);
+uint32_t SIM_ADC_Read(volatile const uint32_t *pReg);
+uint64_t SIM_ADC_NextEvent(void);
+void     SIM_ADC_Event(uint64_t Now);
+void     SIM_ADC_Trigger(uint64_t Now);
+bool     SIM_ADC_IrqLine(void);
+
+void     SIM_DMA_Reset(void);
+void     SIM_DMA_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value);
+bool     SIM_DMA_Request(uint32_t RequestId, uint32_t Data);
+bool     SIM_DMA_Fetch(uint32_t RequestId, uint32_t *pData);
+bool     SIM_DMA_IrqLine(uint32_t Channel);
+
+void     SIM_TIM_Reset(void);
+void     SIM_TIM_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value);
+uint64_t SIM_TIM_NextEvent(void);
+void     SIM_TIM_Event(uint64_t Now);
+bool     SIM_TIM_IrqLine(void);
+
+void     SIM_USART_Reset(void);
+void     SIM_USART_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value);
+void     SIM_USART_DmaChanged(void);
+uint64_t SIM_USART_NextEvent(void);
+void     SIM_USART_Event(uint64_t Now);
+bool     SIM_USART_IrqLine(void);
+
+void     SIM_Wave_Reset(uint32_t Seed);
+
+#endif /* SIM_INC_SIM_H_ */
@@ -0,0 +1,568 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: stm32g030xx.h (sim)                  ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Device Header Replacement                      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Drop-in replacement for the CMSIS device header when the driver is built on the host. Only the           *
+ * peripherals and bit fields used by the driver are declared.                                              *
+ *                                                                                                          *
+ * Contents:                                                                                                *
+ *   - Register layouts (ADC, DMA, DMAMUX, RCC, TIM, USART, GPIO, EXTI, SysTick, SCB, PWR, TAMP).           *
+ *   - Peripheral macros (ADC1, DMA1_Channel1, ...) that resolve to the simulated register files.           *
+ *   - Register access macros (SET_BIT, WRITE_REG, ...) routed through the peripheral models.               *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Every ADC1->X / DMA1->X access goes through SIM_Periph(), which charges SIM_ACCESS_NS of             *
+ *     simulated time. Busy-wait loops on status flags therefore make progress.                             *
+ *   - Side effects (write-1-to-clear, ADEN -> ADRDY, DR read -> EOC clear) need the CMSIS macros:          *
+ *     a plain "REG = x" only stores the value.                                                             *
+ *   - The 32-bit CMAR/CPAR hold host addresses: link with -no-pie so globals sit below 4 GB.               *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+#ifndef SIM_INC_STM32G030XX_H_
+#define SIM_INC_STM32G030XX_H_
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO    volatile
+#define __I     volatile const
+#define __O     volatile
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT NUMBERS                                              */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	SysTick_IRQn                = -1,
+	EXTI0_1_IRQn                = 5,
+	EXTI2_3_IRQn                = 6,
+	EXTI4_15_IRQn               = 7,
+	DMA1_Channel1_IRQn          = 9,
+	DMA1_Channel2_3_IRQn        = 10,
+	DMA1_Ch4_5_DMAMUX1_OVR_IRQn = 11,
+	ADC1_IRQn                   = 12,
+	TIM3_IRQn                   = 16,
+	USART2_IRQn                 = 28
+} IRQn_Type;
+
+#define SIM_IRQ_COUNT                        32U
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           REGISTER LAYOUTS                                               */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	__IO uint32_t ISR;          /* 0x00 */
+	__IO uint32_t IER;          /* 0x04 */
+	__IO uint32_t CR;           /* 0x08 */
+	__IO uint32_t CFGR1;        /* 0x0C */
+	__IO uint32_t CFGR2;        /* 0x10 */
+	__IO uint32_t SMPR;         /* 0x14 */
+	     uint32_t RESERVED1[2];
+	__IO uint32_t AWD1TR;       /* 0x20 */
+	__IO uint32_t AWD2TR;       /* 0x24 */
+	__IO uint32_t CHSELR;       /* 0x28 */
+	__IO uint32_t AWD3TR;       /* 0x2C */
+	     uint32_t RESERVED2[4];
+	__IO uint32_t DR;           /* 0x40 */
+	     uint32_t RESERVED3[23];
+	__IO uint32_t AWD2CR;       /* 0xA0 */
+	__IO uint32_t AWD3CR;       /* 0xA4 */
+	     uint32_t RESERVED4[3];
+	__IO uint32_t CALFACT;      /* 0xB4 */
+} ADC_TypeDef;
+
+typedef struct {
+	__IO uint32_t CCR;          /* 0x308 */
+} ADC_Common_TypeDef;
+
+typedef struct {
+	__IO uint32_t ISR;
+	__IO uint32_t IFCR;
+} DMA_TypeDef;
+
+typedef struct {
+	__IO uint32_t CCR;
+	__IO uint32_t CNDTR;
+	__IO uint32_t CPAR;
+	__IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+	__IO uint32_t CCR;
+} DMAMUX_Channel_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR;
+	__IO uint32_t ICSCR;
+	__IO uint32_t CFGR;
+	__IO uint32_t PLLCFGR;
+	     uint32_t RESERVED0;
+	__IO uint32_t CRRCR;
+	__IO uint32_t CIER;
+	__IO uint32_t CIFR;
+	__IO uint32_t CICR;
+	__IO uint32_t IOPRSTR;
+	__IO uint32_t AHBRSTR;
+	__IO uint32_t APBRSTR1;
+	__IO uint32_t APBRSTR2;
+	__IO uint32_t IOPENR;
+	__IO uint32_t AHBENR;
+	__IO uint32_t APBENR1;
+	__IO uint32_t APBENR2;
+} RCC_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t SMCR;
+	__IO uint32_t DIER;
+	__IO uint32_t SR;
+	__IO uint32_t EGR;
+	__IO uint32_t CCMR1;
+	__IO uint32_t CCMR2;
+	__IO uint32_t CCER;
+	__IO uint32_t CNT;
+	__IO uint32_t PSC;
+	__IO uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct {
+	__IO uint32_t CTRL;
+	__IO uint32_t LOAD;
+	__IO uint32_t VAL;
+	__I  uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+	__I  uint32_t CPUID;
+	__IO uint32_t ICSR;
+	__IO uint32_t VTOR;
+	__IO uint32_t AIRCR;
+	__IO uint32_t SCR;
+	__I  uint32_t CCR;
+} SCB_Type;
+
+typedef struct {
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t CR3;
+	__IO uint32_t CR4;
+	__IO uint32_t SR1;
+	__IO uint32_t SR2;
+	__IO uint32_t SCR;
+} PWR_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	     uint32_t RESERVED[62];
+	__IO uint32_t BKP0R;
+	__IO uint32_t BKP1R;
+	__IO uint32_t BKP2R;
+	__IO uint32_t BKP3R;
+	__IO uint32_t BKP4R;
+} TAMP_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t CR3;
+	__IO uint32_t BRR;
+	__IO uint32_t GTPR;
+	__IO uint32_t RTOR;
+	__IO uint32_t RQR;
+	__IO uint32_t ISR;
+	__IO uint32_t ICR;
+	__IO uint32_t RDR;
+	__IO uint32_t TDR;
+	__IO uint32_t PRESC;
+} USART_TypeDef;
+
+typedef struct {
+	__IO uint32_t MODER;
+	__IO uint32_t OTYPER;
+	__IO uint32_t OSPEEDR;
+	__IO uint32_t PUPDR;
+	__IO uint32_t IDR;
+	__IO uint32_t ODR;
+	__IO uint32_t BSRR;
+	__IO uint32_t LCKR;
+	__IO uint32_t AFR[2];
+	__IO uint32_t BRR;
+} GPIO_TypeDef;
+
+typedef struct {
+	__IO uint32_t RTSR1;        /* 0x00 */
+	__IO uint32_t FTSR1;        /* 0x04 */
+	__IO uint32_t SWIER1;       /* 0x08 */
+	__IO uint32_t RPR1;         /* 0x0C */
+	__IO uint32_t FPR1;         /* 0x10 */
+	     uint32_t RESERVED1[19];
+	__IO uint32_t EXTICR[4];    /* 0x60 */
+	     uint32_t RESERVED2[4];
+	__IO uint32_t IMR1;         /* 0x80 */
+	__IO uint32_t EMR1;         /* 0x84 */
+} EXTI_TypeDef;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           SIMULATED REGISTER FILES                                       */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+extern ADC_TypeDef             sim_adc1;
+extern ADC_Common_TypeDef      sim_adc_common;
+extern DMA_TypeDef             sim_dma1;
+extern DMA_Channel_TypeDef     sim_dma1_ch[5];
+extern DMAMUX_Channel_TypeDef  sim_dmamux1_ch[5];
+extern RCC_TypeDef             sim_rcc;
+extern TIM_TypeDef             sim_tim3;
+extern SysTick_Type            sim_systick;
+extern SCB_Type                sim_scb;
+extern PWR_TypeDef             sim_pwr;
+extern TAMP_TypeDef            sim_tamp;
+extern USART_TypeDef           sim_usart2;
+extern GPIO_TypeDef            sim_gpioa;
+extern EXTI_TypeDef            sim_exti;
+
+void    *SIM_Periph(volatile void *pRegs);
+uint32_t SIM_ReadReg(volatile const uint32_t *pReg);
+void     SIM_WriteReg(volatile uint32_t *pReg, uint32_t Value);
+
+#define ADC1                ((ADC_TypeDef *)SIM_Periph(&sim_adc1))
+#define ADC                 ((ADC_Common_TypeDef *)SIM_Periph(&sim_adc_common))
+#define ADC1_COMMON         ADC
+#define ADC1_BASE           ((uint32_t)(uintptr_t)&sim_adc1)
+#define DMA1                ((DMA_TypeDef *)SIM_Periph(&sim_dma1))
+#define DMA1_Channel1       ((DMA_Channel_TypeDef *)SIM_Periph(&sim_dma1_ch[0]))
+#define DMA1_Channel2       ((DMA_Channel_TypeDef *)SIM_Periph(&sim_dma1_ch[1]))
+#define DMA1_Channel3       ((DMA_Channel_TypeDef *)SIM_Periph(&sim_dma1_ch[2]))
+#define DMA1_Channel4       ((DMA_Channel_TypeDef *)SIM_Periph(&sim_dma1_ch[3]))
+#define DMA1_Channel5       ((DMA_Channel_TypeDef *)SIM_Periph(&sim_dma1_ch[4]))
+#define DMAMUX1_Channel0    ((DMAMUX_Channel_TypeDef *)SIM_Periph(&sim_dmamux1_ch[0]))
+#define DMAMUX1_Channel1    ((DMAMUX_Channel_TypeDef *)SIM_Periph(&sim_dmamux1_ch[1]))
+#define DMAMUX1_Channel2    ((DMAMUX_Channel_TypeDef *)SIM_Periph(&sim_dmamux1_ch[2]))
+#define DMAMUX1_Channel3    ((DMAMUX_Channel_TypeDef *)SIM_Periph(&sim_dmamux1_ch[3]))
+#define DMAMUX1_Channel4    ((DMAMUX_Channel_TypeDef *)SIM_Periph(&sim_dmamux1_ch[4]))
+#define RCC                 ((RCC_TypeDef *)SIM_Periph(&sim_rcc))
+#define TIM3                ((TIM_TypeDef *)SIM_Periph(&sim_tim3))
+#define SysTick             ((SysTick_Type *)SIM_Periph(&sim_systick))
+#define SCB                 ((SCB_Type *)SIM_Periph(&sim_scb))
+#define PWR                 ((PWR_TypeDef *)SIM_Periph(&sim_pwr))
+#define TAMP                ((TAMP_TypeDef *)SIM_Periph(&sim_tamp))
+#define USART2              ((USART_TypeDef *)SIM_Periph(&sim_usart2))
+#define GPIOA               ((GPIO_TypeDef *)SIM_Periph(&sim_gpioa))
+#define EXTI                ((EXTI_TypeDef *)SIM_Periph(&sim_exti))
+
+/*
+ * Factory calibration words (system memory on the target), backed by constants of the model
+ */
+extern const uint16_t          sim_vrefint_cal;
+extern const uint16_t          sim_ts_cal1;
+
+#define VREFINT_CAL_ADDR    (&sim_vrefint_cal)
+#define TEMPSENSOR_CAL1_ADDR (&sim_ts_cal1)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           REGISTER ACCESS                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define READ_REG(REG)                        SIM_ReadReg(&(REG))
+#define WRITE_REG(REG, VAL)                  SIM_WriteReg(&(REG), (uint32_t)(VAL))
+#define SET_BIT(REG, BIT)                    WRITE_REG((REG), READ_REG(REG) | (uint32_t)(BIT))
+#define CLEAR_BIT(REG, BIT)                  WRITE_REG((REG), READ_REG(REG) & ~(uint32_t)(BIT))
+#define READ_BIT(REG, BIT)                   (READ_REG(REG) & (uint32_t)(BIT))
+#define CLEAR_REG(REG)                       WRITE_REG((REG), 0x0UL)
+#define MODIFY_REG(REG, CLEARMASK, SETMASK)  WRITE_REG((REG), (READ_REG(REG) & ~(uint32_t)(CLEARMASK)) | (uint32_t)(SETMASK))
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CORE                                                           */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+extern uint32_t SystemCoreClock;
+
+void     SIM_DisableIRQ(void);
+void     SIM_EnableIRQ(void);
+uint32_t SIM_GetPRIMASK(void);
+void     SIM_SetPRIMASK(uint32_t PriMask);
+void     SIM_WaitForInterrupt(void);
+
+#define __disable_irq()                      SIM_DisableIRQ()
+#define __enable_irq()                       SIM_EnableIRQ()
+#define __get_PRIMASK()                      SIM_GetPRIMASK()
+#define __set_PRIMASK(x)                     SIM_SetPRIMASK(x)
+#define __WFI()                              SIM_WaitForInterrupt()
+#define __WFE()                              SIM_WaitForInterrupt()
+#define __DMB()                              __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                              __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()                              __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __NOP()                              ((void)0)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           BIT DEFINITIONS                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*
+ * RCC
+ */
+#define RCC_IOPENR_GPIOAEN                   (1UL << 0)
+#define RCC_AHBENR_DMA1EN                    (1UL << 0)
+#define RCC_APBENR1_TIM3EN                   (1UL << 1)
+#define RCC_APBENR1_RTCAPBEN                 (1UL << 10)
+#define RCC_APBENR1_USART2EN                 (1UL << 17)
+#define RCC_APBENR1_PWREN                    (1UL << 28)
+#define RCC_APBENR2_ADCEN                    (1UL << 20)
+#define RCC_CFGR_PPRE_Pos                    12U
+#define RCC_CFGR_PPRE                        (7UL << 12)
+#define RCC_CFGR_PPRE_0                      (1UL << 12)
+#define RCC_CFGR_PPRE_1                      (2UL << 12)
+#define RCC_CFGR_PPRE_2                      (4UL << 12)
+
+/*
+ * PWR / TAMP
+ */
+#define PWR_CR1_LPMS_Pos                     0U
+#define PWR_CR1_LPMS                         (7UL << 0)
+#define PWR_CR1_LPMS_0                       (1UL << 0)
+#define PWR_CR1_DBP                          (1UL << 8)
+
+/*
+ * ADC_ISR / ADC_IER
+ */
+#define ADC_ISR_ADRDY                        (1UL << 0)
+#define ADC_ISR_EOSMP                        (1UL << 1)
+#define ADC_ISR_EOC                          (1UL << 2)
+#define ADC_ISR_EOS                          (1UL << 3)
+#define ADC_ISR_OVR                          (1UL << 4)
+#define ADC_ISR_AWD1                         (1UL << 7)
+#define ADC_ISR_AWD2                         (1UL << 8)
+#define ADC_ISR_AWD3                         (1UL << 9)
+#define ADC_ISR_EOCAL                        (1UL << 11)
+#define ADC_ISR_CCRDY                        (1UL << 13)
+
+#define ADC_IER_ADRDYIE                      (1UL << 0)
+#define ADC_IER_EOSMPIE                      (1UL << 1)
+#define ADC_IER_EOCIE                        (1UL << 2)
+#define ADC_IER_EOSIE                        (1UL << 3)
+#define ADC_IER_OVRIE                        (1UL << 4)
+#define ADC_IER_AWD1IE                       (1UL << 7)
+#define ADC_IER_AWD2IE                       (1UL << 8)
+#define ADC_IER_AWD3IE                       (1UL << 9)
+#define ADC_IER_EOCALIE                      (1UL << 11)
+#define ADC_IER_CCRDYIE                      (1UL << 13)
+
+/*
+ * ADC_CR
+ */
+#define ADC_CR_ADEN                          (1UL << 0)
+#define ADC_CR_ADDIS                         (1UL << 1)
+#define ADC_CR_ADSTART                       (1UL << 2)
+#define ADC_CR_ADSTP                         (1UL << 4)
+#define ADC_CR_ADVREGEN                      (1UL << 28)
+#define ADC_CR_ADCAL                         (1UL << 31)
+
+/*
+ * ADC_CFGR1
+ */
+#define ADC_CFGR1_DMAEN                      (1UL << 0)
+#define ADC_CFGR1_DMACFG                     (1UL << 1)
+#define ADC_CFGR1_SCANDIR                    (1UL << 2)
+#define ADC_CFGR1_RES_Pos                    3U
+#define ADC_CFGR1_RES                        (3UL << 3)
+#define ADC_CFGR1_RES_0                      (1UL << 3)
+#define ADC_CFGR1_RES_1                      (2UL << 3)
+#define ADC_CFGR1_ALIGN                      (1UL << 5)
+#define ADC_CFGR1_EXTSEL_Pos                 6U
+#define ADC_CFGR1_EXTSEL                     (7UL << 6)
+#define ADC_CFGR1_EXTSEL_0                   (1UL << 6)
+#define ADC_CFGR1_EXTSEL_1                   (2UL << 6)
+#define ADC_CFGR1_EXTSEL_2                   (4UL << 6)
+#define ADC_CFGR1_EXTEN_Pos                  10U
+#define ADC_CFGR1_EXTEN                      (3UL << 10)
+#define ADC_CFGR1_EXTEN_0                    (1UL << 10)
+#define ADC_CFGR1_EXTEN_1                    (2UL << 10)
+#define ADC_CFGR1_OVRMOD                     (1UL << 12)
+#define ADC_CFGR1_CONT                       (1UL << 13)
+#define ADC_CFGR1_WAIT                       (1UL << 14)
+#define ADC_CFGR1_AUTOFF                     (1UL << 15)
+#define ADC_CFGR1_DISCEN                     (1UL << 16)
+#define ADC_CFGR1_CHSELRMOD                  (1UL << 21)
+#define ADC_CFGR1_AWD1SGL                    (1UL << 22)
+#define ADC_CFGR1_AWD1EN                     (1UL << 23)
+#define ADC_CFGR1_AWD1CH_Pos                 26U
+#define ADC_CFGR1_AWD1CH                     (0x1FUL << 26)
+
+/*
+ * ADC_CFGR2
+ */
+#define ADC_CFGR2_OVSE                       (1UL << 0)
+#define ADC_CFGR2_OVSR_Pos                   2U
+#define ADC_CFGR2_OVSR                       (7UL << 2)
+#define ADC_CFGR2_OVSS_Pos                   5U
+#define ADC_CFGR2_OVSS                       (0xFUL << 5)
+#define ADC_CFGR2_TOVS                       (1UL << 9)
+#define ADC_CFGR2_LFTRIG                     (1UL << 29)
+#define ADC_CFGR2_CKMODE_Pos                 30U
+#define ADC_CFGR2_CKMODE                     (3UL << 30)
+#define ADC_CFGR2_CKMODE_0                   (1UL << 30)
+#define ADC_CFGR2_CKMODE_1                   (2UL << 30)
+
+/*
+ * ADC_SMPR
+ */
+#define ADC_SMPR_SMP1_Pos                    0U
+#define ADC_SMPR_SMP1                        (7UL << 0)
+#define ADC_SMPR_SMP2_Pos                    4U
+#define ADC_SMPR_SMP2                        (7UL << 4)
+#define ADC_SMPR_SMPSEL_Pos                  8U
+#define ADC_SMPR_SMPSEL                      (0x7FFFFUL << 8)
+
+/*
+ * ADC_AWDxTR / ADC_AWDxCR
+ */
+#define ADC_AWD1TR_LT1_Pos                   0U
+#define ADC_AWD1TR_LT1                       (0xFFFUL << 0)
+#define ADC_AWD1TR_HT1_Pos                   16U
+#define ADC_AWD1TR_HT1                       (0xFFFUL << 16)
+#define ADC_AWD2TR_LT2_Pos                   0U
+#define ADC_AWD2TR_LT2                       (0xFFFUL << 0)
+#define ADC_AWD2TR_HT2_Pos                   16U
+#define ADC_AWD2TR_HT2                       (0xFFFUL << 16)
+#define ADC_AWD3TR_LT3_Pos                   0U
+#define ADC_AWD3TR_LT3                       (0xFFFUL << 0)
+#define ADC_AWD3TR_HT3_Pos                   16U
+#define ADC_AWD3TR_HT3                       (0xFFFUL << 16)
+#define ADC_AWD2CR_AWD2CH                    (0x7FFFFUL << 0)
+#define ADC_AWD3CR_AWD3CH                    (0x7FFFFUL << 0)
+
+/*
+ * ADC_CHSELR / ADC_DR / ADC_CALFACT / ADC_CCR
+ */
+#define ADC_CHSELR_CHSEL0                    (1UL << 0)
+#define ADC_CHSELR_CHSEL                     (0x7FFFFUL << 0)
+#define ADC_CHSELR_SQ_ALL                    (0xFFFFFFFFUL)
+#define ADC_DR_DATA                          (0xFFFFUL << 0)
+#define ADC_CALFACT_CALFACT                  (0x7FUL << 0)
+#define ADC_CCR_PRESC_Pos                    18U
+#define ADC_CCR_PRESC                        (0xFUL << 18)
+#define ADC_CCR_VREFEN                       (1UL << 22)
+#define ADC_CCR_TSEN                         (1UL << 23)
+
+/*
+ * DMA_ISR / DMA_IFCR (channel 1, the other channels are at +4 bits each)
+ */
+#define DMA_ISR_GIF1                         (1UL << 0)
+#define DMA_ISR_TCIF1                        (1UL << 1)
+#define DMA_ISR_HTIF1                        (1UL << 2)
+#define DMA_ISR_TEIF1                        (1UL << 3)
+#define DMA_IFCR_CGIF1                       (1UL << 0)
+#define DMA_IFCR_CTCIF1                      (1UL << 1)
+#define DMA_IFCR_CHTIF1                      (1UL << 2)
+#define DMA_IFCR_CTEIF1                      (1UL << 3)
+#define DMA_ISR_GIF2                         (1UL << 4)
+#define DMA_ISR_TCIF2                        (1UL << 5)
+#define DMA_ISR_HTIF2                        (1UL << 6)
+#define DMA_ISR_TEIF2                        (1UL << 7)
+#define DMA_IFCR_CGIF2                       (1UL << 4)
+#define DMA_IFCR_CTCIF2                      (1UL << 5)
+#define DMA_IFCR_CHTIF2                      (1UL << 6)
+#define DMA_IFCR_CTEIF2                      (1UL << 7)
+
+/*
+ * DMA_CCRx
+ */
+#define DMA_CCR_EN                           (1UL << 0)
+#define DMA_CCR_TCIE                         (1UL << 1)
+#define DMA_CCR_HTIE                         (1UL << 2)
+#define DMA_CCR_TEIE                         (1UL << 3)
+#define DMA_CCR_DIR                          (1UL << 4)
+#define DMA_CCR_CIRC                         (1UL << 5)
+#define DMA_CCR_PINC                         (1UL << 6)
+#define DMA_CCR_MINC                         (1UL << 7)
+#define DMA_CCR_PSIZE_Pos                    8U
+#define DMA_CCR_PSIZE                        (3UL << 8)
+#define DMA_CCR_PSIZE_0                      (1UL << 8)
+#define DMA_CCR_PSIZE_1                      (2UL << 8)
+#define DMA_CCR_MSIZE_Pos                    10U
+#define DMA_CCR_MSIZE                        (3UL << 10)
+#define DMA_CCR_MSIZE_0                      (1UL << 10)
+#define DMA_CCR_MSIZE_1                      (2UL << 10)
+#define DMA_CCR_PL_Pos                       12U
+#define DMA_CCR_PL                           (3UL << 12)
+#define DMA_CCR_PL_0                         (1UL << 12)
+#define DMA_CCR_PL_1                         (2UL << 12)
+#define DMA_CCR_MEM2MEM                      (1UL << 14)
+
+/*
+ * DMAMUX
+ */
+#define DMAMUX_CxCR_DMAREQ_ID_Pos            0U
+#define DMAMUX_CxCR_DMAREQ_ID                (0x3FUL << 0)
+
+/*
+ * TIM
+ */
+#define TIM_CR1_CEN                          (1UL << 0)
+#define TIM_CR1_URS                          (1UL << 2)
+#define TIM_CR1_ARPE                         (1UL << 7)
+#define TIM_CR2_MMS_Pos                      4U
+#define TIM_CR2_MMS                          (7UL << 4)
+#define TIM_CR2_MMS_0                        (1UL << 4)
+#define TIM_CR2_MMS_1                        (2UL << 4)
+#define TIM_CR2_MMS_2                        (4UL << 4)
+#define TIM_DIER_UIE                         (1UL << 0)
+#define TIM_SR_UIF                           (1UL << 0)
+#define TIM_EGR_UG                           (1UL << 0)
+
+/*
+ * USART
+ */
+#define USART_CR1_UE                         (1UL << 0)
+#define USART_CR1_TE                         (1UL << 3)
+#define USART_CR1_TCIE                       (1UL << 6)
+#define USART_CR1_TXEIE_TXFNFIE              (1UL << 7)
+#define USART_CR3_DMAT                       (1UL << 7)
+#define USART_ISR_TC                         (1UL << 6)
+#define USART_ISR_TXE_TXFNF                  (1UL << 7)
+#define USART_ICR_TCCF                       (1UL << 6)
+
+/*
+ * GPIO
+ */
+#define GPIO_MODER_MODE2_Pos                 4U
+#define GPIO_MODER_MODE2                     (3UL << 4)
+#define GPIO_MODER_MODE2_1                   (2UL << 4)
+#define GPIO_AFRL_AFSEL2_Pos                 8U
+#define GPIO_AFRL_AFSEL2                     (0xFUL << 8)
+
+/*
+ * SysTick
+ */
+#define SysTick_CTRL_ENABLE_Msk              (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk             (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk           (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk           (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk              (0xFFFFFFUL)
+
+/*
+ * SCB
+ */
+#define SCB_SCR_SLEEPONEXIT_Msk              (1UL << 1)
+#define SCB_SCR_SLEEPDEEP_Msk                (1UL << 2)
+
+#endif /* SIM_INC_STM32G030XX_H_ */
@@ -0,0 +1,862 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_main.c                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Streaming Pipeline Run                         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Runs the acquisition pipeline of src/main.c (bring-up, ping-pong DMA stream, SPSC queue, integer          *
+ * conversion) against the peripheral model and reports throughput and loss.                                *
+ *                                                                                                          *
+ * Usage:                                                                                                   *
+ *   ./adc_sim [seconds]        simulated run time, default 1 s                                             *
+ *   ./adc_sim N export         also export the stream on USART2 (ADC_PACK_DELTA), decode and compare the   *
+ *                              received frames with the samples, write them to adc_export.bin              *
+ *   ./adc_sim N pack           same with ADC_PACK_RAW (12 bits per sample)                                 *
+ *   ./adc_sim N trigger        then triggered captures (rising, falling with a late ISR, level, GPIO)      *
+ *                              checked for the trigger sample, pre/post lengths and continuity             *
+ *   ./adc_sim N vdda           then CH0 + VREFINT + TSENSE scanned at 3.3 V / 30 degC and 2.9 V / 45 degC:  *
+ *                              tracked VDDA, temperature and corrected CH0 millivolts checked              *
+ *   ./adc_sim N async          then CH0 + VREFINT by interrupt, no DMA: one ADC1_ReadAsync() in __WFI(),   *
+ *                              then 100 ms of timer-triggered scans, checked for values, EOCs and OVR      *
+ *   ./adc_sim N fft            then a 250 Hz tone at 4 kHz in 256-point Hann frames: peak bin, amplitude   *
+ *                              and band levels checked                                                     *
+ *   ./adc_sim N ch4 ...        ADC on DMA1 Channel4 (shared Ch4_5 vector), with the options above          *
+ *                                                                                                          *
+ * Exit status:                                                                                             *
+ *   - 0 when no samples were lost and no register access rule was broken, 1 otherwise.                     *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define _POSIX_C_SOURCE 199309L                                  //clock_gettime()
+
+#include "sim.h"
+#include "adc.h"
+#include "dma.h"
+#include "adc_stream.h"
+#include "adc_convert.h"
+#include "adc_queue.h"
+#include "adc_awd.h"
+#include "adc_instr.h"
+#include "adc_decim.h"
+#include "adc_stats.h"
+#include "adc_lowpower.h"
+#include "adc_export.h"
+#include "adc_capture.h"
+#include "adc_vref.h"
+#include "adc_async.h"
+#include "adc_fft.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define ADC_BUFFER_LEN                       32U    // Same as src/main.c
+#define DECIM_RATIO                          8U
+#define EXPORT_BAUD                          115200U
+#define EXPORT_FILE                          "adc_export.bin"
+#define CAPTURE_LEN                          512U
+#define CAPTURE_LEVEL                        2048U  // Mid-scale of the 1.65 V +- 1.2 V sine
+#define CAPTURE_GPIO_LINE                    1U     // PA1 -> EXTI1
+#define CAPTURE_MAX_STEP                     100U   // 50 Hz sine at ADC_PLAN_SPS moves < 64 codes per sample
+#define VDDA_WINDOW                          64U    // VREFINT samples per VDDA update
+#define VDDA_INPUT_V                         1.000  // CH0 during the check: 5700 mV at the divider input
+#define ASYNC_SCAN_HZ                        1000U  // Timer-triggered scans in the async check
+#define ASYNC_AWD_HZ                         20.0   // CH0 square wave crossing the AWD2 window meanwhile
+#define ASYNC_AWD_V                          0.2    // Square amplitude around VDDA_INPUT_V
+#define FFT_RATE_HZ                          4000U  // TIM3-paced CH0 in the spectrum check (< ADC_PLAN_SPS)
+#define FFT_LOG2                             8U     // 256-point frames: 15.6 Hz bins
+#define FFT_TONE_HZ                          250U   // Bin 16
+#define FFT_TONE_V                           0.5
+
+uint16_t adc_buffer[ADC_BUFFER_LEN];                              //Global: CMAR must stay below 4 GB
+uint8_t  adc_buffer8[ADC_BUFFER_LEN];                             //"8bit": byte-packed DMA
+uint16_t adc_wide[ADC_BUFFER_LEN / 2];                            //Packed block widened to the boot scale
+uint16_t adc_mV[ADC_BUFFER_LEN / 2];
+int16_t  adc_filtered[ADC_DECIM_OUT_MAX(ADC_BUFFER_LEN / 2, DECIM_RATIO)];
+uint16_t capture_buffer[CAPTURE_LEN];
+
+static volatile uint32_t async_awd_events;                        //AWD2 callbacks during the async check
+
+/*
+ * Export loopback: what the host receives on the link, and every sample offered to the export
+ */
+static struct {
+	uint8_t  *pRx;
+	size_t    RxLength, RxSize;
+	uint16_t *pRef;
+	size_t    RefLength, RefSize;
+} link;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INTERRUPT HANDLERS                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static void ADC_DMA_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx) {
+	(void)Channel;
+	(void)pCtx;
+	ADC_INSTR_ENTER(ADC_INSTR_ISR_DMA);
+	if (!ADC_Capture_IRQHandler(Flags)) {
+		ADC_Stream_IRQHandler(Flags);
+	}
+	ADC_INSTR_EXIT(ADC_INSTR_ISR_DMA);
+}
+
+void EXTI0_1_IRQHandler(void) {
+	ADC_Capture_EXTI_IRQHandler();
+}
+
+void ADC1_IRQHandler(void) {
+	ADC_INSTR_ENTER(ADC_INSTR_ISR_ADC);
+	ADC1_Init_IRQHandler();
+	ADC_Async_IRQHandler();                                       //Takes DR before the AWD handler re-reads it
+	ADC_AWD_IRQHandler();
+	ADC_INSTR_EXIT(ADC_INSTR_ISR_ADC);
+}
+
+static void ADC_BlockReady(const ADC_Block_t *pBlock) {
+
+	if (!ADC_Queue_Push(pBlock)) {
+		ADC_Stream_Release(pBlock);
+	}
+}
+
+static void Print_Histogram(const char *pName, const uint32_t *pBins, const char *pUnit) {
+
+	printf("%-15s:", pName);
+	for (uint32_t i = 0; i < ADC_INSTR_HIST_BINS; i++) {
+		if (pBins[i] != 0U) {
+			printf(" [%s%lu]=%lu", pUnit, (unsigned long)i, (unsigned long)pBins[i]);
+		}
+	}
+	printf("\n");
+}
+
+static void *Grow(void *p, size_t *pSize, size_t Need, size_t Item) {
+
+	if (Need > *pSize) {
+		*pSize = (Need > 2U * *pSize) ? Need : 2U * *pSize;
+		p = realloc(p, *pSize * Item);
+		if (p == NULL) {
+			abort();
+		}
+	}
+	return p;
+}
+
+static void Link_Receive(uint8_t Byte, void *pCtx) {
+	(void)pCtx;
+	link.pRx = Grow(link.pRx, &link.RxSize, link.RxLength + 1U, 1U);
+	link.pRx[link.RxLength++] = Byte;
+}
+
+static void Link_Offer(const uint16_t *pData, uint32_t Length) {
+	link.pRef = Grow(link.pRef, &link.RefSize, link.RefLength + Length, sizeof(uint16_t));
+	memcpy(&link.pRef[link.RefLength], pData, Length * sizeof(uint16_t));
+	link.RefLength += Length;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Link_Verify()
+ * Purpose  : Decode the received bytes as a host would
+ * Details  : Every decoded sample must equal the one offered at
+ *            its stream index. Returns the number of errors.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t Link_Verify(uint64_t *pSamples, uint32_t *pFrames) {
+	static uint16_t out[ADC_EXPORT_FRAME_SAMPLES];
+	ADC_FrameInfo_t info;
+	uint32_t        errors = 0, expect = 0;
+	size_t          pos = 0;
+
+	*pSamples = 0;
+	*pFrames  = 0;
+	while (pos < link.RxLength) {
+		ADC_UnpackStatus_t status = ADC_Unpack_Frame(&link.pRx[pos], (uint32_t)(link.RxLength - pos), &info,
+		                                             out, ADC_EXPORT_FRAME_SAMPLES);
+
+		if (status == ADC_UNPACK_SHORT) {
+			errors++;                                             //Truncated last frame
+			break;
+		}
+		if (status != ADC_UNPACK_OK) {
+			errors++;
+			pos++;                                                //Resync on the next sync word
+			continue;
+		}
+		if (info.Sequence != (uint16_t)expect) {
+			errors++;
+		}
+		expect = info.Sequence + 1U;
+
+		for (uint32_t i = 0; i < info.Count; i++) {
+			size_t at = (size_t)info.FirstSample + i;
+
+			if ((at >= link.RefLength) || (out[i] != link.pRef[at])) {
+				errors++;
+			}
+		}
+		*pSamples += info.Count;
+		(*pFrames)++;
+		pos += info.FrameBytes;
+	}
+
+	return errors;
+}
+
+static uint16_t Capture_At(const ADC_Capture_t *pCapture, uint32_t Index) {
+	return (Index < pCapture->FirstLength) ? pCapture->pFirst[Index] : pCapture->pSecond[Index - pCapture->FirstLength];
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Capture_Check()
+ * Purpose  : Arm one capture, fire it, check the result
+ * Details  : LateIsr runs with PRIMASK set in 1 ms slices so the
+ *            AWD ISR comes up to 8 samples late. GPIO edges are
+ *            fired 40 ms after arming. Returns false on a wrong
+ *            trigger sample, length or a seam in the runs. A
+ *            level trigger armed above Level fires at once: then
+ *            the sample before it is above Level as well.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Capture_Check(const char *pName, const ADC_CaptureConfig_t *pConfig, bool LateIsr) {
+	const bool    gpio = (pConfig->Source == ADC_TRIG_GPIO);
+	const bool    rising = (pConfig->Source == ADC_TRIG_RISING) || (pConfig->Source == ADC_TRIG_LEVEL_ABOVE);
+	const uint64_t slice = LateIsr ? 1000000ULL : 50000ULL;     //Fine slices: see how long ARMED lasted
+	uint32_t      expect = 0, step = 0, trig, prev;
+	uint64_t      armed_ns = 0;
+	ADC_Capture_t cap;
+	bool          ok;
+
+	if (!ADC_Capture_Arm(capture_buffer, CAPTURE_LEN, pConfig)) {
+		printf("capture %-7s: arm rejected\n", pName);
+		return false;
+	}
+	if (gpio) {
+		SIM_Run(40000000ULL);
+		expect = CAPTURE_LEN - sim_dma1_ch[DMA1_GetAdcChannel() - 1U].CNDTR;  //Model state: no simulated access
+		SIM_EXTI_Edge(CAPTURE_GPIO_LINE, true);
+	}
+	for (uint64_t t = 0; (t < 200000000ULL) && !ADC_Capture_IsDone(); t += slice) {
+		if (LateIsr) {
+			__disable_irq();
+		}
+		SIM_Run(slice);
+		if (LateIsr) {
+			__enable_irq();
+		}
+		armed_ns += (ADC_Capture_GetState() == ADC_CAPTURE_ARMED) ? slice : 0U;
+	}
+	if (!ADC_Capture_Get(&cap)) {
+		printf("capture %-7s: no trigger in 200 ms\n", pName);
+		return false;
+	}
+
+	for (uint32_t i = 1; i < cap.Length; i++) {
+		uint32_t a = Capture_At(&cap, i - 1U), b = Capture_At(&cap, i);
+		uint32_t d = (a > b) ? (a - b) : (b - a);
+
+		step = (d > step) ? d : step;
+	}
+	trig = Capture_At(&cap, cap.TriggerIndex);
+	prev = Capture_At(&cap, cap.TriggerIndex - 1U);
+
+	ok = (cap.Length == pConfig->PreScans + pConfig->PostScans) && (cap.TriggerIndex == pConfig->PreScans) &&
+	     cap.Exact && (step < CAPTURE_MAX_STEP);
+	if (gpio) {
+		const uint16_t *at = (cap.TriggerIndex < cap.FirstLength) ? &cap.pFirst[cap.TriggerIndex]
+		                                                           : &cap.pSecond[cap.TriggerIndex - cap.FirstLength];
+		ok = ok && ((uint32_t)(at - capture_buffer) == expect);
+	} else if ((pConfig->Source == ADC_TRIG_LEVEL_ABOVE) && (prev > pConfig->Level)) {
+		ok = ok && (trig > pConfig->Level) && (armed_ns < 3000000000ULL / ADC_PLAN_SPS);  //Fired at arming
+	} else if (rising) {
+		ok = ok && (trig > pConfig->Level) && (prev <= pConfig->Level);
+	} else {
+		ok = ok && (trig < pConfig->Level) && (prev >= pConfig->Level);
+	}
+
+	printf("capture %-7s: %lu samples (%lu pre) in %lu+%lu, trigger %lu after %lu, ISR %lu late, max step %lu: %s\n",
+	       pName, (unsigned long)cap.Length, (unsigned long)cap.TriggerIndex, (unsigned long)cap.FirstLength,
+	       (unsigned long)cap.SecondLength, (unsigned long)trig, (unsigned long)prev,
+	       (unsigned long)cap.TriggerLatency, (unsigned long)step, ok ? "ok" : "FAIL");
+	return ok;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Vdda_Run()
+ * Purpose  : Stream the VREFINT scan for Ms, average CH0 in mV
+ * Details  : Corrected (cached scale) and nominal conversion of
+ *            the same blocks; CH0 is scan position 0
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void Vdda_Run(uint32_t Ms, uint32_t Scan, double *pCorrected, double *pNominal) {
+	static uint16_t nominal[ADC_BUFFER_LEN / 2];
+	uint64_t        end_ns = SIM_GetTimeNs() + (uint64_t)Ms * 1000000ULL;
+	uint64_t        sum = 0, sum_nominal = 0, count = 0;
+	static uint32_t pos;                                          //Scan position, carried across calls
+	ADC_Block_t     block;
+
+	while (SIM_GetTimeNs() < end_ns) {
+		while (ADC_Queue_Pop(&block)) {
+			ADC_Vref_Update(block.pData, block.Length);
+			ADC_Vref_Convert_Block_mV(block.pData, adc_mV, block.Length);
+			ADC_Convert_Block_mV(block.pData, nominal, block.Length);
+			ADC_Stream_Release(&block);
+
+			for (uint32_t i = 0; i < block.Length; i++, pos = (pos + 1U) % Scan) {
+				if (pos == 0U) {
+					sum         += adc_mV[i];
+					sum_nominal += nominal[i];
+					count++;
+				}
+			}
+		}
+		__WFI();
+	}
+	*pCorrected = (count != 0U) ? (double)sum / (double)count : 0.0;
+	*pNominal   = (count != 0U) ? (double)sum_nominal / (double)count : 0.0;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Vdda_Check()
+ * Purpose  : VREFINT tracking against a supply / temperature step
+ * Details  : Restarts the stream on CH0 + VREFINT + TSENSE, runs
+ *            at 3.3 V / 30 degC, then 2.9 V / 45 degC. Passes when
+ *            VDDA is within 10 mV, the temperature within 1.5
+ *            degC and corrected CH0 within 0.5 % in both.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Vdda_Check(void) {
+	const SIM_Wave_t  dc = { .Kind = SIM_WAVE_DC, .Offset_V = VDDA_INPUT_V };
+	const double      expect_mV = VDDA_INPUT_V * 1000.0 * ADC_CONVERT_DIV_NUM / ADC_CONVERT_DIV_DEN;
+	const double      vdda[2] = { 3.3, 2.9 }, degc[2] = { 30.0, 45.0 };
+	ADC_ScanConfig_t  scan = { .Mode = ADC_SCAN_SEQUENCE, .NumChannels = 1U, .Channels = { 0U },
+	                           .SampleTime = { (ADC_SampleTime_t)ADC_PLAN_SMP } };
+	ADC_VrefResult_t  result;
+	ADC_Block_t       block;
+	bool              ok = true;
+
+	ADC1_Stop();
+	while (ADC_Queue_Pop(&block)) {
+		ADC_Stream_Release(&block);
+	}
+	ADC_Queue_Reset();
+	SIM_SetWave(0, &dc);
+
+	if (!ADC_Vref_AddChannels(&scan, true) || !ADC1_ConfigScan(&scan) || !ADC_Vref_Start(VDDA_WINDOW) ||
+	    !ADC_Stream_Start(adc_buffer, ADC_BUFFER_LEN, ADC_BlockReady)) {
+		printf("vdda           : scan with VREFINT/TSENSE rejected (%lu-bit results)\n",
+		       (unsigned long)ADC1_GetResultBits());
+		return false;
+	}
+	printf("vdda           : scan CH0 + VREFINT (SMP %u) + TSENSE, window %u, cal %u / %u\n",
+	       (unsigned)scan.SampleTime[1], (unsigned)VDDA_WINDOW, (unsigned)*VREFINT_CAL_ADDR,
+	       (unsigned)*TEMPSENSOR_CAL1_ADDR);
+
+	for (uint32_t step = 0; step < 2U; step++) {
+		double corrected, nominal, error;
+		bool   pass;
+
+		SIM_SetSupply(vdda[step]);
+		SIM_SetTemperature(degc[step]);
+		Vdda_Run(50U, scan.NumChannels, &corrected, &nominal);    //Settle: start-up window, old scale
+		Vdda_Run(100U, scan.NumChannels, &corrected, &nominal);
+
+		error = (corrected - expect_mV) / expect_mV;
+		pass  = ADC_Vref_Get(&result) && (fabs((double)result.Vdda_mV - vdda[step] * 1000.0) <= 10.0) &&
+		        (result.Temp_dC != INT32_MIN) && (fabs((double)result.Temp_dC - degc[step] * 10.0) <= 15.0) &&
+		        (fabs(error) <= 0.005);
+		ok = ok && pass;
+
+		printf("  %.1f V %2.0f degC: VDDA %lu mV, %ld.%ld degC (#%lu, %lu rejected), CH0 %.1f mV (nominal %.1f, "
+		       "expect %.1f): %s\n", vdda[step], degc[step], (unsigned long)result.Vdda_mV,
+		       (long)(result.Temp_dC / 10), (long)labs(result.Temp_dC % 10), (unsigned long)result.Sequence,
+		       (unsigned long)result.Rejected, corrected, nominal, expect_mV, pass ? "ok" : "FAIL");
+	}
+
+	ADC1_Stop();
+	ok = ok && ADC_Vref_Stop();
+	return ok;
+}
+
+static void Async_Conversion(uint32_t Index, uint8_t Channel, uint16_t Value, void *pCtx) {
+	(void)Channel;
+	(void)Value;
+
+	((uint32_t *)pCtx)[Index]++;                                  //EOCs per scan position
+}
+
+static void Async_Sequence(const uint16_t *pResults, uint32_t Length, void *pCtx) {
+	uint16_t *pLast = pCtx;
+
+	for (uint32_t i = 0; i < Length; i++) {
+		pLast[i] = pResults[i];
+	}
+	pLast[ADC_SCAN_MAX_CHANNELS] = (uint16_t)Length;
+}
+
+static void Async_Window(ADC_AWD_t Watchdog, ADC_AWD_Event_t Event, uint16_t Value) {
+	(void)Watchdog;
+	(void)Event;
+	(void)Value;
+
+	async_awd_events++;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Async_Check()
+ * Purpose  : Interrupt-driven sampling without DMA or polling
+ * Details  : CH0 (VDDA_INPUT_V) + VREFINT at 3.3 V: one
+ *            ADC1_ReadAsync() slept through with __WFI(), then
+ *            ASYNC_SCAN_HZ timer-triggered scans for 100 ms
+ *            while CH0 steps across an AWD2 window. Passes when
+ *            all readings are within 8 codes, window events came
+ *            and took no EOC from the scans and no OVR occurred.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Async_Check(void) {
+	const SIM_Wave_t  dc = { .Kind = SIM_WAVE_DC, .Offset_V = VDDA_INPUT_V };
+	const SIM_Wave_t  square = { .Kind = SIM_WAVE_SQUARE, .Offset_V = VDDA_INPUT_V, .Amplitude_V = ASYNC_AWD_V,
+	                             .Freq_Hz = ASYNC_AWD_HZ };
+	const double      expect[2] = { VDDA_INPUT_V / 3.3 * 4095.0, 3.0 / 3.3 * (double)*VREFINT_CAL_ADDR };
+	const double      step = ASYNC_AWD_V / 3.3 * 4095.0;
+	const ADC_AWD_Config_t awd = { .Channels = ADC_CHSELR_CHSEL0, .Low = (uint16_t)(expect[0] - step / 2.0),
+	                               .High = (uint16_t)(expect[0] + step / 2.0), .Hysteresis = 16U,
+	                               .Callback = Async_Window };
+	ADC_ScanConfig_t  scan = { .Mode = ADC_SCAN_SEQUENCE, .NumChannels = 1U, .Channels = { 0U },
+	                           .SampleTime = { (ADC_SampleTime_t)ADC_PLAN_SMP } };
+	uint16_t          read[ADC_SCAN_MAX_CHANNELS + 1U] = { 0 };
+	uint16_t          last[ADC_SCAN_MAX_CHANNELS];
+	uint32_t          eoc[ADC_SCAN_MAX_CHANNELS] = { 0 };
+	ADC_AsyncConfig_t cfg = { .OnConversion = Async_Conversion, .OnSequence = Async_Sequence, .pCtx = NULL };
+	ADC_AsyncStats_t  async;
+	ADC_Block_t       block;
+	uint64_t          start_ns, sleeps = 0;
+	uint32_t          expect_scans, scans;
+	bool              ok;
+
+	ADC1_Stop();
+	while (ADC_Queue_Pop(&block)) {
+		ADC_Stream_Release(&block);
+	}
+	ADC_Queue_Reset();
+	SIM_SetWave(0, &dc);
+	SIM_SetSupply(3.3);
+
+	if (!ADC_Vref_AddChannels(&scan, false) || !ADC1_ConfigScan(&scan) || !ADC_Vref_Start(VDDA_WINDOW)) {
+		printf("async          : scan with VREFINT rejected\n");
+		return false;
+	}
+	SIM_Run(1000000ULL);                                          //Reference buffer start-up
+
+	start_ns = SIM_GetTimeNs();
+	ok       = ADC1_ReadAsync(Async_Sequence, read) && !ADC1_ReadAsync(Async_Sequence, read);
+	while (ADC_Async_IsBusy()) {
+		__WFI();
+		sleeps++;
+	}
+	ok = ok && (read[ADC_SCAN_MAX_CHANNELS] == 2U) && (fabs(read[0] - expect[0]) <= 8.0) &&
+	     (fabs(read[1] - expect[1]) <= 8.0);
+	printf("async          : ReadAsync CH0 %u (expect %.0f), VREFINT %u (expect %.0f) in %.1f us, %llu WFI: %s\n",
+	       read[0], expect[0], read[1], expect[1], (double)(SIM_GetTimeNs() - start_ns) * 1e-3,
+	       (unsigned long long)sleeps, ok ? "ok" : "FAIL");
+
+	cfg.pCtx = eoc;
+	cfg.OnSequence = NULL;
+	async_awd_events = 0;
+	SIM_SetWave(0, &square);
+	start_ns = SIM_GetTimeNs();
+	if (!ADC_AWD_Config(ADC_AWD2, &awd) || !ADC1_ConfigTimerTrigger(ASYNC_SCAN_HZ, NULL) || !ADC_Async_Start(&cfg)) {
+		printf("async          : %u Hz timer-triggered start rejected\n", (unsigned)ASYNC_SCAN_HZ);
+		return false;
+	}
+	while (SIM_GetTimeNs() - start_ns < 100000000ULL) {
+		__WFI();
+	}
+	ADC_Async_Stop();
+	ADC_AWD_Disable(ADC_AWD2);
+	ADC1_ConfigFreeRun();
+	SIM_SetWave(0, &dc);
+
+	ADC_Async_GetStats(&async);
+	expect_scans = ASYNC_SCAN_HZ / 10U;
+	scans        = async.Sequences - 1U;                          //Without the ReadAsync() scan
+	ok = ok && (ADC_Async_GetLast(last) == async.Sequences) && (async.Overruns == 0U) &&
+	     (async.Incomplete == 0U) && (eoc[1] == scans) && (eoc[0] - eoc[1] <= 1U) &&  //Stop may cut a scan
+	     (scans + 1U >= expect_scans) && (scans <= expect_scans + 1U) && (async_awd_events >= 4U) &&
+	     (fabs(fabs(last[0] - expect[0]) - step) <= 8.0) && (fabs(last[1] - expect[1]) <= 8.0);
+	printf("  timer        : %u Hz for 100 ms, %lu scans (+1 ReadAsync), %lu EOC, %lu OVR, %lu incomplete, "
+	       "%lu AWD2 events (%lu missed), last %u / %u: %s\n", (unsigned)ASYNC_SCAN_HZ, (unsigned long)scans,
+	       (unsigned long)async.Conversions, (unsigned long)async.Overruns, (unsigned long)async.Incomplete,
+	       (unsigned long)async_awd_events, (unsigned long)ADC_AWD_GetMissed(ADC_AWD2), last[0], last[1],
+	       ok ? "ok" : "FAIL");
+
+	return ADC_Vref_Stop() && ok;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : Fft_Check()
+ * Purpose  : Spectrum of a tone streamed at FFT_RATE_HZ
+ * Details  : CH0 alone, TIM3-paced, FFT_TONE_HZ sine with noise
+ *            for 500 ms of 256-point Hann frames. Passes when the
+ *            peak sits on the tone bin, peak and tone band are
+ *            within 1 % of the amplitude and of amplitude / sqrt2
+ *            and the other bands hold only the noise.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool Fft_Check(void) {
+	const SIM_Wave_t tone = { .Kind = SIM_WAVE_SINE, .Offset_V = 1.65, .Amplitude_V = FFT_TONE_V,
+	                          .Freq_Hz = FFT_TONE_HZ, .Noise_V = 0.002 };
+	const uint16_t   bin  = ADC_FFT_BIN(FFT_TONE_HZ, FFT_RATE_HZ, FFT_LOG2);
+	ADC_ScanConfig_t scan = { .Mode = ADC_SCAN_SEQUENCE, .NumChannels = 1U, .Channels = { 0U },
+	                          .SampleTime = { (ADC_SampleTime_t)ADC_PLAN_SMP } };
+	ADC_FftConfig_t  cfg  = { .Log2Points = FFT_LOG2, .Window = ADC_FFT_WINDOW_HANN, .Channels = 1U,
+	                          .NumBands = 3U, .Bands = { { 1U, bin - 3U }, { bin - 2U, bin + 2U },
+	                          { bin + 3U, 1U << (FFT_LOG2 - 1U) } } };
+	static ADC_Fft_t fft;
+	ADC_FftResult_t  result;
+	ADC_Block_t      block;
+	uint64_t         end_ns;
+	double           amplitude, noise;
+	bool             ok;
+
+	ADC1_Stop();
+	while (ADC_Queue_Pop(&block)) {
+		ADC_Stream_Release(&block);
+	}
+	ADC_Queue_Reset();
+	SIM_SetWave(0, &tone);
+	SIM_SetSupply(3.3);
+
+	amplitude    = FFT_TONE_V / 3.3 * (double)((1UL << ADC1_GetResultBits()) - 1U) * 16.0;   //Q4 codes
+	noise        = 0.002 / 3.3 * (double)((1UL << ADC1_GetResultBits()) - 1U) * 16.0;
+	cfg.InputBits = ADC1_GetResultBits();
+	if (!ADC_Fft_Init(&fft, &cfg) || !ADC1_ConfigScan(&scan) || !ADC1_ConfigTimerTrigger(FFT_RATE_HZ, NULL) ||
+	    !ADC_Stream_Start(adc_buffer, ADC_BUFFER_LEN, ADC_BlockReady)) {
+		printf("fft            : %u Hz stream with %u-point frames rejected (%lu-bit results)\n",
+		       (unsigned)FFT_RATE_HZ, (unsigned)(1U << FFT_LOG2), (unsigned long)ADC1_GetResultBits());
+		return false;
+	}
+
+	end_ns = SIM_GetTimeNs() + 500000000ULL;
+	while (SIM_GetTimeNs() < end_ns) {
+		while (ADC_Queue_Pop(&block)) {
+			ADC_Fft_Update(&fft, block.pData, block.Length);
+			ADC_Stream_Release(&block);
+		}
+		__WFI();
+	}
+	ADC1_Stop();
+	ADC1_ConfigFreeRun();
+
+	ok = ADC_Fft_Get(&fft, &result) && (result.Sequence >= 5U) && (result.PeakBin == bin) &&
+	     (fabs(result.PeakQ4 - amplitude) <= 0.01 * amplitude) &&
+	     (fabs(result.BandRmsQ4[1] - amplitude / sqrt(2.0)) <= 0.01 * amplitude) &&
+	     (result.BandRmsQ4[0] <= 2.0 * noise) && (result.BandRmsQ4[2] <= 2.0 * noise);
+
+	printf("fft            : %u points at %u Hz (%.1f Hz/bin), %u Hz tone, %lu frames\n", (unsigned)(1U << FFT_LOG2),
+	       (unsigned)FFT_RATE_HZ, (double)FFT_RATE_HZ / (double)(1U << FFT_LOG2), (unsigned)FFT_TONE_HZ,
+	       (unsigned long)result.Sequence);
+	printf("  peak         : bin %lu (expect %u), %.1f codes (expect %.1f), mean %.1f codes\n",
+	       (unsigned long)result.PeakBin, (unsigned)bin, result.PeakQ4 / 16.0, amplitude / 16.0, result.MeanQ4 / 16.0);
+	printf("  bands rms    : %.2f / %.2f (expect %.2f) / %.2f codes, noise %.2f codes rms: %s\n",
+	       result.BandRmsQ4[0] / 16.0, result.BandRmsQ4[1] / 16.0, amplitude / sqrt(2.0) / 16.0,
+	       result.BandRmsQ4[2] / 16.0, noise / 16.0, ok ? "ok" : "FAIL");
+
+	return ok;
+}
+
+static double Host_Seconds(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MAIN                                                           */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+int main(int argc, char **argv) {
+	const SIM_Wave_t input = { .Kind = SIM_WAVE_SINE, .Offset_V = 1.65, .Amplitude_V = 1.2,
+	                           .Freq_Hz = 50.0, .Noise_V = 0.002 };
+	double            seconds = (argc > 1) ? atof(argv[1]) : 1.0;
+	bool              low_power = false;
+	bool              packed = false;
+	bool              exporting = false;
+	bool              export_failed = false;
+	bool              triggering = false;
+	bool              capture_failed = false;
+	bool              vdda_check = false;
+	bool              vdda_failed = false;
+	bool              async_check = false;
+	bool              async_failed = false;
+	bool              fft_check = false;
+	bool              fft_failed = false;
+	DMA_ChannelConfig_t adc_dma = { .Channel = DMA1_CHANNEL_ANY, .Priority = DMA_PRIORITY_HIGH,
+	                                .IrqPriority = 1U, .Handler = ADC_DMA_IRQHandler };
+	ADC_PackMode_t    export_mode = ADC_PACK_DELTA;
+	uint64_t          end_ns;
+	uint64_t          samples = 0;
+	uint16_t          min_mV = UINT16_MAX, max_mV = 0;
+	uint32_t          mv_q16;
+	uint64_t          filtered = 0;
+	int16_t           min_q15 = INT16_MAX, max_q15 = INT16_MIN;
+	double            t0, t1;
+	ADC_Block_t       block;
+	ADC_StreamStats_t stream;
+	ADC_QueueStats_t  queue;
+	ADC_InstrSnapshot_t health;
+	ADC_ConvertBench_t  bench;
+	ADC_Decim_t       decim;
+	ADC_Stats_t       stats;
+	ADC_StatsResult_t window;
+	ADC_LowPowerStats_t energy;
+	SIM_Stats_t       sim;
+
+	for (int a = 2; a < argc; a++) {
+		low_power |= (strcmp(argv[a], "lp") == 0);
+		packed    |= (strcmp(argv[a], "8bit") == 0);
+		triggering |= (strcmp(argv[a], "trigger") == 0);
+		vdda_check |= (strcmp(argv[a], "vdda") == 0);
+		async_check |= (strcmp(argv[a], "async") == 0);
+		fft_check  |= (strcmp(argv[a], "fft") == 0);
+		if (strcmp(argv[a], "ch4") == 0) {
+			adc_dma.Channel = 4U;                                 //Shared Ch4_5 vector, export takes Channel1
+		}
+		if ((strcmp(argv[a], "export") == 0) || (strcmp(argv[a], "pack") == 0)) {
+			exporting   = true;
+			export_mode = (argv[a][0] == 'p') ? ADC_PACK_RAW : ADC_PACK_DELTA;
+		}
+	}
+
+	SIM_Reset(NULL);
+	SIM_SetWave(0, &input);                                       //PA0 = CH0
+
+	HAL_Init();
+	ADC1_InitAsync(ADC_INIT_FLAG_IRQ | ADC_INIT_FLAG_CALCACHE);
+	DMA1_Init();
+	if (DMA1_InitAdc(&adc_dma) == DMA1_CHANNEL_ANY) {
+		printf("ADC DMA channel %lu not available\n", (unsigned long)adc_dma.Channel);
+		return 1;
+	}
+	while (ADC1_InitPoll() < ADC_INIT_READY) {
+	}
+	if (ADC1_InitPoll() == ADC_INIT_ERROR) {
+		printf("ADC calibration could not start\n");
+		return 1;
+	}
+	if (packed && !ADC1_ConfigResolution(ADC_RES_8BIT, ADC_ALIGN_RIGHT)) {
+		printf("8-bit resolution rejected\n");
+		return 1;
+	}
+
+	mv_q16 = ADC_CONVERT_MV_Q16_BITS(ADC1_GetResultBits());       //mV per code at the configured width
+	ADC_Decim_Init(&decim, DECIM_RATIO, ADC_RESOLUTION_BITS);      //Packed blocks are widened to this scale
+	ADC_Stats_Init(&stats, 1U, (low_power ? ADC_PLAN_TARGET_SPS : ADC_PLAN_SPS) / 10U, NULL);  //100 ms at the paced rate
+	ADC_Queue_Reset();
+	ADC_Instr_Start(ADC_BUFFER_LEN / 2);
+	SIM_USART_SetSink(Link_Receive, NULL);
+	if (exporting && !ADC_Export_Init(EXPORT_BAUD, export_mode, ADC_RESOLUTION_BITS)) {
+		printf("export: %u baud not reachable\n", (unsigned)EXPORT_BAUD);
+		return 1;
+	}
+	if (low_power && !ADC_LowPower_Start(ADC_PLAN_TARGET_SPS, NULL, NULL)) {
+		printf("low-power profile: %u sps not reachable with AUTOFF\n", (unsigned)ADC_PLAN_TARGET_SPS);
+		return 1;
+	}
+	if (packed ? !ADC_Stream_Start8(adc_buffer8, ADC_BUFFER_LEN, ADC_BlockReady)
+	           : !ADC_Stream_Start(adc_buffer, ADC_BUFFER_LEN, ADC_BlockReady)) {
+		printf("stream start rejected (%lu-bit results)\n", (unsigned long)ADC1_GetResultBits());
+		return 1;
+	}
+
+	t0     = Host_Seconds();
+	end_ns = SIM_GetTimeNs() + (uint64_t)(seconds * 1e9);
+
+	while (SIM_GetTimeNs() < end_ns) {
+		while (ADC_Queue_Pop(&block)) {
+			const uint16_t *pData = block.pData;
+			uint32_t        n;
+
+			if (block.SampleBytes == 1U) {
+				for (uint32_t i = 0; i < block.Length; i++) {
+					adc_mV[i]   = block.pData8[i];                    //Native codes, converted in place below
+					adc_wide[i] = (uint16_t)(block.pData8[i] << (ADC_RESOLUTION_BITS - ADC1_GetResolutionBits()));
+				}
+				ADC_Convert_Block_mV_Scaled(adc_mV, adc_mV, block.Length, mv_q16);
+				pData = adc_wide;
+			} else {
+				ADC_Convert_Block_mV_Scaled(pData, adc_mV, block.Length, mv_q16);
+			}
+			n = ADC_Decim_Process(&decim, pData, block.Length, adc_filtered);
+			ADC_Stats_Update(&stats, pData, block.Length);
+			if (exporting) {
+				Link_Offer(pData, block.Length);
+				ADC_Export_Block(pData, block.Length);            //Before the release: reads the block
+			}
+			ADC_Stream_Release(&block);
+
+			for (uint32_t i = 0; (i < n) && (filtered + i >= 64U); i++) {  //Skip the filter start-up
+				min_q15 = (adc_filtered[i] < min_q15) ? adc_filtered[i] : min_q15;
+				max_q15 = (adc_filtered[i] > max_q15) ? adc_filtered[i] : max_q15;
+			}
+			filtered += n;
+
+			for (uint32_t i = 0; i < block.Length; i++) {
+				min_mV = (adc_mV[i] < min_mV) ? adc_mV[i] : min_mV;
+				max_mV = (adc_mV[i] > max_mV) ? adc_mV[i] : max_mV;
+			}
+			samples += block.Length;
+			if (low_power) {
+				ADC_LowPower_BlockDone();
+			}
+		}
+		if (low_power) {
+			ADC_LowPower_Idle(ADC_Queue_Depth);
+		} else {
+			__WFI();
+		}
+	}
+
+	t1 = Host_Seconds();
+	ADC_Stream_GetStats(&stream);
+	ADC_Queue_GetStats(&queue);
+	ADC_Instr_GetSnapshot(&health);
+	SIM_GetStats(&sim);
+
+	printf("simulated      : %.3f s in %.3f s host (%.0fx real time)\n",
+	       (double)SIM_GetTimeNs() * 1e-9, t1 - t0, ((double)SIM_GetTimeNs() * 1e-9) / (t1 - t0));
+	printf("plan           : %s, %u sps\n", ADC_PLAN_TCONV_STR, (unsigned)ADC_PLAN_SPS);
+	printf("data           : %lu-bit results, %lu-byte DMA buffer\n", (unsigned long)ADC1_GetResultBits(),
+	       (unsigned long)(packed ? sizeof(adc_buffer8) : sizeof(adc_buffer)));
+	printf("conversions    : %llu (%.0f sps)\n", (unsigned long long)sim.Conversions,
+	       (double)sim.Conversions / ((double)SIM_GetTimeNs() * 1e-9));
+	printf("processed      : %llu samples, %u blocks, %lu..%lu mV\n", (unsigned long long)samples,
+	       (unsigned)stream.BlocksDelivered, (unsigned long)min_mV, (unsigned long)max_mV);
+	printf("decimated      : %llu samples (/%u), %d..%d Q15 = %u..%u codes\n", (unsigned long long)filtered,
+	       (unsigned)DECIM_RATIO, min_q15, max_q15, (unsigned)ADC_DECIM_TO_CODE(min_q15, ADC_RESOLUTION_BITS),
+	       (unsigned)ADC_DECIM_TO_CODE(max_q15, ADC_RESOLUTION_BITS));
+	if (ADC_Stats_Get(&stats, 0U, &window)) {
+		printf("stats window   : #%lu, %lu samples, %u..%u (p-p %u), mean %.2f, rms %.2f, ac rms %.2f codes\n",
+		       (unsigned long)window.Sequence, (unsigned long)window.Count, window.Min, window.Max,
+		       window.PeakToPeak, window.MeanQ4 / 16.0, window.RmsQ4 / 16.0, window.AcRmsQ4 / 16.0);
+	}
+	printf("irqs           : DMA%lu %llu, ADC %llu\n", (unsigned long)DMA1_GetAdcChannel(),
+	       (unsigned long long)sim.Irqs[DMA1_GetIRQn(DMA1_GetAdcChannel())],
+	       (unsigned long long)sim.Irqs[ADC1_IRQn]);
+	printf("losses         : stream overruns %u, late irqs %u, queue drops %u, ADC OVR %llu\n",
+	       (unsigned)stream.Overruns, (unsigned)stream.LateIRQs, (unsigned)queue.Dropped,
+	       (unsigned long long)sim.Overruns);
+	printf("instr          : %lu sps, %lu samples, OVR %lu, TEIF %lu\n",
+	       (unsigned long)health.SamplesPerSecond, (unsigned long)health.Samples,
+	       (unsigned long)health.AdcOverruns, (unsigned long)health.DmaErrors);
+	printf("DMA ISR        : %lu entries, max %lu cycles, max %lu samples late\n",
+	       (unsigned long)health.Isr[ADC_INSTR_ISR_DMA].Count, (unsigned long)health.Isr[ADC_INSTR_ISR_DMA].MaxCycles,
+	       (unsigned long)health.Isr[ADC_INSTR_ISR_DMA].MaxLatency);
+	Print_Histogram("  duration", health.Isr[ADC_INSTR_ISR_DMA].Duration, "2^");
+	Print_Histogram("  latency", health.Isr[ADC_INSTR_ISR_DMA].Latency, "");
+	printf("ADC ISR        : %lu entries, max %lu cycles\n",
+	       (unsigned long)health.Isr[ADC_INSTR_ISR_ADC].Count, (unsigned long)health.Isr[ADC_INSTR_ISR_ADC].MaxCycles);
+	if (ADC_Convert_Benchmark(adc_buffer, ADC_BUFFER_LEN, &bench)) {
+		printf("convert bench  : %lu samples, float %lu / fixed %lu cycles (CPU untimed here, numbers on target)\n",
+		       (unsigned long)bench.Samples, (unsigned long)bench.FloatCycles, (unsigned long)bench.FixedCycles);
+	} else {
+		printf("convert bench  : SysTick not running\n");
+	}
+	if (low_power) {
+		bool stop_streaming = ADC_LowPower_EnterStop();           //Must be refused: DMA/TIM3 halt in Stop
+		bool stop_idle;
+
+		ADC_LowPower_End();
+		CLEAR_BIT(DMA1_GetChannel(DMA1_GetAdcChannel())->CCR, DMA_CCR_EN);
+		stop_idle = ADC_LowPower_EnterStop();
+		ADC_LowPower_GetStats(&energy);
+		printf("low power      : %lu wakeups/s, %lu blocks/s, %lu awake cycles/block (%lu.%lu %% awake)\n",
+		       (unsigned long)energy.WakeupsPerSecond, (unsigned long)energy.BlocksPerSecond,
+		       (unsigned long)energy.AwakeCyclesPerBlock, (unsigned long)(energy.AwakePermille / 10U),
+		       (unsigned long)(energy.AwakePermille % 10U));
+		printf("Stop           : %s while streaming, %s when idle\n", stop_streaming ? "entered" : "refused",
+		       stop_idle ? "entered" : "refused");
+	}
+	if (exporting) {
+		ADC_ExportStats_t export;
+		uint64_t          decoded;
+		uint32_t          frames, errors;
+		FILE             *pFile;
+
+		ADC1_Stop();                                              //Drain: no new blocks, send what is queued
+		ADC_Export_Flush();
+		do {
+			SIM_Run(1000000ULL);
+			ADC_Export_GetStats(&export);
+		} while (export.Pending != 0U);
+		SIM_Run(1000000ULL);                                      //Last bytes leave TDR and the shifter
+
+		errors  = Link_Verify(&decoded, &frames);
+		export_failed = (errors != 0U) || (export.DroppedSamples != 0U) || (export.DmaErrors != 0U);
+
+		printf("export         : %s at %u baud, %lu frames, %lu bytes, %lu.%02lu bits/sample (16-bit words: 16)\n",
+		       (export_mode == ADC_PACK_RAW) ? "RAW" : "DELTA", (unsigned)EXPORT_BAUD, (unsigned long)export.Frames,
+		       (unsigned long)export.Bytes, (unsigned long)(export.BitsPerSampleQ8 >> 8),
+		       (unsigned long)(((export.BitsPerSampleQ8 & 0xFFU) * 100U) >> 8));
+		printf("  link         : %lu samples dropped (link too slow), %lu DMA errors\n",
+		       (unsigned long)export.DroppedSamples, (unsigned long)export.DmaErrors);
+		printf("  host decode  : %lu frames, %llu samples, %lu CRC/sequence/sample errors\n",
+		       (unsigned long)frames, (unsigned long long)decoded, (unsigned long)errors);
+
+		pFile = fopen(EXPORT_FILE, "wb");
+		if ((pFile != NULL) && (fwrite(link.pRx, 1U, link.RxLength, pFile) == link.RxLength)) {
+			printf("  capture      : %s (%lu bytes), decode with adc_decode\n", EXPORT_FILE,
+			       (unsigned long)link.RxLength);
+		}
+		if (pFile != NULL) {
+			fclose(pFile);
+		}
+		SIM_GetStats(&sim);
+	}
+	if (triggering) {
+		const ADC_CaptureConfig_t base = { .Channel = 0U, .Level = CAPTURE_LEVEL, .Hysteresis = 40U,
+		                                   .ExtiPin = CAPTURE_GPIO_LINE, .Edge = ADC_EDGE_RISING,
+		                                   .PreScans = 100U, .PostScans = 120U };
+		ADC_CaptureConfig_t       cfg = base;
+
+		cfg.Source = ADC_TRIG_RISING;
+		capture_failed |= !Capture_Check("rising", &cfg, false);
+		cfg.Source = ADC_TRIG_FALLING;
+		capture_failed |= !Capture_Check("falling", &cfg, true);
+		cfg.Source = ADC_TRIG_LEVEL_ABOVE;
+		cfg.Level  = 3000U;                                       //Above the crossing: waits for the crest
+		capture_failed |= !Capture_Check("level", &cfg, false);
+		cfg        = base;
+		cfg.Source = ADC_TRIG_GPIO;
+		capture_failed |= !Capture_Check("gpio", &cfg, false);
+		SIM_GetStats(&sim);
+	}
+	if (vdda_check) {
+		vdda_failed = !Vdda_Check();
+		SIM_GetStats(&sim);
+	}
+	if (async_check) {
+		async_failed = !Async_Check();
+		SIM_GetStats(&sim);
+	}
+	if (fft_check) {
+		fft_failed = !Fft_Check();
+		SIM_GetStats(&sim);
+	}
+	printf("rule violations: %u\n", (unsigned)sim.Violations);
+
+	return ((sim.Violations != 0U) || (sim.Overruns != 0U) || (stream.Overruns != 0U) || (queue.Dropped != 0U) ||
+	        export_failed || capture_failed || vdda_failed || async_failed || fft_failed) ? 1 : 0;
+}
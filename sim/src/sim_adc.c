@@ -0,0 +1,545 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_adc.c                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - ADC1 Model                                     ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Register-level model of the STM32G0 ADC following RM0454 chapter 14.                                     *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Conversion time from CKMODE/PRESC, SMP1/SMP2 (SMPSEL) and RES, input sampled at the end of the       *
+ *     sampling phase.                                                                                      *
+ *   - Offset error of SIM_Params_t.OffsetLsb, removed once CALFACT holds the calibration result.           *
+ *   - Data path: resolution, oversampling (OVSR/OVSS/TOVS), ALIGN, OVR with OVRMOD, DMA request,           *
+ *     WAIT (no new conversion until DR is read).                                                           *
+ *   - Write restrictions (CFGR1/SMPR/CHSELR with ADSTART = 1, RES and CFGR2 with ADEN = 1, CALFACT with    *
+ *     ADEN = 0) are reported through SIM_Violation().                                                      *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - AWD thresholds are compared with the 12-bit converter output.                                        *
+ *   - AUTOFF adds the power-up time (SIM_ADC_TSTAB_NS) before each scan; DISCEN is not modelled.           *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include "stm32g0xx_hal.h"
+#include <math.h>
+#include <string.h>
+
+#define SIM_ADC_IDLE         UINT64_MAX
+#define SIM_ADC_EXTSEL_TIM3  0x3UL                                //EXTSEL = 011: TIM3_TRGO
+
+/*
+ * Half ADC clock cycles: SMPx[2:0] and tCONV per RES[1:0]
+ */
+static const uint32_t smp_half[8]   = { 3U, 7U, 15U, 25U, 39U, 79U, 159U, 321U };
+static const uint32_t tconv_half[4] = { 25U, 21U, 17U, 13U };
+static const uint32_t presc_div[16] = { 1U, 2U, 4U, 6U, 8U, 10U, 12U, 16U, 32U, 64U, 128U, 256U, 256U, 256U, 256U, 256U };
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static struct {
+	uint32_t OffsetLsb;
+	uint64_t ReadyNs;                                             //ADEN -> ADRDY
+	uint64_t CalNs;                                               //ADCAL -> EOCAL
+	uint64_t ConvNs;                                              //End of the running conversion
+	uint64_t SampleNs;                                            //End of its sampling phase
+	bool     Running;                                             //ADSTART = 1
+	bool     Stalled;                                             //WAIT: next conversion waits for a DR read
+	uint8_t  Seq[SIM_ADC_CHANNELS];
+	uint32_t SeqLen;
+	uint32_t SeqIdx;
+	uint32_t OvsCount;
+	uint32_t OvsAcc;
+	bool     DmaBlocked;                                          //OVR with DMAEN: requests stop until cleared
+} adc;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_ClockHz()
+ * Purpose  : ADC kernel clock from CKMODE and PRESC
+ * Details  : Asynchronous clock = SYSCLK (ADCSEL reset value)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t SIM_ADC_ClockHz(void) {
+	uint32_t ckmode = (sim_adc1.CFGR2 & ADC_CFGR2_CKMODE) >> ADC_CFGR2_CKMODE_Pos;
+	uint32_t pclk   = HAL_RCC_GetPCLK1Freq();
+
+	switch (ckmode) {
+	case 1U:  return pclk / 2U;
+	case 2U:  return pclk / 4U;
+	case 3U:  return pclk;
+	default:  return SystemCoreClock / presc_div[(sim_adc_common.CCR & ADC_CCR_PRESC) >> ADC_CCR_PRESC_Pos];
+	}
+}
+
+static uint64_t SIM_ADC_HalfCyclesNs(uint32_t HalfCycles) {
+	return ((uint64_t)HalfCycles * 1000000000ULL) / (2ULL * SIM_ADC_ClockHz());
+}
+
+static uint32_t SIM_ADC_ResBits(void) {
+	return 12U - 2U * ((sim_adc1.CFGR1 & ADC_CFGR1_RES) >> ADC_CFGR1_RES_Pos);
+}
+
+static bool SIM_ADC_HwTrigger(void) {
+	return (sim_adc1.CFGR1 & ADC_CFGR1_EXTEN) != 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_BuildSequence()
+ * Purpose  : Conversion order latched at ADSTART
+ * Details  : CHSELRMOD = 0: CHSELR bits (SCANDIR)
+ *            CHSELRMOD = 1: SQ1..SQ8 up to the first 0xF
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_BuildSequence(void) {
+	uint32_t chselr = sim_adc1.CHSELR;
+
+	adc.SeqLen = 0;
+
+	if (sim_adc1.CFGR1 & ADC_CFGR1_CHSELRMOD) {
+		for (uint32_t i = 0; i < 8U; i++) {
+			uint32_t ch = (chselr >> (4U * i)) & 0xFU;
+
+			if (ch == 0xFU) {
+				break;
+			}
+			adc.Seq[adc.SeqLen++] = (uint8_t)ch;
+		}
+	} else if (sim_adc1.CFGR1 & ADC_CFGR1_SCANDIR) {
+		for (int32_t ch = (int32_t)SIM_ADC_CHANNELS - 1; ch >= 0; ch--) {
+			if (chselr & (1UL << ch)) {
+				adc.Seq[adc.SeqLen++] = (uint8_t)ch;
+			}
+		}
+	} else {
+		for (uint32_t ch = 0; ch < SIM_ADC_CHANNELS; ch++) {
+			if (chselr & (1UL << ch)) {
+				adc.Seq[adc.SeqLen++] = (uint8_t)ch;
+			}
+		}
+	}
+
+	adc.SeqIdx   = 0;
+	adc.OvsCount = 0;
+	adc.OvsAcc   = 0;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_StartConversion()
+ * Purpose  : Schedule sampling + conversion of Seq[SeqIdx]
+ * Details  : SMPSELx picks SMP2 for channel x. With AUTOFF the
+ *            ADC powers up first at the start of each scan
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_StartConversion(uint64_t Now) {
+	uint32_t ch, smp, res;
+
+	if (adc.SeqLen == 0U) {
+		SIM_Violation("ADSTART with an empty channel selection");
+		adc.Running = false;
+		sim_adc1.CR &= ~ADC_CR_ADSTART;
+		return;
+	}
+
+	ch  = adc.Seq[adc.SeqIdx];
+	smp = (sim_adc1.SMPR & (1UL << (ADC_SMPR_SMPSEL_Pos + ch))) ?
+	      ((sim_adc1.SMPR & ADC_SMPR_SMP2) >> ADC_SMPR_SMP2_Pos) :
+	      ((sim_adc1.SMPR & ADC_SMPR_SMP1) >> ADC_SMPR_SMP1_Pos);
+	res = (sim_adc1.CFGR1 & ADC_CFGR1_RES) >> ADC_CFGR1_RES_Pos;
+
+	if ((sim_adc1.CFGR1 & ADC_CFGR1_AUTOFF) && (adc.SeqIdx == 0U) && (adc.OvsCount == 0U)) {
+		Now += SIM_ADC_TSTAB_NS;                                  //Powered off since the last scan
+	}
+
+	adc.SampleNs = Now + SIM_ADC_HalfCyclesNs(smp_half[smp]);
+	adc.ConvNs   = Now + SIM_ADC_HalfCyclesNs(smp_half[smp] + tconv_half[res]);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Code12()
+ * Purpose  : 12-bit converter output for one channel
+ * Details  : Ideal code + offset - CALFACT, clamped. Ratio to
+ *            the present supply; internal channels read 0 V
+ *            while their CCR enable is off.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t SIM_ADC_Code12(uint32_t Channel, uint64_t SampleNs) {
+	uint32_t ccr   = sim_adc_common.CCR;
+	bool     off   = ((Channel == SIM_ADC_CH_VREFINT) && !(ccr & ADC_CCR_VREFEN)) ||
+	                 ((Channel == SIM_ADC_CH_TSENSE) && !(ccr & ADC_CCR_TSEN));
+	double   volts = off ? 0.0 : SIM_GetInput(Channel, SampleNs);
+	int32_t  code  = (int32_t)lround((volts / SIM_GetSupply()) * 4095.0);
+
+	code += (int32_t)adc.OffsetLsb - (int32_t)(sim_adc1.CALFACT & ADC_CALFACT_CALFACT);
+
+	if (code < 0) {
+		code = 0;
+	} else if (code > 4095) {
+		code = 4095;
+	}
+	return (uint32_t)code;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Watchdogs()
+ * Purpose  : AWD1..3 window check of one conversion
+ * Details  : AWD1: AWD1EN/AWD1SGL/AWD1CH, AWD2/3: AWDxCR mask
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_Watchdogs(uint32_t Channel, uint32_t Code12) {
+	uint32_t cfgr1 = sim_adc1.CFGR1;
+	const volatile uint32_t *tr[3] = { &sim_adc1.AWD1TR, &sim_adc1.AWD2TR, &sim_adc1.AWD3TR };
+	bool     watched[3];
+
+	watched[0] = (cfgr1 & ADC_CFGR1_AWD1EN) &&
+	             (!(cfgr1 & ADC_CFGR1_AWD1SGL) || (((cfgr1 & ADC_CFGR1_AWD1CH) >> ADC_CFGR1_AWD1CH_Pos) == Channel));
+	watched[1] = (sim_adc1.AWD2CR & (1UL << Channel)) != 0U;
+	watched[2] = (sim_adc1.AWD3CR & (1UL << Channel)) != 0U;
+
+	for (uint32_t i = 0; i < 3U; i++) {
+		uint32_t low  = *tr[i] & 0xFFFU;
+		uint32_t high = (*tr[i] >> 16) & 0xFFFU;
+
+		if (watched[i] && ((Code12 < low) || (Code12 > high))) {
+			sim_adc1.ISR |= (ADC_ISR_AWD1 << i);
+		}
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Deliver()
+ * Purpose  : Move one result to DR, raise EOC / OVR, DMA
+ * Details  : DR not read since the last EOC -> OVR
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_Deliver(uint32_t Result) {
+	bool dmaen = (sim_adc1.CFGR1 & ADC_CFGR1_DMAEN) != 0U;
+
+	sim_stats.Conversions++;
+
+	if (sim_adc1.ISR & ADC_ISR_EOC) {
+		sim_adc1.ISR |= ADC_ISR_OVR;
+		sim_stats.Overruns++;
+		if (dmaen) {
+			adc.DmaBlocked = true;
+		}
+		if (!(sim_adc1.CFGR1 & ADC_CFGR1_OVRMOD)) {
+			return;                                               //OVRMOD = 0: old data kept
+		}
+	}
+
+	sim_adc1.DR   = Result;
+	sim_adc1.ISR |= ADC_ISR_EOC;
+
+	if (dmaen && !adc.DmaBlocked && SIM_DMA_Request(SIM_DMAMUX_REQ_ADC, Result)) {
+		sim_adc1.ISR &= ~ADC_ISR_EOC;                             //DMA read DR
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Continue()
+ * Purpose  : What follows a finished conversion
+ * Details  : Next channel, next scan (CONT), wait for trigger,
+ *            or stop (single mode clears ADSTART)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_Continue(uint64_t Now) {
+
+	adc.ConvNs = SIM_ADC_IDLE;
+
+	if (adc.SeqIdx != 0U) {
+		SIM_ADC_StartConversion(Now);                             //Rest of the scan runs back to back
+		return;
+	}
+
+	if (SIM_ADC_HwTrigger()) {
+		return;                                                   //Armed for the next trigger
+	}
+
+	if (sim_adc1.CFGR1 & ADC_CFGR1_CONT) {
+		SIM_ADC_StartConversion(Now);
+		return;
+	}
+
+	adc.Running  = false;
+	sim_adc1.CR &= ~ADC_CR_ADSTART;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_EndOfConversion()
+ * Purpose  : Conversion event: data path and sequencing
+ * Details  : Oversampling accumulates before anything is
+ *            delivered; TOVS waits for a trigger per sample
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_EndOfConversion(uint64_t Now) {
+	uint32_t cfgr2  = sim_adc1.CFGR2;
+	uint32_t ch     = adc.Seq[adc.SeqIdx];
+	uint32_t code12 = SIM_ADC_Code12(ch, adc.SampleNs);
+	uint32_t bits   = SIM_ADC_ResBits();
+	uint32_t result = code12 >> (12U - bits);
+
+	SIM_ADC_Watchdogs(ch, code12);
+
+	if (cfgr2 & ADC_CFGR2_OVSE) {
+		uint32_t ratio = 2UL << ((cfgr2 & ADC_CFGR2_OVSR) >> ADC_CFGR2_OVSR_Pos);
+
+		adc.OvsAcc += result;
+		if (++adc.OvsCount < ratio) {
+			adc.ConvNs = SIM_ADC_IDLE;
+			if (!((cfgr2 & ADC_CFGR2_TOVS) && SIM_ADC_HwTrigger())) {
+				SIM_ADC_StartConversion(Now);
+			}
+			return;
+		}
+		result       = adc.OvsAcc >> ((cfgr2 & ADC_CFGR2_OVSS) >> ADC_CFGR2_OVSS_Pos);
+		adc.OvsAcc   = 0;
+		adc.OvsCount = 0;
+	} else if (sim_adc1.CFGR1 & ADC_CFGR1_ALIGN) {
+		result <<= (bits == 6U) ? 2U : (16U - bits);              //6-bit left alignment is byte-aligned
+	}
+
+	SIM_ADC_Deliver(result & ADC_DR_DATA);
+
+	if (++adc.SeqIdx >= adc.SeqLen) {
+		adc.SeqIdx    = 0;
+		sim_adc1.ISR |= ADC_ISR_EOS;
+		sim_stats.Sequences++;
+	}
+
+	if ((sim_adc1.CFGR1 & ADC_CFGR1_WAIT) && (sim_adc1.ISR & ADC_ISR_EOC)) {
+		adc.ConvNs  = SIM_ADC_IDLE;
+		adc.Stalled = true;                                       //Resumes on the DR read
+		return;
+	}
+
+	SIM_ADC_Continue(Now);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL INTERFACE                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_ADC_Reset(const SIM_Params_t *pParams) {
+
+	memset(&adc, 0, sizeof(adc));
+	adc.OffsetLsb = (pParams->OffsetLsb > ADC_CALFACT_CALFACT) ? ADC_CALFACT_CALFACT : pParams->OffsetLsb;
+	adc.ReadyNs   = SIM_ADC_IDLE;
+	adc.CalNs     = SIM_ADC_IDLE;
+	adc.ConvNs    = SIM_ADC_IDLE;
+}
+
+uint64_t SIM_ADC_NextEvent(void) {
+	uint64_t next = adc.ConvNs;
+
+	if (adc.ReadyNs < next) {
+		next = adc.ReadyNs;
+	}
+	if (adc.CalNs < next) {
+		next = adc.CalNs;
+	}
+	return next;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Event()
+ * Purpose  : Run every ADC event due at Now
+ * Details  : Calibration end, ADRDY, end of conversion
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_ADC_Event(uint64_t Now) {
+
+	if (adc.CalNs <= Now) {
+		adc.CalNs         = SIM_ADC_IDLE;
+		sim_adc1.CALFACT  = adc.OffsetLsb;                        //Calibration measures the offset
+		sim_adc1.CR      &= ~ADC_CR_ADCAL;
+		sim_adc1.ISR     |= ADC_ISR_EOCAL;
+	}
+
+	if (adc.ReadyNs <= Now) {
+		adc.ReadyNs = SIM_ADC_IDLE;
+		if (sim_adc1.CR & ADC_CR_ADEN) {
+			sim_adc1.ISR |= ADC_ISR_ADRDY;
+		}
+	}
+
+	if (adc.ConvNs <= Now) {
+		SIM_ADC_EndOfConversion(Now);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Trigger()
+ * Purpose  : TIM3 TRGO rising edge
+ * Details  : Starts a scan when armed, ignored while one runs
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_ADC_Trigger(uint64_t Now) {
+	uint32_t extsel = (sim_adc1.CFGR1 & ADC_CFGR1_EXTSEL) >> ADC_CFGR1_EXTSEL_Pos;
+
+	if (!adc.Running || !SIM_ADC_HwTrigger() || (extsel != SIM_ADC_EXTSEL_TIM3)) {
+		return;
+	}
+
+	sim_stats.Triggers++;
+	if ((adc.ConvNs != SIM_ADC_IDLE) || adc.Stalled) {
+		sim_stats.MissedTriggers++;
+		return;
+	}
+	SIM_ADC_StartConversion(Now);
+}
+
+bool SIM_ADC_IrqLine(void) {
+	return (sim_adc1.ISR & sim_adc1.IER) != 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Read()
+ * Purpose  : Read side effects
+ * Details  : DR clears EOC, releases a WAIT stall
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t SIM_ADC_Read(volatile const uint32_t *pReg) {
+	uint32_t value = *pReg;
+
+	if (pReg == &sim_adc1.DR) {
+		sim_adc1.ISR &= ~ADC_ISR_EOC;
+		if (adc.Stalled) {
+			adc.Stalled = false;
+			SIM_ADC_Continue(SIM_GetTimeNs());
+		}
+	}
+	return value;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_WriteCR()
+ * Purpose  : ADC_CR control bits
+ * Details  : ADEN/ADDIS/ADSTART/ADSTP/ADCAL are set-only,
+ *            writing 0 has no effect
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_ADC_WriteCR(uint32_t Old, uint32_t Value) {
+	uint64_t now = SIM_GetTimeNs();
+	uint32_t set = Value & ~Old;
+	uint32_t cr  = (Old & ~ADC_CR_ADVREGEN) | (Value & ADC_CR_ADVREGEN);
+
+	if (set & ADC_CR_ADCAL) {
+		if ((Old & ADC_CR_ADEN) || !(Value & ADC_CR_ADVREGEN) || (sim_adc1.CFGR1 & ADC_CFGR1_DMAEN)) {
+			SIM_Violation("ADCAL needs ADEN = 0, ADVREGEN = 1, DMAEN = 0 (ignored)");
+		} else {
+			cr       |= ADC_CR_ADCAL;
+			adc.CalNs = now + SIM_ADC_HalfCyclesNs(2U * SIM_ADC_TCAL_CYCLES);
+		}
+	}
+
+	if (set & ADC_CR_ADEN) {
+		if ((cr & ADC_CR_ADCAL) || !(cr & ADC_CR_ADVREGEN)) {
+			SIM_Violation("ADEN during calibration or with ADVREGEN = 0 (ignored)");
+		} else {
+			cr         |= ADC_CR_ADEN;
+			adc.ReadyNs = now + SIM_ADC_TSTAB_NS;
+		}
+	}
+
+	if ((set & ADC_CR_ADSTP) && (cr & ADC_CR_ADSTART)) {
+		cr         &= ~ADC_CR_ADSTART;                            //Conversion aborted, ADSTP self-clears
+		adc.Running = false;
+		adc.Stalled = false;
+		adc.ConvNs  = SIM_ADC_IDLE;
+	}
+
+	if (set & ADC_CR_ADDIS) {
+		if (cr & ADC_CR_ADSTART) {
+			SIM_Violation("ADDIS with ADSTART = 1 (ignored)");
+		} else {
+			cr         &= ~ADC_CR_ADEN;
+			adc.ReadyNs = SIM_ADC_IDLE;
+		}
+	}
+
+	if ((set & ADC_CR_ADSTART) && !(cr & ADC_CR_ADSTART)) {
+		if (!(cr & ADC_CR_ADEN) || (adc.ReadyNs != SIM_ADC_IDLE)) {
+			SIM_Violation("ADSTART before ADRDY (ignored)");
+		} else {
+			cr            |= ADC_CR_ADSTART;
+			adc.Running    = true;
+			adc.Stalled    = false;
+			adc.DmaBlocked = false;
+			SIM_ADC_BuildSequence();
+			if (!SIM_ADC_HwTrigger()) {
+				SIM_ADC_StartConversion(now);
+			}
+		}
+	}
+
+	sim_adc1.CR = cr;
+	if (!adc.Running) {
+		sim_adc1.CR &= ~ADC_CR_ADSTART;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ADC_Write()
+ * Purpose  : Register write with RM0454 access rules
+ * Details  : ISR is write-1-to-clear, DR is read-only
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_ADC_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value) {
+	bool adstart = (sim_adc1.CR & ADC_CR_ADSTART) != 0U;
+	bool aden    = (sim_adc1.CR & ADC_CR_ADEN) != 0U;
+
+	if (pReg == &sim_adc1.ISR) {
+		*pReg = Old & ~Value;
+		if (Value & ADC_ISR_OVR) {
+			adc.DmaBlocked = false;
+		}
+		if ((Value & ADC_ISR_EOC) && adc.Stalled) {
+			adc.Stalled = false;
+			SIM_ADC_Continue(SIM_GetTimeNs());
+		}
+	} else if (pReg == &sim_adc1.CR) {
+		SIM_ADC_WriteCR(Old, Value);
+	} else if (pReg == &sim_adc1.DR) {
+		SIM_Violation("ADC_DR is read-only");
+	} else if ((pReg == &sim_adc1.CFGR1) || (pReg == &sim_adc1.SMPR) || (pReg == &sim_adc1.CHSELR)) {
+		if (adstart) {
+			SIM_Violation("CFGR1/SMPR/CHSELR written with ADSTART = 1 (ignored)");
+			return;
+		}
+		if ((pReg == &sim_adc1.CFGR1) && aden && ((Old ^ Value) & ADC_CFGR1_RES)) {
+			SIM_Violation("CFGR1.RES changed with ADEN = 1 (ignored)");
+			return;
+		}
+		*pReg = Value;
+		if (pReg == &sim_adc1.CHSELR) {
+			sim_adc1.ISR |= ADC_ISR_CCRDY;
+		}
+	} else if (pReg == &sim_adc1.CFGR2) {
+		if (aden) {
+			SIM_Violation("CFGR2 written with ADEN = 1 (ignored)");
+			return;
+		}
+		*pReg = Value;
+	} else if (pReg == &sim_adc1.CALFACT) {
+		if (!aden || adstart) {
+			SIM_Violation("CALFACT written without ADEN = 1, ADSTART = 0 (ignored)");
+			return;
+		}
+		*pReg = Value & ADC_CALFACT_CALFACT;
+	} else {
+		*pReg = Value;
+	}
+}
@@ -0,0 +1,621 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_core.c                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Time Base, Register Bus, NVIC, SysTick, HAL    ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Discrete-event core of the simulator. Owns the simulated clock, routes register accesses to the          *
+ * peripheral models and dispatches interrupt handlers.                                                     *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - SIM_Periph(): every peripheral access advances time by SIM_ACCESS_NS and runs due events.            *
+ *   - Interrupt lines are level-triggered and re-evaluated after every event and every access, a           *
+ *     handler only preempts code running at a lower priority (numerically higher).                         *
+ *   - HAL_GetTick() / TimeOut() / HAL_Delay() run on simulated time.                                       *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - A handler that never clears its flag re-enters forever on the target: here it aborts after           *
+ *     SIM_IRQ_STORM back-to-back entries of the same line.                                                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include "main.h"
+#include "helpers.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_IN(p, regs)      (((uintptr_t)(p) >= (uintptr_t)&(regs)) && \
+                              ((uintptr_t)(p) <  (uintptr_t)&(regs) + sizeof(regs)))
+#define SIM_IRQ_STORM        100000U                              //Back-to-back entries of one line
+#define SIM_PRIO_THREAD      0x100U                               //Below every NVIC priority
+#define SIM_VIOLATIONS_SHOWN 16U
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           REGISTER FILES                                                 */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+ADC_TypeDef             sim_adc1;
+ADC_Common_TypeDef      sim_adc_common;
+DMA_TypeDef             sim_dma1;
+DMA_Channel_TypeDef     sim_dma1_ch[5];
+DMAMUX_Channel_TypeDef  sim_dmamux1_ch[5];
+RCC_TypeDef             sim_rcc;
+TIM_TypeDef             sim_tim3;
+SysTick_Type            sim_systick;
+SCB_Type                sim_scb;
+PWR_TypeDef             sim_pwr;
+TAMP_TypeDef            sim_tamp;
+USART_TypeDef           sim_usart2;
+GPIO_TypeDef            sim_gpioa;
+EXTI_TypeDef            sim_exti;
+
+const uint16_t          sim_vrefint_cal = SIM_VREFINT_CAL;
+const uint16_t          sim_ts_cal1     = SIM_TS_CAL1;
+
+uint32_t                SystemCoreClock = SIM_SYSCLK_HZ;
+SIM_Stats_t             sim_stats;
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CORE STATE                                                     */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint64_t sim_now_ns;
+static uint64_t systick_ref_ns;                                   //Time VAL was last reloaded
+static uint32_t primask;
+static uint32_t active_prio = SIM_PRIO_THREAD;
+
+static struct {
+	bool    Enabled;
+	uint8_t Priority;
+} nvic[SIM_IRQ_COUNT];
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           DEFAULT HANDLERS                                               */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static void SIM_Unhandled(IRQn_Type IRQn) {
+	fprintf(stderr, "sim: IRQ %d enabled and pending but no handler is linked\n", (int)IRQn);
+	abort();
+}
+
+__attribute__((weak)) void EXTI0_1_IRQHandler(void)               { SIM_Unhandled(EXTI0_1_IRQn); }
+__attribute__((weak)) void EXTI2_3_IRQHandler(void)               { SIM_Unhandled(EXTI2_3_IRQn); }
+__attribute__((weak)) void EXTI4_15_IRQHandler(void)              { SIM_Unhandled(EXTI4_15_IRQn); }
+__attribute__((weak)) void DMA1_Channel1_IRQHandler(void)         { SIM_Unhandled(DMA1_Channel1_IRQn); }
+__attribute__((weak)) void DMA1_Channel2_3_IRQHandler(void)       { SIM_Unhandled(DMA1_Channel2_3_IRQn); }
+__attribute__((weak)) void DMA1_Ch4_5_DMAMUX1_OVR_IRQHandler(void){ SIM_Unhandled(DMA1_Ch4_5_DMAMUX1_OVR_IRQn); }
+__attribute__((weak)) void ADC1_IRQHandler(void)                  { SIM_Unhandled(ADC1_IRQn); }
+__attribute__((weak)) void TIM3_IRQHandler(void)                  { SIM_Unhandled(TIM3_IRQn); }
+__attribute__((weak)) void USART2_IRQHandler(void)                { SIM_Unhandled(USART2_IRQn); }
+
+__attribute__((weak)) void Error_Handler(void) {
+	fprintf(stderr, "sim: Error_Handler() at t = %llu ns\n", (unsigned long long)sim_now_ns);
+	abort();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_IrqLine()
+ * Purpose  : Level of one NVIC input
+ * Details  : Shared lines OR their sources
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool SIM_IrqLine(uint32_t IRQn) {
+	uint32_t exti = (sim_exti.RPR1 | sim_exti.FPR1) & sim_exti.IMR1;
+
+	switch (IRQn) {
+	case EXTI0_1_IRQn:                return (exti & 0x0003U) != 0U;
+	case EXTI2_3_IRQn:                return (exti & 0x000CU) != 0U;
+	case EXTI4_15_IRQn:               return (exti & 0xFFF0U) != 0U;
+	case DMA1_Channel1_IRQn:          return SIM_DMA_IrqLine(0);
+	case DMA1_Channel2_3_IRQn:        return SIM_DMA_IrqLine(1) || SIM_DMA_IrqLine(2);
+	case DMA1_Ch4_5_DMAMUX1_OVR_IRQn: return SIM_DMA_IrqLine(3) || SIM_DMA_IrqLine(4);
+	case ADC1_IRQn:                   return SIM_ADC_IrqLine();
+	case TIM3_IRQn:                   return SIM_TIM_IrqLine();
+	case USART2_IRQn:                 return SIM_USART_IrqLine();
+	default:                          return false;
+	}
+}
+
+static void SIM_CallHandler(uint32_t IRQn) {
+
+	switch (IRQn) {
+	case EXTI0_1_IRQn:                EXTI0_1_IRQHandler();                break;
+	case EXTI2_3_IRQn:                EXTI2_3_IRQHandler();                break;
+	case EXTI4_15_IRQn:               EXTI4_15_IRQHandler();               break;
+	case DMA1_Channel1_IRQn:          DMA1_Channel1_IRQHandler();          break;
+	case DMA1_Channel2_3_IRQn:        DMA1_Channel2_3_IRQHandler();        break;
+	case DMA1_Ch4_5_DMAMUX1_OVR_IRQn: DMA1_Ch4_5_DMAMUX1_OVR_IRQHandler(); break;
+	case ADC1_IRQn:                   ADC1_IRQHandler();                   break;
+	case TIM3_IRQn:                   TIM3_IRQHandler();                   break;
+	case USART2_IRQn:                 USART2_IRQHandler();                 break;
+	default:                          SIM_Unhandled((IRQn_Type)IRQn);      break;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Dispatch()
+ * Purpose  : Run every handler allowed to preempt right now
+ * Details  : Highest priority (lowest number, then IRQn) first
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_Dispatch(void) {
+	int32_t  last  = -1;
+	uint32_t storm = 0;
+
+	while (!primask) {
+		int32_t best = -1;
+
+		for (uint32_t irq = 0; irq < SIM_IRQ_COUNT; irq++) {
+			if (nvic[irq].Enabled && (nvic[irq].Priority < active_prio) && SIM_IrqLine(irq) &&
+			    ((best < 0) || (nvic[irq].Priority < nvic[best].Priority))) {
+				best = (int32_t)irq;
+			}
+		}
+		if (best < 0) {
+			return;
+		}
+
+		storm = (best == last) ? (storm + 1U) : 0U;
+		last  = best;
+		if (storm > SIM_IRQ_STORM) {
+			fprintf(stderr, "sim: IRQ %d re-entered %u times back to back (flag never cleared?)\n",
+			        (int)best, SIM_IRQ_STORM);
+			abort();
+		}
+
+		uint32_t saved = active_prio;
+		active_prio = nvic[best].Priority;
+		sim_stats.Irqs[best]++;
+		SIM_CallHandler((uint32_t)best);
+		active_prio = saved;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_NextEvent()
+ * Purpose  : Earliest scheduled peripheral event
+ * Details  : UINT64_MAX when nothing is scheduled
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint64_t SIM_NextEvent(void) {
+	uint64_t adc   = SIM_ADC_NextEvent();
+	uint64_t tim   = SIM_TIM_NextEvent();
+	uint64_t usart = SIM_USART_NextEvent();
+	uint64_t next  = (adc < tim) ? adc : tim;
+
+	return (usart < next) ? usart : next;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_AdvanceTo()
+ * Purpose  : Move simulated time forward, running events
+ * Details  : Re-entrant: handlers dispatched from here access
+ *            registers, which advance time again
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_AdvanceTo(uint64_t Target) {
+
+	for (;;) {
+		uint64_t next = SIM_NextEvent();
+
+		if (next > Target) {
+			break;
+		}
+		if (next > sim_now_ns) {
+			sim_now_ns = next;
+		}
+		SIM_TIM_Event(sim_now_ns);                                //Timer first: TRGO may start a conversion
+		SIM_ADC_Event(sim_now_ns);
+		SIM_USART_Event(sim_now_ns);
+		SIM_Dispatch();
+	}
+
+	if (sim_now_ns < Target) {
+		sim_now_ns = Target;
+	}
+	SIM_Dispatch();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Violation()
+ * Purpose  : Report an access the reference manual forbids
+ * Details  : First SIM_VIOLATIONS_SHOWN are printed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_Violation(const char *pWhat) {
+
+	if (sim_stats.Violations++ < SIM_VIOLATIONS_SHOWN) {
+		fprintf(stderr, "sim: t = %llu ns: %s\n", (unsigned long long)sim_now_ns, pWhat);
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           REGISTER BUS                                                   */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SysTick_Update()
+ * Purpose  : Derive VAL / COUNTFLAG from simulated time
+ * Details  : Counts SystemCoreClock cycles down from LOAD
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SysTick_Update(void) {
+
+	if (!(sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk)) {
+		return;
+	}
+
+	uint64_t period = (uint64_t)(sim_systick.LOAD & SysTick_LOAD_RELOAD_Msk) + 1U;
+	uint64_t cycles = ((sim_now_ns - systick_ref_ns) * SystemCoreClock) / 1000000000ULL;
+
+	if (cycles >= period) {
+		sim_systick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+	}
+	sim_systick.VAL = (uint32_t)(period - 1U - (cycles % period));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SysTick_NextWrapNs()
+ * Purpose  : Time of the next SysTick exception
+ * Details  : UINT64_MAX unless ENABLE and TICKINT are set
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint64_t SysTick_NextWrapNs(void) {
+	const uint32_t on = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+
+	if ((sim_systick.CTRL & on) != on) {
+		return UINT64_MAX;
+	}
+
+	uint64_t period = (uint64_t)(sim_systick.LOAD & SysTick_LOAD_RELOAD_Msk) + 1U;
+	uint64_t cycles = ((sim_now_ns - systick_ref_ns) * SystemCoreClock) / 1000000000ULL;
+	uint64_t wrap   = (cycles / period + 1U) * period;
+
+	return systick_ref_ns + (wrap / SystemCoreClock) * 1000000000ULL +
+	       ((wrap % SystemCoreClock) * 1000000000ULL + SystemCoreClock - 1U) / SystemCoreClock;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Periph()
+ * Purpose  : Resolve a peripheral macro (ADC1, DMA1, ...)
+ * Details  : Charges one bus access, runs due events and
+ *            pending interrupts
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void *SIM_Periph(volatile void *pRegs) {
+
+	sim_stats.RegisterAccesses++;
+	SIM_AdvanceTo(sim_now_ns + SIM_ACCESS_NS);
+
+	if (pRegs == (volatile void *)&sim_systick) {
+		SysTick_Update();
+	}
+
+	return (void *)pRegs;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_ReadReg()
+ * Purpose  : READ_REG() with read side effects
+ * Details  : ADC_DR read clears EOC
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t SIM_ReadReg(volatile const uint32_t *pReg) {
+
+	if (SIM_IN(pReg, sim_adc1)) {
+		return SIM_ADC_Read(pReg);
+	}
+	if ((pReg == &sim_systick.CTRL) && (sim_systick.CTRL & SysTick_CTRL_COUNTFLAG_Msk)) {
+		uint32_t value = sim_systick.CTRL;
+
+		sim_systick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;      //Cleared by reading
+		return value;
+	}
+
+	return *pReg;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_WriteReg()
+ * Purpose  : WRITE_REG() routed to the owning model
+ * Details  : Unknown addresses are plain stores
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_WriteReg(volatile uint32_t *pReg, uint32_t Value) {
+	uint32_t old = *pReg;
+
+	if (SIM_IN(pReg, sim_adc1)) {
+		if (!(sim_rcc.APBENR2 & RCC_APBENR2_ADCEN)) {
+			return;                                               //Unclocked peripheral: write lost
+		}
+		SIM_ADC_Write(pReg, old, Value);
+	} else if (SIM_IN(pReg, sim_dma1) || SIM_IN(pReg, sim_dma1_ch) || SIM_IN(pReg, sim_dmamux1_ch)) {
+		if (!(sim_rcc.AHBENR & RCC_AHBENR_DMA1EN)) {
+			return;
+		}
+		SIM_DMA_Write(pReg, old, Value);
+		SIM_USART_DmaChanged();                                   //A TX channel may just have been enabled
+	} else if (SIM_IN(pReg, sim_tim3)) {
+		if (!(sim_rcc.APBENR1 & RCC_APBENR1_TIM3EN)) {
+			return;
+		}
+		SIM_TIM_Write(pReg, old, Value);
+	} else if (SIM_IN(pReg, sim_usart2)) {
+		if (!(sim_rcc.APBENR1 & RCC_APBENR1_USART2EN)) {
+			return;
+		}
+		SIM_USART_Write(pReg, old, Value);
+	} else if (SIM_IN(pReg, sim_gpioa)) {
+		if (!(sim_rcc.IOPENR & RCC_IOPENR_GPIOAEN)) {
+			return;
+		}
+		*pReg = Value;
+	} else if ((pReg == &sim_exti.RPR1) || (pReg == &sim_exti.FPR1)) {
+		*pReg = old & ~Value;                                     //Write 1 to clear
+	} else if (pReg == &sim_exti.SWIER1) {
+		sim_exti.RPR1 |= Value & 0xFFFFU;                         //Software rising edge, reads as 0
+	} else if (SIM_IN(pReg, sim_tamp)) {
+		if (!(sim_pwr.CR1 & PWR_CR1_DBP)) {
+			SIM_Violation("TAMP backup register write with PWR DBP = 0 (ignored)");
+			return;
+		}
+		*pReg = Value;
+	} else if ((pReg == &sim_systick.VAL)) {
+		sim_systick.VAL = 0;                                      //Any write clears VAL and COUNTFLAG
+		sim_systick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+		systick_ref_ns = sim_now_ns;
+	} else if ((pReg == &sim_systick.CTRL) && (Value & ~old & SysTick_CTRL_ENABLE_Msk)) {
+		*pReg = Value;
+		systick_ref_ns = sim_now_ns;
+	} else {
+		*pReg = Value;
+	}
+
+	SIM_Dispatch();                                               //Newly raised flags take effect
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CONTROL                                                        */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Reset()
+ * Purpose  : Power-on / warm reset of the simulated MCU
+ * Details  : NULL -> cold start with default parameters
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_Reset(const SIM_Params_t *pParams) {
+	static const SIM_Params_t defaults = { .OffsetLsb = 6U, .Seed = 1U, .ColdStart = true };
+
+	if (pParams == NULL) {
+		pParams = &defaults;
+	}
+
+	if ((uintptr_t)&sim_adc1 > UINT32_MAX) {
+		fprintf(stderr, "sim: register files above 4 GB, DMA addresses would be truncated: link with -no-pie\n");
+		abort();
+	}
+
+	memset(&sim_adc1, 0, sizeof(sim_adc1));
+	memset(&sim_adc_common, 0, sizeof(sim_adc_common));
+	memset(&sim_rcc, 0, sizeof(sim_rcc));
+	memset(&sim_systick, 0, sizeof(sim_systick));
+	memset(&sim_scb, 0, sizeof(sim_scb));
+	memset(&sim_pwr, 0, sizeof(sim_pwr));
+	memset(&sim_gpioa, 0, sizeof(sim_gpioa));
+	memset(&sim_exti, 0, sizeof(sim_exti));
+	if (pParams->ColdStart) {
+		memset(&sim_tamp, 0, sizeof(sim_tamp));
+	}
+	memset(&sim_stats, 0, sizeof(sim_stats));
+	memset(nvic, 0, sizeof(nvic));
+
+	sim_now_ns      = 0;
+	systick_ref_ns  = 0;
+	primask         = 0;
+	active_prio     = SIM_PRIO_THREAD;
+	SystemCoreClock = SIM_SYSCLK_HZ;
+
+	SIM_ADC_Reset(pParams);
+	SIM_DMA_Reset();
+	SIM_TIM_Reset();
+	SIM_USART_Reset();
+	SIM_Wave_Reset(pParams->Seed);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Run()
+ * Purpose  : Let the peripherals run for DurationNs
+ * Details  : Interrupt handlers run as events fire
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_Run(uint64_t DurationNs) {
+	SIM_AdvanceTo(sim_now_ns + DurationNs);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_EXTI_Edge()
+ * Purpose  : Edge on the GPIO routed to EXTI line Line
+ * Details  : Sets RPR1/FPR1 when RTSR1/FTSR1 select the edge,
+ *            the handler runs at once if IMR1 lets it through
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_EXTI_Edge(uint32_t Line, bool Rising) {
+	uint32_t bit = 1UL << Line;
+
+	if (Rising && (sim_exti.RTSR1 & bit)) {
+		sim_exti.RPR1 |= bit;
+	} else if (!Rising && (sim_exti.FTSR1 & bit)) {
+		sim_exti.FPR1 |= bit;
+	}
+	SIM_Dispatch();
+}
+
+uint64_t SIM_GetTimeNs(void) {
+	return sim_now_ns;
+}
+
+void SIM_GetStats(SIM_Stats_t *pStats) {
+	*pStats = sim_stats;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CORE INTRINSICS                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_DisableIRQ(void) {
+	primask = 1U;
+}
+
+void SIM_EnableIRQ(void) {
+	primask = 0U;
+	SIM_Dispatch();                                               //Pending lines are taken right away
+}
+
+uint32_t SIM_GetPRIMASK(void) {
+	return primask;
+}
+
+void SIM_SetPRIMASK(uint32_t PriMask) {
+	primask = PriMask & 1U;
+	SIM_Dispatch();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_WaitForInterrupt()
+ * Purpose  : __WFI(): sleep until a handler has run
+ * Details  : With PRIMASK set, wakes on a pending line without
+ *            running it. The SysTick exception wakes it too
+ *            (not in Stop). Nothing scheduled -> 1 ms passes.
+ *            Stop (SLEEPDEEP) with the ADC, DMA or TIM3 still
+ *            running is reported: they halt on the device.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_WaitForInterrupt(void) {
+	uint64_t taken = 0;
+	bool     stop  = (sim_scb.SCR & SCB_SCR_SLEEPDEEP_Msk) != 0U;
+
+	if (stop && ((sim_adc1.CR & ADC_CR_ADSTART) || (sim_dma1_ch[0].CCR & DMA_CCR_EN) || (sim_tim3.CR1 & TIM_CR1_CEN))) {
+		SIM_Violation("Stop mode entered with ADC/DMA/TIM3 active (acquisition halts on the device)");
+	}
+
+	for (uint32_t irq = 0; irq < SIM_IRQ_COUNT; irq++) {
+		taken += sim_stats.Irqs[irq];
+	}
+
+	for (;;) {
+		uint64_t next = SIM_NextEvent();
+		uint64_t tick = stop ? UINT64_MAX : SysTick_NextWrapNs();
+		uint64_t now_taken = 0;
+
+		if ((tick != UINT64_MAX) && (next > tick)) {
+			SIM_AdvanceTo(tick);                                  //SysTick_Handler: HAL_IncTick()
+			return;
+		}
+		if (next == UINT64_MAX) {
+			SIM_AdvanceTo(sim_now_ns + 1000000ULL);
+			return;
+		}
+		SIM_AdvanceTo((next > sim_now_ns) ? next : sim_now_ns);
+
+		for (uint32_t irq = 0; irq < SIM_IRQ_COUNT; irq++) {
+			now_taken += sim_stats.Irqs[irq];
+			if (primask && nvic[irq].Enabled && SIM_IrqLine(irq)) {
+				return;
+			}
+		}
+		if (now_taken != taken) {
+			return;
+		}
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           HAL SUBSET                                                     */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+HAL_StatusTypeDef HAL_Init(void) {
+
+	sim_systick.LOAD = (SystemCoreClock / 1000U) - 1U;            //1 ms tick at HCLK, as HAL_InitTick()
+	sim_systick.VAL  = 0;
+	sim_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+	systick_ref_ns   = sim_now_ns;
+
+	return HAL_OK;
+}
+
+uint32_t HAL_GetTick(void) {
+	SIM_AdvanceTo(sim_now_ns + SIM_ACCESS_NS);                    //Polling uwTick costs time too
+	return (uint32_t)(sim_now_ns / 1000000ULL);
+}
+
+void HAL_IncTick(void) {
+}
+
+void HAL_Delay(uint32_t Delay) {
+	SIM_AdvanceTo(sim_now_ns + (uint64_t)Delay * 1000000ULL);
+}
+
+void TimeOut(uint32_t ms) {
+	SIM_AdvanceTo(sim_now_ns + (uint64_t)ms * 1000000ULL);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) {
+	(void)SubPriority;                                            //Cortex-M0+: no sub-priority
+
+	if ((IRQn >= 0) && ((uint32_t)IRQn < SIM_IRQ_COUNT)) {
+		nvic[IRQn].Priority = (uint8_t)(PreemptPriority & 0x3U);
+	}
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn) {
+
+	if ((IRQn >= 0) && ((uint32_t)IRQn < SIM_IRQ_COUNT)) {
+		nvic[IRQn].Enabled = true;
+		SIM_Dispatch();
+	}
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn) {
+
+	if ((IRQn >= 0) && ((uint32_t)IRQn < SIM_IRQ_COUNT)) {
+		nvic[IRQn].Enabled = false;
+	}
+}
+
+uint32_t HAL_RCC_GetSysClockFreq(void) {
+	return SystemCoreClock;
+}
+
+uint32_t HAL_RCC_GetHCLKFreq(void) {
+	return SystemCoreClock;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : HAL_RCC_GetPCLK1Freq()
+ * Purpose  : APB clock from RCC_CFGR.PPRE
+ * Details  : 0xx: /1, 100: /2 ... 111: /16
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t HAL_RCC_GetPCLK1Freq(void) {
+	uint32_t ppre = (sim_rcc.CFGR & RCC_CFGR_PPRE) >> RCC_CFGR_PPRE_Pos;
+
+	return (ppre & 0x4U) ? (SystemCoreClock >> ((ppre & 0x3U) + 1U)) : SystemCoreClock;
+}
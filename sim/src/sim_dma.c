@@ -0,0 +1,249 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_dma.c                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - DMA1 + DMAMUX Model                            ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Model of DMA1 channels 1..5, fed by DMAMUX1 request lines: peripheral-to-memory (ADC) and               *
+ * memory-to-peripheral (USART2 TX).                                                                        *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - DMAMUX1 channel n routes its DMAREQ_ID to DMA1 channel n + 1.                                        *
+ *   - MSIZE 8/16/32-bit stores / loads at CMAR (+ index with MINC), CNDTR count-down, CIRC reload.         *
+ *   - HTIF after half of the programmed count, TCIF at the end, TEIF (and EN = 0) when CPAR is not the     *
+ *     requesting peripheral's data register, DIR does not match the request or CMAR is 0.                  *
+ *   - CNDTR/CPAR/CMAR writes with EN = 1 are ignored and reported, as on the device.                       *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include <string.h>
+
+#define SIM_DMA_CHANNELS     5U
+#define SIM_DMA_FLAGS        (DMA_ISR_TCIF1 | DMA_ISR_HTIF1 | DMA_ISR_TEIF1)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static struct {
+	uint32_t Reload;                                              //CNDTR latched at EN
+	uint32_t Index;                                               //Items moved since the last reload
+} dma[SIM_DMA_CHANNELS];
+
+static void SIM_DMA_SetFlags(uint32_t Channel, uint32_t Flags) {
+	sim_dma1.ISR |= (Flags | DMA_ISR_GIF1) << (4U * Channel);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_DataRegister()
+ * Purpose  : Data register address for a DMAMUX request
+ * Details  : ADC_DR (source) and USART2_TDR (destination)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t SIM_DMA_DataRegister(uint32_t RequestId) {
+
+	switch (RequestId) {
+	case SIM_DMAMUX_REQ_ADC:       return (uint32_t)(uintptr_t)&sim_adc1.DR;
+	case SIM_DMAMUX_REQ_USART2_TX: return (uint32_t)(uintptr_t)&sim_usart2.TDR;
+	default:                       return 0U;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_Serve()
+ * Purpose  : Channel that takes one RequestId transfer now
+ * Details  : -1 when none is mapped/enabled or on a transfer
+ *            error (TEIF, EN = 0). Address = memory side.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int32_t SIM_DMA_Serve(uint32_t RequestId, bool ToPeripheral, uint32_t *pAddress, uint32_t *pSize) {
+
+	for (uint32_t c = 0; c < SIM_DMA_CHANNELS; c++) {
+		DMA_Channel_TypeDef *ch = &sim_dma1_ch[c];
+		uint32_t ccr = ch->CCR;
+
+		if (((sim_dmamux1_ch[c].CCR & DMAMUX_CxCR_DMAREQ_ID) >> DMAMUX_CxCR_DMAREQ_ID_Pos) != RequestId) {
+			continue;
+		}
+		if (!(ccr & DMA_CCR_EN) || (ch->CNDTR == 0U)) {
+			return -1;
+		}
+
+		if ((ch->CPAR != SIM_DMA_DataRegister(RequestId)) || (ch->CMAR == 0U) ||
+		    (((ccr & DMA_CCR_DIR) != 0U) != ToPeripheral)) {
+			ch->CCR &= ~DMA_CCR_EN;                               //Transfer error disables the channel
+			SIM_DMA_SetFlags(c, DMA_ISR_TEIF1);
+			sim_stats.DmaErrors++;
+			return -1;
+		}
+
+		*pSize    = 1UL << ((ccr & DMA_CCR_MSIZE) >> DMA_CCR_MSIZE_Pos);
+		*pAddress = ch->CMAR + ((ccr & DMA_CCR_MINC) ? dma[c].Index * *pSize : 0U);
+		return (int32_t)c;
+	}
+
+	return -1;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_Advance()
+ * Purpose  : Count one item: CNDTR, HT/TC flags, CIRC reload
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_DMA_Advance(uint32_t c) {
+	DMA_Channel_TypeDef *ch = &sim_dma1_ch[c];
+
+	sim_stats.DmaTransfers++;
+	dma[c].Index++;
+	ch->CNDTR--;
+
+	if (dma[c].Index == dma[c].Reload / 2U) {
+		SIM_DMA_SetFlags(c, DMA_ISR_HTIF1);
+	}
+	if (ch->CNDTR == 0U) {
+		SIM_DMA_SetFlags(c, DMA_ISR_TCIF1);
+		if (ch->CCR & DMA_CCR_CIRC) {
+			ch->CNDTR    = dma[c].Reload;
+			dma[c].Index = 0;
+		}
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL INTERFACE                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_DMA_Reset(void) {
+
+	memset(&sim_dma1, 0, sizeof(sim_dma1));
+	memset(sim_dma1_ch, 0, sizeof(sim_dma1_ch));
+	memset(sim_dmamux1_ch, 0, sizeof(sim_dmamux1_ch));
+	memset(dma, 0, sizeof(dma));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_Request()
+ * Purpose  : One peripheral request carrying Data
+ * Details  : Returns false when no enabled channel serves it,
+ *            the peripheral then keeps its data (EOC stays)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool SIM_DMA_Request(uint32_t RequestId, uint32_t Data) {
+	uint32_t size, addr;
+	int32_t  c = SIM_DMA_Serve(RequestId, false, &addr, &size);
+
+	if (c < 0) {
+		return false;
+	}
+
+	switch (size) {
+	case 1U: { uint8_t  v = (uint8_t)Data;  memcpy((void *)(uintptr_t)addr, &v, 1U); break; }
+	case 2U: { uint16_t v = (uint16_t)Data; memcpy((void *)(uintptr_t)addr, &v, 2U); break; }
+	default: { uint32_t v = Data;           memcpy((void *)(uintptr_t)addr, &v, 4U); break; }
+	}
+
+	SIM_DMA_Advance((uint32_t)c);
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_Fetch()
+ * Purpose  : One peripheral request for data (DIR = 1)
+ * Details  : Returns false when no enabled channel serves it,
+ *            the peripheral then keeps requesting
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool SIM_DMA_Fetch(uint32_t RequestId, uint32_t *pData) {
+	uint32_t size, addr;
+	int32_t  c = SIM_DMA_Serve(RequestId, true, &addr, &size);
+
+	if (c < 0) {
+		return false;
+	}
+
+	switch (size) {
+	case 1U: { uint8_t  v; memcpy(&v, (const void *)(uintptr_t)addr, 1U); *pData = v; break; }
+	case 2U: { uint16_t v; memcpy(&v, (const void *)(uintptr_t)addr, 2U); *pData = v; break; }
+	default: { uint32_t v; memcpy(&v, (const void *)(uintptr_t)addr, 4U); *pData = v; break; }
+	}
+
+	SIM_DMA_Advance((uint32_t)c);
+	return true;
+}
+
+bool SIM_DMA_IrqLine(uint32_t Channel) {
+	uint32_t flags  = (sim_dma1.ISR >> (4U * Channel)) & SIM_DMA_FLAGS;
+	uint32_t enable = sim_dma1_ch[Channel].CCR & (DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+
+	return (flags & enable) != 0U;                                //TCIF/HTIF/TEIF line up with TCIE/HTIE/TEIE
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_DMA_Write()
+ * Purpose  : DMA / DMAMUX register write
+ * Details  : IFCR clears ISR flags (CGIFx: all four),
+ *            EN 0 -> 1 latches the reload count
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_DMA_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value) {
+
+	if (pReg == &sim_dma1.IFCR) {
+		for (uint32_t c = 0; c < SIM_DMA_CHANNELS; c++) {
+			uint32_t clear = (Value >> (4U * c)) & 0xFU;
+
+			if (clear & DMA_IFCR_CGIF1) {
+				clear = 0xFU;
+			}
+			sim_dma1.ISR &= ~(clear << (4U * c));
+			if (!((sim_dma1.ISR >> (4U * c)) & SIM_DMA_FLAGS)) {
+				sim_dma1.ISR &= ~(DMA_ISR_GIF1 << (4U * c));
+			}
+		}
+		*pReg = 0;                                                //Write-only, reads as 0
+		return;
+	}
+
+	if (pReg == &sim_dma1.ISR) {
+		SIM_Violation("DMA_ISR is read-only");
+		return;
+	}
+
+	for (uint32_t c = 0; c < SIM_DMA_CHANNELS; c++) {
+		DMA_Channel_TypeDef *ch = &sim_dma1_ch[c];
+
+		if (pReg == &ch->CCR) {
+			if ((Old & DMA_CCR_EN) && (Value & DMA_CCR_EN) && ((Old ^ Value) & ~DMA_CCR_EN)) {
+				SIM_Violation("DMA_CCR reconfigured with EN = 1 (ignored)");
+				return;
+			}
+			if ((Value & ~Old) & DMA_CCR_EN) {
+				dma[c].Reload = ch->CNDTR;
+				dma[c].Index  = 0;
+			}
+			*pReg = Value;
+			return;
+		}
+		if ((pReg == &ch->CNDTR) || (pReg == &ch->CPAR) || (pReg == &ch->CMAR)) {
+			if (ch->CCR & DMA_CCR_EN) {
+				SIM_Violation("DMA CNDTR/CPAR/CMAR written with EN = 1 (ignored)");
+				return;
+			}
+			*pReg = (pReg == &ch->CNDTR) ? (Value & 0xFFFFU) : Value;
+			return;
+		}
+	}
+
+	*pReg = Value;                                                //DMAMUX
+}
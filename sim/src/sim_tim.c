@@ -0,0 +1,137 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_tim.c                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - TIM3 Time Base + TRGO Model                    ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Up-counting TIM3 time base: one update event every (PSC + 1) * (ARR + 1) timer clocks.                   *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Update sets UIF, and with MMS = 010 drives TRGO into the ADC trigger input.                          *
+ *   - PSC/ARR changes take effect at the next update (preload), UG restarts the period.                    *
+ *   - Period arithmetic carries the sub-ns remainder, so long runs do not drift.                           *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include "stm32g0xx_hal.h"
+#include <string.h>
+
+#define SIM_TIM_IDLE         UINT64_MAX
+#define SIM_TIM_MMS_UPDATE   0x2UL                                //MMS = 010: update event as TRGO
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static struct {
+	uint64_t NextNs;
+	uint64_t Remainder;                                           //ns * f_TIM carried between periods
+} tim;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_TIM_ClockHz()
+ * Purpose  : TIM3 kernel clock
+ * Details  : PCLK, x2 when the APB prescaler is not 1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t SIM_TIM_ClockHz(void) {
+	uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+
+	return (sim_rcc.CFGR & RCC_CFGR_PPRE_2) ? 2U * pclk : pclk;
+}
+
+static void SIM_TIM_ScheduleFrom(uint64_t Now) {
+	uint64_t f     = SIM_TIM_ClockHz();
+	uint64_t ticks = ((uint64_t)(sim_tim3.PSC & 0xFFFFU) + 1U) * ((uint64_t)(sim_tim3.ARR & 0xFFFFU) + 1U);
+	uint64_t num   = ticks * 1000000000ULL + tim.Remainder;
+
+	tim.NextNs    = Now + num / f;
+	tim.Remainder = num % f;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL INTERFACE                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_TIM_Reset(void) {
+
+	memset(&sim_tim3, 0, sizeof(sim_tim3));
+	sim_tim3.ARR  = 0xFFFFU;
+	tim.NextNs    = SIM_TIM_IDLE;
+	tim.Remainder = 0;
+}
+
+uint64_t SIM_TIM_NextEvent(void) {
+	return tim.NextNs;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_TIM_Event()
+ * Purpose  : Update event: UIF, TRGO, next period
+ * Details  : TRGO reaches the ADC in the same instant
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_TIM_Event(uint64_t Now) {
+
+	if (tim.NextNs > Now) {
+		return;
+	}
+
+	sim_tim3.SR |= TIM_SR_UIF;
+	SIM_TIM_ScheduleFrom(tim.NextNs);
+
+	if (((sim_tim3.CR2 & TIM_CR2_MMS) >> TIM_CR2_MMS_Pos) == SIM_TIM_MMS_UPDATE) {
+		SIM_ADC_Trigger(Now);
+	}
+}
+
+bool SIM_TIM_IrqLine(void) {
+	return (sim_tim3.SR & sim_tim3.DIER & TIM_SR_UIF) != 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_TIM_Write()
+ * Purpose  : TIM3 register write
+ * Details  : CEN starts/stops the period, UG restarts it,
+ *            SR bits are cleared by writing 0
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_TIM_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value) {
+	uint64_t now = SIM_GetTimeNs();
+
+	if (pReg == &sim_tim3.CR1) {
+		*pReg = Value;
+		if ((Value & ~Old) & TIM_CR1_CEN) {
+			tim.Remainder = 0;
+			SIM_TIM_ScheduleFrom(now);
+		} else if (!(Value & TIM_CR1_CEN)) {
+			tim.NextNs = SIM_TIM_IDLE;
+		}
+	} else if (pReg == &sim_tim3.SR) {
+		*pReg = Old & Value;                                      //rc_w0
+	} else if (pReg == &sim_tim3.EGR) {
+		*pReg = 0;
+		if (Value & TIM_EGR_UG) {
+			if (!(sim_tim3.CR1 & TIM_CR1_URS)) {
+				sim_tim3.SR |= TIM_SR_UIF;
+			}
+			if (sim_tim3.CR1 & TIM_CR1_CEN) {
+				tim.Remainder = 0;
+				SIM_TIM_ScheduleFrom(now);
+			}
+		}
+	} else {
+		*pReg = Value;
+	}
+}
@@ -0,0 +1,193 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_usart.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - USART2 Transmitter Model                       ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Transmit side of USART2 (8N1, oversampling by 16): TDR, one shift register, TXE/TC, DMA requests.        *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - One frame takes 10 * BRR kernel clocks (start + 8 data + stop), the kernel clock is PCLK.            *
+ *   - TDR moves to the shift register as soon as it is idle, TXE then requests the next byte from DMA      *
+ *     (DMAT = 1, DMAMUX request SIM_DMAMUX_REQ_USART2_TX).                                                 *
+ *   - TC when the last stop bit is out with TDR empty; TCCF and a TDR write clear it.                      *
+ *   - Every byte leaving the shift register goes to the sink set with SIM_USART_SetSink().                 *
+ *   - TDR written with TXE = 0 and BRR written with UE = 1 are reported.                                   *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include "stm32g0xx_hal.h"
+#include <string.h>
+
+#define SIM_USART_IDLE       UINT64_MAX
+#define SIM_USART_FRAME_BITS 10U                                  //8N1
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static struct {
+	uint64_t        ShiftEndNs;                                   //Stop bit of the byte in the shifter
+	uint8_t         Shifting;
+	bool            TdrFull;
+	SIM_UsartSink_t Sink;
+	void           *pCtx;
+} usart;
+
+static bool SIM_USART_Enabled(void) {
+	const uint32_t on = USART_CR1_UE | USART_CR1_TE;
+
+	return (sim_usart2.CR1 & on) == on;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_USART_Service()
+ * Purpose  : Move TDR into an idle shifter, refill TDR by DMA
+ * Details  : Runs after every USART/DMA write and every stop
+ *            bit: the DMA request is a level while TXE = 1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void SIM_USART_Service(uint64_t Now) {
+	uint32_t data;
+
+	if (!SIM_USART_Enabled()) {
+		return;
+	}
+
+	for (;;) {
+		if (usart.TdrFull && (usart.ShiftEndNs == SIM_USART_IDLE)) {
+			uint64_t brr = sim_usart2.BRR & 0xFFFFU;
+
+			usart.Shifting   = (uint8_t)sim_usart2.TDR;
+			usart.TdrFull    = false;
+			usart.ShiftEndNs = Now + (SIM_USART_FRAME_BITS * brr * 1000000000ULL) / HAL_RCC_GetPCLK1Freq();
+			sim_usart2.ISR  |= USART_ISR_TXE_TXFNF;
+		}
+		if (usart.TdrFull || !(sim_usart2.CR3 & USART_CR3_DMAT) ||
+		    !SIM_DMA_Fetch(SIM_DMAMUX_REQ_USART2_TX, &data)) {
+			return;
+		}
+		sim_usart2.TDR  = data & 0xFFU;
+		sim_usart2.ISR &= ~(USART_ISR_TXE_TXFNF | USART_ISR_TC);
+		usart.TdrFull   = true;
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           MODEL INTERFACE                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_USART_Reset(void) {
+
+	memset(&sim_usart2, 0, sizeof(sim_usart2));
+	sim_usart2.ISR   = USART_ISR_TXE_TXFNF | USART_ISR_TC;        //Reset value 0x0000_00C0
+	usart.ShiftEndNs = SIM_USART_IDLE;
+	usart.TdrFull    = false;
+}
+
+void SIM_USART_SetSink(SIM_UsartSink_t Sink, void *pCtx) {
+	usart.Sink = Sink;
+	usart.pCtx = pCtx;
+}
+
+uint64_t SIM_USART_NextEvent(void) {
+	return usart.ShiftEndNs;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_USART_Event()
+ * Purpose  : Stop bit sent: deliver the byte, next one or TC
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_USART_Event(uint64_t Now) {
+
+	if (usart.ShiftEndNs > Now) {
+		return;
+	}
+
+	usart.ShiftEndNs = SIM_USART_IDLE;
+	sim_stats.UsartBytes++;
+	if (usart.Sink != NULL) {
+		usart.Sink(usart.Shifting, usart.pCtx);
+	}
+
+	if (!usart.TdrFull) {
+		sim_usart2.ISR |= USART_ISR_TC;
+	}
+	SIM_USART_Service(Now);
+}
+
+bool SIM_USART_IrqLine(void) {
+	uint32_t isr = sim_usart2.ISR;
+	uint32_t cr1 = sim_usart2.CR1;
+
+	return ((isr & USART_ISR_TC) && (cr1 & USART_CR1_TCIE)) ||
+	       ((isr & USART_ISR_TXE_TXFNF) && (cr1 & USART_CR1_TXEIE_TXFNFIE));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_USART_Write()
+ * Purpose  : USART2 register write
+ * Details  : ISR read-only, ICR write-1-to-clear, UE = 0 drops
+ *            the transmitter state as on the device
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_USART_Write(volatile uint32_t *pReg, uint32_t Old, uint32_t Value) {
+
+	if (pReg == &sim_usart2.ISR) {
+		SIM_Violation("USART_ISR is read-only");
+		return;
+	}
+	if (pReg == &sim_usart2.ICR) {
+		sim_usart2.ISR &= ~(Value & USART_ICR_TCCF);
+		*pReg = 0;
+		return;
+	}
+	if ((pReg == &sim_usart2.BRR) && (sim_usart2.CR1 & USART_CR1_UE)) {
+		SIM_Violation("USART_BRR written with UE = 1 (ignored)");
+		return;
+	}
+	if (pReg == &sim_usart2.TDR) {
+		if (!SIM_USART_Enabled()) {
+			return;
+		}
+		if (usart.TdrFull) {
+			SIM_Violation("USART_TDR written with TXE = 0 (previous byte lost)");
+		}
+		*pReg = Value & 0xFFU;
+		sim_usart2.ISR &= ~(USART_ISR_TXE_TXFNF | USART_ISR_TC);
+		usart.TdrFull   = true;
+		SIM_USART_Service(SIM_GetTimeNs());
+		return;
+	}
+
+	*pReg = Value;
+	if ((pReg == &sim_usart2.CR1) && (Old & ~Value & USART_CR1_UE)) {
+		usart.ShiftEndNs = SIM_USART_IDLE;
+		usart.TdrFull    = false;
+		sim_usart2.ISR   = USART_ISR_TXE_TXFNF | USART_ISR_TC;
+	}
+	SIM_USART_Service(SIM_GetTimeNs());
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_USART_DmaChanged()
+ * Purpose  : A DMA register was written
+ * Details  : A channel enabled while TXE = 1 starts at once
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_USART_DmaChanged(void) {
+	SIM_USART_Service(SIM_GetTimeNs());
+}
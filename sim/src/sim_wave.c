@@ -0,0 +1,163 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: sim_wave.c                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 3, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       Host Simulator - Analog Input Sources                           ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * One waveform per ADC channel, evaluated at the end of each sampling phase.                               *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Built-in DC, sine, square and sawtooth sources with optional Gaussian noise.                         *
+ *   - Any other source (recorded data, closed-loop plant) through SIM_SetWaveform().                       *
+ *   - Reset defaults: 0 V on external inputs, 0.76 V on the temperature sensor (CH12), 1.212 V on          *
+ *     VREFINT (CH13) and a 3.3 V supply.                                                                   *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "sim.h"
+#include <math.h>
+#include <string.h>
+
+#define SIM_PI               3.14159265358979323846
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           SOURCE STATE                                                   */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static struct {
+	SIM_WaveFn_t Fn;
+	void        *pCtx;
+	SIM_Wave_t   Wave;                                            //Storage for the built-in kinds
+} source[SIM_ADC_CHANNELS];
+
+static uint32_t noise_state;
+static double   supply_v = SIM_ADC_VREF_V;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Wave_Uniform() / SIM_Wave_Gauss()
+ * Purpose  : Unit-variance Gaussian sample
+ * Details  : xorshift32 + Box-Muller, reproducible per seed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static double SIM_Wave_Uniform(void) {
+
+	noise_state ^= noise_state << 13;
+	noise_state ^= noise_state >> 17;
+	noise_state ^= noise_state << 5;
+	return ((double)noise_state + 1.0) / 4294967297.0;            //(0, 1)
+}
+
+static double SIM_Wave_Gauss(void) {
+	double u1 = SIM_Wave_Uniform();
+	double u2 = SIM_Wave_Uniform();
+
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * SIM_PI * u2);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_Wave_Builtin()
+ * Purpose  : SIM_WaveFn_t of the SIM_Wave_t kinds
+ * Details  : pCtx points at the channel's SIM_Wave_t
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static double SIM_Wave_Builtin(uint32_t Channel, uint64_t TimeNs, void *pCtx) {
+	const SIM_Wave_t *w = (const SIM_Wave_t *)pCtx;
+	double t     = (double)TimeNs * 1e-9;
+	double phase = w->Freq_Hz * t - floor(w->Freq_Hz * t);       //0..1
+	double v     = w->Offset_V;
+
+	(void)Channel;
+
+	switch (w->Kind) {
+	case SIM_WAVE_SINE:   v += w->Amplitude_V * sin(2.0 * SIM_PI * phase);          break;
+	case SIM_WAVE_SQUARE: v += (phase < 0.5) ? w->Amplitude_V : -w->Amplitude_V;    break;
+	case SIM_WAVE_RAMP:   v += w->Amplitude_V * phase;                              break;
+	default:                                                                        break;
+	}
+
+	if (w->Noise_V > 0.0) {
+		v += w->Noise_V * SIM_Wave_Gauss();
+	}
+	return v;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           SOURCE INTERFACE                                               */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void SIM_Wave_Reset(uint32_t Seed) {
+	SIM_Wave_t dc = { .Kind = SIM_WAVE_DC };
+
+	memset(source, 0, sizeof(source));
+	noise_state = (Seed != 0U) ? Seed : 1U;                       //xorshift must not start at 0
+
+	for (uint32_t ch = 0; ch < SIM_ADC_CHANNELS; ch++) {
+		dc.Offset_V = (ch == SIM_ADC_CH_TSENSE) ? SIM_TS_V30 : (ch == SIM_ADC_CH_VREFINT) ? SIM_VREFINT_V : 0.0;
+		SIM_SetWave(ch, &dc);
+	}
+	supply_v = SIM_ADC_VREF_V;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_SetSupply() / SIM_GetSupply()
+ * Purpose  : VDDA = VREF+ of the converter from now on
+ * Details  : Inputs keep their voltages, codes scale by 1/VDDA
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_SetSupply(double Vdda_V) {
+	supply_v = Vdda_V;
+}
+
+double SIM_GetSupply(void) {
+	return supply_v;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : SIM_SetTemperature()
+ * Purpose  : Die temperature seen by the sensor (CH12)
+ * Details  : Replaces the CH12 source with the matching DC
+ *            level, linear around TS_CAL1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void SIM_SetTemperature(double DegC) {
+	SIM_Wave_t dc = { .Kind = SIM_WAVE_DC, .Offset_V = SIM_TS_V30 + SIM_TS_SLOPE_V * (DegC - 30.0) };
+
+	SIM_SetWave(SIM_ADC_CH_TSENSE, &dc);
+}
+
+void SIM_SetWave(uint32_t Channel, const SIM_Wave_t *pWave) {
+
+	if (Channel >= SIM_ADC_CHANNELS) {
+		return;
+	}
+	source[Channel].Wave = *pWave;
+	source[Channel].Fn   = SIM_Wave_Builtin;
+	source[Channel].pCtx = &source[Channel].Wave;
+}
+
+void SIM_SetWaveform(uint32_t Channel, SIM_WaveFn_t Fn, void *pCtx) {
+
+	if (Channel >= SIM_ADC_CHANNELS) {
+		return;
+	}
+	source[Channel].Fn   = Fn;
+	source[Channel].pCtx = pCtx;
+}
+
+double SIM_GetInput(uint32_t Channel, uint64_t TimeNs) {
+
+	if ((Channel >= SIM_ADC_CHANNELS) || (source[Channel].Fn == NULL)) {
+		return 0.0;
+	}
+	return source[Channel].Fn(Channel, TimeNs, source[Channel].pCtx);
+}
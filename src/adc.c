@@ -40,100 +40,665 @@
 /*                                                                                  						*/
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 #include "adc.h"
+#include "adc_instr.h"
 #include "helpers.h"
 #include "stm32g030xx.h"
 #include "stdio.h"
 #include "main.h"
 #include <stdbool.h>
 
+#ifndef ADC_PLAN_QUIET
+#pragma message("ADC plan: CKMODE=00 PRESC=/" ADC_PLAN_XSTR(ADC_PLAN_PRESC_DIV) " SMP=" ADC_PLAN_SMP_STR       \
+                " RES=" ADC_PLAN_XSTR(ADC_PLAN_RES_BITS) "-bit -> " ADC_PLAN_XSTR(ADC_PLAN_SYSCLK_HZ) "/"          \
+                ADC_PLAN_XSTR(ADC_PLAN_PRESC_DIV) " Hz / (" ADC_PLAN_SMP_STR "+" ADC_PLAN_TCONV_STR ") cycles >= " \
+                ADC_PLAN_XSTR(ADC_PLAN_TARGET_SPS) " sps")
+#endif
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           SCAN STATE                                                     */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint8_t scan_order[ADC_SCAN_MAX_CHANNELS] = { 0 };       //Conversion order, ADC1_Init() selects CH0 only
+static uint8_t scan_length = 1;
+static uint8_t conv_bits   = ADC_RESOLUTION_BITS;               //RES[1:0] as bits
+static uint8_t result_bits = ADC_RESOLUTION_BITS;               //Bits spanned by a DR word (oversampling, ALIGN)
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INIT STATE                                                     */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static volatile ADC_InitState_t init_state = ADC_INIT_IDLE;
+static uint32_t                 init_flags;
+static uint32_t                 init_tick;                      //HAL_GetTick() at ADVREGEN
+static bool                     init_restore_cal;
+static uint8_t                  init_calfact;
+
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /* 																											*/
 /*                                           CONFIGURATIONS:                                                */
 /*                        CLOCK, RESOLUTION, DATA ALIGNMENT & NUMBER OF CONVERSION 							*/
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /* ────────────────────────────────────────────────────────────── /
- * Function : ADC1_Init()
- * Purpose  : Start an ADC1 conversion
- * Details  : EN ADC, sets RES, channel, sampling, and CONT mode
+ * Function : ADC1_CalCache_Load()
+ * Purpose  : Fetch a CALFACT saved by a previous boot
+ * Details  : TAMP backup register, survives resets while the
+ *            backup domain stays powered. Checks magic + copy.
+ *            Needs PWR + RTC APB clocks (reads only, no DBP)
  * Runtime  : ~X.Xxx
  * ────────────────────────────────────────────────────────────── */
-void ADC1_Init(void) {
+static bool ADC1_CalCache_Load(uint8_t *pCalFact) {
+	uint32_t word, cal;
+
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN | RCC_APBENR1_RTCAPBEN);  //TAMP registers read as 0 without RTCAPBEN
+
+	word = READ_REG(ADC_CALCACHE_BKPR);
+	cal  = word & ADC_CALFACT_CALFACT;
+
+	if (((word & ADC_CALCACHE_MAGIC_MASK) != ADC_CALCACHE_MAGIC) ||
+	    (((~word >> ADC_CALCACHE_CHECK_Pos) & ADC_CALFACT_CALFACT) != cal)) {
+		return false;
+	}
+
+	*pCalFact = (uint8_t)cal;
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_CalCache_Store()
+ * Purpose  : Save CALFACT for the next warm boot
+ * Details  : Needs PWR + RTC APB clocks and DBP = 1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC1_CalCache_Store(uint32_t CalFact) {
+
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN | RCC_APBENR1_RTCAPBEN);
+	SET_BIT(PWR->CR1, PWR_CR1_DBP);                               //Backup domain write access
+
+	WRITE_REG(ADC_CALCACHE_BKPR, ADC_CALCACHE_MAGIC |
+	          (((~CalFact) & ADC_CALFACT_CALFACT) << ADC_CALCACHE_CHECK_Pos) |
+	          (CalFact & ADC_CALFACT_CALFACT));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_InvalidateCalibration()
+ * Purpose  : Force a fresh calibration on the next init
+ * Details  : Use after large VDDA or temperature changes
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_InvalidateCalibration(void) {
+
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN | RCC_APBENR1_RTCAPBEN);
+	SET_BIT(PWR->CR1, PWR_CR1_DBP);
+	WRITE_REG(ADC_CALCACHE_BKPR, 0);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_InitAsync()
+ * Purpose  : Start a non-blocking ADC1 bring-up
+ * Details  : Sets clock, RES, channel, sampling and CONT mode,
+ *            enables the regulator and returns. Advance with
+ *            ADC1_InitPoll(): the regulator wait is timed and
+ *            only ends there. ADC_INIT_FLAG_IRQ lets EOCAL /
+ *            ADRDY run the later steps in ADC1_Init_IRQHandler().
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_InitAsync(uint32_t Flags) {
 	/*
 	 * 14.3.5: ADC clock (CKMODE, PRESC[3:0])
 	 */
 	SET_BIT(RCC->APBENR2,RCC_APBENR2_ADCEN);                      //Enable ADC peripheral clock
 
 	CLEAR_BIT(ADC1->CR, ADC_CR_ADEN);                             //ADC is disabled (OFF state)
-	CLEAR_BIT(ADC1->CFGR2, ADC_CFGR2_CKMODE );                    //CKMODE = 00
-	CLEAR_BIT(ADC->CCR, ADC_CCR_PRESC);                           //000: Clear Prescaller Bits
-	SET_BIT(ADC->CCR, 0b0111<<ADC_CCR_PRESC_Pos);                 //0111: Input ADC clock divided by 16
+	MODIFY_REG(ADC1->CFGR2, ADC_CFGR2_CKMODE,
+	           (uint32_t)ADC_PLAN_CKMODE << ADC_CFGR2_CKMODE_Pos);  //CKMODE from adc_plan.h (00: async)
+	MODIFY_REG(ADC->CCR, ADC_CCR_PRESC,
+	           (uint32_t)ADC_PLAN_PRESC << ADC_CCR_PRESC_Pos);      //PRESC from adc_plan.h
 
-	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_RES);                        //00: 12 bits Resolution
+	MODIFY_REG(ADC1->CFGR1, ADC_CFGR1_RES,
+	           (uint32_t)ADC_PLAN_RES << ADC_CFGR1_RES_Pos);        //RES from adc_plan.h
 	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_ALIGN);                      //0: Right alignment
+	conv_bits   = ADC_RESOLUTION_BITS;
+	result_bits = ADC_RESOLUTION_BITS;
 
 	/*
-	 * 14.3.2: ADC voltage regulator Enabling(ADVREGEN)
+	 * 14.3.8: Channel selection (CHSEL, SCANDIR, CHSELRMOD)
 	 */
-	SET_BIT(ADC1->CR, ADC_CR_ADVREGEN);
-	TimeOut(t_ADCVREG_SETUP);
+	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_CHSELRMOD);                  //0: Each bit of the ADC_CHSELR register enables an input
+	SET_BIT(ADC1->CHSELR, ADC_CHSELR_CHSEL0);                     //ADC channel selection : PA0 -> Channel 0
+	scan_order[0] = 0;
+	scan_length   = 1;
+
+	/*
+	 *  14.3.9: Programmable sampling time (SMPx[2:0])
+	 */
+	MODIFY_REG(ADC1->SMPR, ADC_SMPR_SMP1,
+	           (uint32_t)ADC_PLAN_SMP << ADC_SMPR_SMP1_Pos);        //SMP1 from adc_plan.h
 
 	/*
-	 * 14.3.3: Calibration (ADCAL)
+	 * 14.3.10+11: Conversion modes (CONT = 0 & CONT = 1)
 	 */
-	if(((ADC1->CR & ADC_CR_ADEN) == 0) && ((ADC1->CR & ADC_CR_ADVREGEN) !=0) && ((ADC1->CFGR1 & ADC_CFGR1_DMAEN) == 0)) {
+	SET_BIT(ADC1->CFGR1,ADC_CFGR1_CONT);                          //1: Continuous conversion mode
 
-		SET_BIT(ADC1->CR, ADC_CR_ADCAL);                          //Set ADCAL = 1 after ensuring that ADEN = 0, ADVREGEN = 1 and DMAEN = 0.
+	init_flags       = Flags;
+	init_restore_cal = false;
 
+	if (Flags & ADC_INIT_FLAG_IRQ) {
+		WRITE_REG(ADC1->ISR, ADC_ISR_EOCAL | ADC_ISR_ADRDY);      //Clear stale flags (write 1)
+		SET_BIT(ADC1->IER, ADC_IER_EOCALIE | ADC_IER_ADRDYIE);
+		HAL_NVIC_SetPriority(ADC1_IRQn, 2, 0);
+		HAL_NVIC_EnableIRQ(ADC1_IRQn);
 	}
 
 	/*
-	 * Wait until ADCAL = 0
+	 * 14.3.2: ADC voltage regulator Enabling(ADVREGEN)
 	 */
-	while(ADC1->CR & ADC_CR_ADCAL) {
+	SET_BIT(ADC1->CR, ADC_CR_ADVREGEN);
+	init_tick  = HAL_GetTick();
+	init_state = ADC_INIT_VREG;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_InitStep()
+ * Purpose  : Run one transition of the bring-up state machine
+ * Details  : Never waits, returns the (possibly new) state
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static ADC_InitState_t ADC1_InitStep(void) {
+
+	switch (init_state) {
+
+	case ADC_INIT_VREG:
+		if ((HAL_GetTick() - init_tick) < t_ADCVREG_SETUP) {
+			break;                                                //⏳... regulator start-up
+		}
+
+		if ((init_flags & ADC_INIT_FLAG_CALCACHE) && ADC1_CalCache_Load(&init_calfact)) {
+			init_restore_cal = true;                              //Warm boot: skip ADCAL
+		} else {
+			/*
+			 * 14.3.3: Calibration (ADCAL)
+			 */
+			if(((ADC1->CR & ADC_CR_ADEN) == 0) && ((ADC1->CR & ADC_CR_ADVREGEN) !=0) && ((ADC1->CFGR1 & ADC_CFGR1_DMAEN) == 0)) {
+
+				SET_BIT(ADC1->CR, ADC_CR_ADCAL);                  //Set ADCAL = 1 after ensuring that ADEN = 0, ADVREGEN = 1 and DMAEN = 0.
+				init_state = ADC_INIT_CALIBRATING;
+			} else {
+				CLEAR_BIT(ADC1->IER, ADC_IER_EOCALIE | ADC_IER_ADRDYIE);
+				init_state = ADC_INIT_ERROR;                      //No ADCAL: CALFACT is not a fresh calibration
+			}
+			break;
+		}
+		/* fall through: restored, enable straight away */
+
+	case ADC_INIT_CALIBRATING:
+		if (init_state == ADC_INIT_CALIBRATING) {
+			if (ADC1->CR & ADC_CR_ADCAL) {
+				break;                                            //⏳... ADCAL = 1 until EOCAL
+			}
+			if (init_flags & ADC_INIT_FLAG_CALCACHE) {
+				ADC1_CalCache_Store(ADC1->CALFACT);
+			}
+		}
+
 		/*
-		 * ⏳... After Waiting, The calibration factor can be read from bits 6:0 of ADC_DR or ADC_CALFACT registers.
+		 * 14.3.4: ADC on-off control (ADEN, ADDIS, ADRDY)
 		 */
+		WRITE_REG(ADC1->ISR, ADC_ISR_ADRDY);                      //Clear the ADRDY bit in ADC_ISR register by programming this bit to 1.
+		SET_BIT(ADC1->CR, ADC_CR_ADEN);                           //Set ADEN = 1 in the ADC_CR register.
+		init_state = ADC_INIT_ENABLING;
+		break;
+
+	case ADC_INIT_ENABLING:
+		if (!(ADC1->ISR & ADC_ISR_ADRDY)) {
+			break;                                                //⏳... ADRDY = 1
+		}
+
+		if (init_restore_cal) {
+			WRITE_REG(ADC1->CALFACT, init_calfact);               //Only writable with ADEN = 1, ADSTART = 0
+		}
+
+		CLEAR_BIT(ADC1->IER, ADC_IER_EOCALIE | ADC_IER_ADRDYIE);
+		init_state = ADC_INIT_READY;
+		break;
+
+	default:
+		break;
 	}
 
-	/*
-	 * 14.3.8: Channel selection (CHSEL, SCANDIR, CHSELRMOD)
-	 */
-	CLEAR_BIT(ADC1->CR, ADC_CR_ADSTART);                          //Ensures that no conversion is ongoing
+	return init_state;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_InitPoll()
+ * Purpose  : Advance ADC1_InitAsync() as far as possible
+ * Details  : Call from the main loop until ADC_INIT_READY or
+ *            ADC_INIT_ERROR. Steps run with PRIMASK set so
+ *            ADC1_Init_IRQHandler() never sees a half-done one
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+ADC_InitState_t ADC1_InitPoll(void) {
+	uint32_t        primask = __get_PRIMASK();
+	ADC_InitState_t prev;
+	ADC_InitState_t state;
 
-	if(!(ADC1->ISR & ADC_ISR_CCRDY) ) {                           //Check ADC channel configuration ready flag
-		TimeOut(1);
+	__disable_irq();
+	do {
+		prev = init_state;
+	} while (ADC1_InitStep() != prev);
+	state = init_state;
+	__set_PRIMASK(primask);
+
+	return state;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_Init_IRQHandler()
+ * Purpose  : Advance the bring-up on EOCAL / ADRDY
+ * Details  : Call from ADC1_IRQHandler() (ADC_INIT_FLAG_IRQ).
+ *            No interrupt ends the regulator wait: one
+ *            ADC1_InitPoll() after t_ADCVREG_SETUP is needed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_Init_IRQHandler(void) {
+	uint32_t pending = ADC1->ISR & ADC1->IER & (ADC_ISR_EOCAL | ADC_ISR_ADRDY);
+
+	if (pending == 0U) {
+		return;
 	}
 
-	if(ADC1->ISR & ADC_ISR_CCRDY) {
-		CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_CHSELRMOD);              //0: Each bit of the ADC_CHSELR register enables an input
+	ADC1_InitPoll();
+	WRITE_REG(ADC1->ISR, ADC_ISR_EOCAL);                          //Clear EOCAL (write 1), ADRDYIE is off once ready
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_Init()
+ * Purpose  : Blocking ADC1 bring-up
+ * Details  : EN ADC, sets RES, channel, sampling, and CONT mode.
+ *            Calibrates on every call (no cache). Returns on
+ *            ADC_INIT_ERROR too: check ADC1_InitPoll()
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_Init(void) {
+
+	ADC1_InitAsync(0);
+
+	while (ADC1_InitPoll() < ADC_INIT_READY) {
+		/*
+		 * ⏳...
+		 */
 	}
+}
 
-	SET_BIT(ADC1->CHSELR, ADC_CHSELR_CHSEL0);                     //ADC channel selection : PA0 -> Channel 0
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigScan()
+ * Purpose  : Configure a multi-channel scan (bitmask or SQ1..SQ8)
+ * Details  : Stops conversions, programs SMP1/SMP2 + SMPSELx,
+ *            CHSELR, waits CCRDY. Restart DMA/stream afterwards.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC1_ConfigScan(const ADC_ScanConfig_t *pConfig) {
+	ADC_SampleTime_t smp[2];
+	uint32_t         n_smp   = 0;
+	uint32_t         mask    = 0;
+	uint32_t         smpsel  = 0;
+	uint32_t         chselr  = 0xFFFFFFFFUL;                      //Unused SQx = 0xF (end of sequence)
+
+	if ((pConfig == NULL) || (pConfig->NumChannels == 0U) || (pConfig->NumChannels > ADC_SCAN_MAX_CHANNELS)) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < pConfig->NumChannels; i++) {
+		uint32_t         ch  = pConfig->Channels[i];
+		ADC_SampleTime_t st  = pConfig->SampleTime[i];
+		uint32_t         sel;
+
+		if ((ch > ADC_MAX_CHANNEL) || ((uint32_t)st > (uint32_t)ADC_SMP_160_5)) {
+			return false;
+		}
+		if ((pConfig->Mode == ADC_SCAN_SEQUENCE) && (ch > ADC_SCAN_MAX_SEQ_CHANNEL)) {
+			return false;
+		}
+		if ((pConfig->Mode == ADC_SCAN_BITMASK) && (mask & (1UL << ch))) {
+			return false;                                         //Bitmask mode converts each channel once
+		}
+
+		/*
+		 * Only two sampling times exist (SMP1, SMP2): map this channel onto one of them
+		 */
+		for (sel = 0; sel < n_smp; sel++) {
+			if (smp[sel] == st) {
+				break;
+			}
+		}
+		if (sel == n_smp) {
+			if (n_smp == 2U) {
+				return false;                                     //Third distinct sampling time
+			}
+			smp[n_smp++] = st;
+		}
+
+		if ((mask & (1UL << ch)) && (((smpsel >> ch) & 1UL) != sel)) {
+			return false;                                         //Same channel twice with different SMPx
+		}
+
+		mask   |= (1UL << ch);
+		smpsel |= (sel << ch);
+		chselr &= ~(0xFUL << (4U * i));
+		chselr |= (ch << (4U * i));
+	}
+	if (n_smp == 1U) {
+		smp[1] = smp[0];
+	}
+
+	ADC1_Stop();
 
 	/*
-	 *  14.3.9: Programmable sampling time (SMPx[2:0])
+	 *  14.3.9: Programmable sampling time (SMP1, SMP2, SMPSELx)
 	 */
-	CLEAR_BIT(ADC1->SMPR, ADC_SMPR_SMP1);
-	SET_BIT(ADC1->SMPR, ADC_SMPR_SMP1);                           //111: 160.5 ADC clock cycles
+	MODIFY_REG(ADC1->SMPR, ADC_SMPR_SMP1 | ADC_SMPR_SMP2 | ADC_SMPR_SMPSEL,
+	           ((uint32_t)smp[0] << ADC_SMPR_SMP1_Pos) |
+	           ((uint32_t)smp[1] << ADC_SMPR_SMP2_Pos) |
+	           (smpsel << ADC_SMPR_SMPSEL_Pos));
 
 	/*
-	 * 14.3.10+11: Conversion modes (CONT = 0 & CONT = 1)
+	 * 14.3.8: Channel selection (CHSEL, SCANDIR, CHSELRMOD)
 	 */
-	SET_BIT(ADC1->CFGR1,ADC_CFGR1_CONT);                          //1: Continuous conversion mode
+	WRITE_REG(ADC1->ISR, ADC_ISR_CCRDY);                          //Clear CCRDY (write 1)
 
+	if (pConfig->Mode == ADC_SCAN_SEQUENCE) {
+		SET_BIT(ADC1->CFGR1, ADC_CFGR1_CHSELRMOD);                //1: ADC_CHSELR holds SQ1..SQ8
+		WRITE_REG(ADC1->CHSELR, chselr);
+		scan_length = pConfig->NumChannels;
+		for (uint32_t i = 0; i < scan_length; i++) {
+			scan_order[i] = pConfig->Channels[i];
+		}
+	} else {
+		CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_CHSELRMOD);              //0: Each bit of ADC_CHSELR enables an input
+		if (pConfig->Backward) {
+			SET_BIT(ADC1->CFGR1, ADC_CFGR1_SCANDIR);              //1: Backward scan (CH18 -> CH0)
+		} else {
+			CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_SCANDIR);            //0: Upward scan (CH0 -> CH18)
+		}
+		WRITE_REG(ADC1->CHSELR, mask);
 
-	/*
-	 * 14.3.4: ADC on-off control (ADEN, ADDIS, ADRDY)
-	 */
-	CLEAR_BIT(ADC1->ISR, ADC_ISR_ADRDY);                          //Clear the ADRDY bit in ADC_ISR register by programming this bit to 1.
-	SET_BIT(ADC1->CR, ADC_CR_ADEN);                               //Set ADEN = 1 in the ADC_CR register.
+		scan_length = 0;
+		for (uint32_t i = 0; i <= ADC_MAX_CHANNEL; i++) {
+			uint32_t ch = pConfig->Backward ? (ADC_MAX_CHANNEL - i) : i;
+			if (mask & (1UL << ch)) {
+				scan_order[scan_length++] = (uint8_t)ch;
+			}
+		}
+	}
+
+	while (!(ADC1->ISR & ADC_ISR_CCRDY)) {                        //Wait for the new channel configuration
+		/*
+		 * ⏳...
+		 */
+	}
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_Disable()
+ * Purpose  : Bring the ADC to ADEN = 0 for CFGR2 changes
+ * Details  : Stops conversions, sets ADDIS, waits for ADEN = 0
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC1_Disable(void) {
+
+	ADC1_Stop();
 
-	while (!(ADC1->ISR & ADC_ISR_ADRDY)) {                        //Wait until ADRDY = 1 in the ADC_ISR register
+	if (ADC1->CR & ADC_CR_ADEN) {
+		SET_BIT(ADC1->CR, ADC_CR_ADDIS);
+		while (ADC1->CR & ADC_CR_ADEN) {                          //ADEN and ADDIS cleared by hardware
+			/*
+			 * ⏳...
+			 */
+		}
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_Enable()
+ * Purpose  : 14.3.4: ADC on-off control (ADEN, ADRDY)
+ * Details  : Clears ADRDY, sets ADEN and waits for ADRDY = 1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC1_Enable(void) {
+
+	WRITE_REG(ADC1->ISR, ADC_ISR_ADRDY);                          //Clear ADRDY (write 1)
+	SET_BIT(ADC1->CR, ADC_CR_ADEN);
+
+	while (!(ADC1->ISR & ADC_ISR_ADRDY)) {
 		/*
 		 * ⏳...
 		 */
 	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_AlignedBits()
+ * Purpose  : Bits spanned by a non-oversampled DR word
+ * Details  : Left alignment moves the MSB to bit 15, or to
+ *            bit 7 for 6-bit results (byte-aligned)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t ADC1_AlignedBits(uint32_t Bits, bool Left) {
+
+	if (!Left) {
+		return Bits;
+	}
+	return (Bits == 6U) ? 8U : ADC_DR_BITS;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigOversampling()
+ * Purpose  : 14.7: Hardware oversampler (OVSE, OVSR, OVSS, TOVS)
+ * Details  : CFGR2 is only writable with ADEN = 0, so the ADC is
+ *            disabled and re-enabled. The shifted result must fit
+ *            the 16-bit ADC_DR. Restart DMA/stream afterwards.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC1_ConfigOversampling(const ADC_OvsConfig_t *pConfig) {
+	uint32_t bits = ADC1_AlignedBits(conv_bits, (ADC1->CFGR1 & ADC_CFGR1_ALIGN) != 0U);
+
+	if (pConfig == NULL) {
+		return false;
+	}
+
+	if (pConfig->Enable) {
+		if (((uint32_t)pConfig->Ratio > (uint32_t)ADC_OVS_RATIO_256) || (pConfig->Shift > ADC_OVS_MAX_SHIFT)) {
+			return false;
+		}
+
+		/*
+		 * Sum of 2^(OVSR+1) samples grows by OVSR+1 bits, OVSS shifts back
+		 */
+		bits = conv_bits + ((uint32_t)pConfig->Ratio + 1U);       //ALIGN is ignored while OVSE = 1
+		if (pConfig->Shift >= bits) {
+			return false;
+		}
+		bits -= pConfig->Shift;
+		if (bits > ADC_DR_BITS) {
+			return false;                                         //Upper bits would be lost in ADC_DR
+		}
+	}
+
+	ADC1_Disable();
+
+	if (pConfig->Enable) {
+		MODIFY_REG(ADC1->CFGR2, ADC_CFGR2_OVSR | ADC_CFGR2_OVSS | ADC_CFGR2_TOVS,
+		           ((uint32_t)pConfig->Ratio << ADC_CFGR2_OVSR_Pos) |
+		           ((uint32_t)pConfig->Shift << ADC_CFGR2_OVSS_Pos) |
+		           (pConfig->Triggered ? ADC_CFGR2_TOVS : 0U));
+		SET_BIT(ADC1->CFGR2, ADC_CFGR2_OVSE);                     //1: Oversampler EN
+	} else {
+		CLEAR_BIT(ADC1->CFGR2, ADC_CFGR2_OVSE | ADC_CFGR2_TOVS);  //0: Oversampler OFF
+	}
+
+	result_bits = (uint8_t)bits;
+
+	ADC1_Enable();
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigResolution()
+ * Purpose  : 14.3.7 / 14.6: Resolution (RES) and alignment (ALIGN)
+ * Details  : RES is only writable with ADEN = 0, so the ADC is
+ *            disabled and re-enabled. Fewer bits convert in fewer
+ *            cycles (CONT rate rises above ADC_PLAN_SPS, timer
+ *            triggered rates are unchanged). False if an enabled
+ *            oversampler would overflow ADC_DR. Restart DMA/stream
+ *            afterwards.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC1_ConfigResolution(ADC_Resolution_t Resolution, ADC_Align_t Align) {
+	uint32_t bits, res_bits, cfgr2;
+
+	if (((uint32_t)Resolution > (uint32_t)ADC_RES_6BIT) || ((uint32_t)Align > (uint32_t)ADC_ALIGN_LEFT)) {
+		return false;
+	}
+
+	res_bits = 12U - 2U * (uint32_t)Resolution;
+	cfgr2    = READ_REG(ADC1->CFGR2);
+
+	if (cfgr2 & ADC_CFGR2_OVSE) {
+		uint32_t grow  = ((cfgr2 & ADC_CFGR2_OVSR) >> ADC_CFGR2_OVSR_Pos) + 1U;
+		uint32_t shift = (cfgr2 & ADC_CFGR2_OVSS) >> ADC_CFGR2_OVSS_Pos;
+
+		if ((shift >= res_bits + grow) || (res_bits + grow - shift > ADC_DR_BITS)) {
+			return false;
+		}
+		bits = res_bits + grow - shift;
+	} else {
+		bits = ADC1_AlignedBits(res_bits, Align == ADC_ALIGN_LEFT);
+	}
+
+	ADC1_Disable();
+
+	MODIFY_REG(ADC1->CFGR1, ADC_CFGR1_RES | ADC_CFGR1_ALIGN,
+	           ((uint32_t)Resolution << ADC_CFGR1_RES_Pos) |
+	           ((Align == ADC_ALIGN_LEFT) ? ADC_CFGR1_ALIGN : 0U));
+
+	conv_bits   = (uint8_t)res_bits;
+	result_bits = (uint8_t)bits;
+
+	ADC1_Enable();
 
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_GetResolutionBits()
+ * Purpose  : Converter resolution in bits (RES)
+ * Details  : 12, 10, 8 or 6
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC1_GetResolutionBits(void) {
+
+	return conv_bits;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_GetResultBits()
+ * Purpose  : Bits spanned by each ADC_DR result
+ * Details  : After oversampling and alignment. <= 8 fits the
+ *            byte buffers of ADC_Start_DMA8()
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC1_GetResultBits(void) {
+
+	return result_bits;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigTimerTrigger()
+ * Purpose  : 14.4: Start each scan on TIM3 TRGO instead of CONT
+ * Details  : CONT = 0, EXTSEL = TIM3_TRGO, EXTEN = rising edge.
+ *            ADSTART (ADC_Start_DMA) arms the trigger. Rate is per
+ *            scan; pTimebase reports the exact achieved rate.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC1_ConfigTimerTrigger(uint32_t RateHz, TIM_Timebase_t *pTimebase) {
+
+	ADC1_Stop();                                                  //CFGR1 is only writable with ADSTART = 0
+	TIM3_Stop();
+
+	if (!TIM3_ConfigTRGO(RateHz, pTimebase)) {
+		return false;
+	}
+
+	/*
+	 * 14.3.10+11: Conversion modes (CONT = 0) and 14.4: external trigger (EXTSEL, EXTEN)
+	 */
+	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_CONT);                       //0: One scan per trigger
+	MODIFY_REG(ADC1->CFGR1, ADC_CFGR1_EXTSEL | ADC_CFGR1_EXTEN,
+	           (ADC_EXTSEL_TIM3_TRGO << ADC_CFGR1_EXTSEL_Pos) |
+	           (ADC_EXTEN_RISING << ADC_CFGR1_EXTEN_Pos));
+
+	TIM3_Start();                                                 //Triggers are ignored until ADSTART = 1
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigFreeRun()
+ * Purpose  : Back to software-started continuous conversions
+ * Details  : EXTEN = 00, CONT = 1, TIM3 stopped
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_ConfigFreeRun(void) {
+
+	ADC1_Stop();
+	TIM3_Stop();
+
+	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_EXTEN);                      //00: Hardware trigger disabled
+	SET_BIT(ADC1->CFGR1, ADC_CFGR1_CONT);                         //1: Continuous conversion mode
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ConfigAutoOff()
+ * Purpose  : 14.5: Low-power features (AUTOFF, WAIT)
+ * Details  : AUTOFF powers the analog part down between scans,
+ *            WAIT holds the next conversion until DR is read, so
+ *            OVR cannot occur. Pays off with timer triggers.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_ConfigAutoOff(bool Enable) {
+
+	ADC1_Stop();                                                  //CFGR1 is only writable with ADSTART = 0
+
+	if (Enable) {
+		SET_BIT(ADC1->CFGR1, ADC_CFGR1_AUTOFF | ADC_CFGR1_WAIT);  //1: Auto-off, 1: Wait conversion mode
+	} else {
+		CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_AUTOFF | ADC_CFGR1_WAIT);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_AdoptConfig()
+ * Purpose  : Record a configuration written to the registers
+ *            outside this file (adc.hpp register images)
+ * Details  : Scan order and bit widths only, no register access.
+ *            Keeps ADC_Scan_*() and ADC1_Get*Bits() in step.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_AdoptConfig(const uint8_t *pOrder, uint32_t Length, uint32_t ResolutionBits, uint32_t ResultBits) {
+
+	if ((pOrder == NULL) || (Length == 0U) || (Length > ADC_SCAN_MAX_CHANNELS)) {
+		return;
+	}
+	for (uint32_t i = 0; i < Length; i++) {
+		scan_order[i] = pOrder[i];
+	}
+	scan_length = (uint8_t)Length;
+	conv_bits   = (uint8_t)ResolutionBits;
+	result_bits = (uint8_t)ResultBits;
 }
 
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
@@ -156,18 +721,100 @@ void ADC1_Start(void) {
 
 }
 
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_Stop()
+ * Purpose  : Stop ongoing conversions
+ * Details  : Sets ADSTP and waits until the ADC acknowledges
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC1_Stop(void) {
+
+	if (ADC1->CR & ADC_CR_ADSTART) {
+		SET_BIT(ADC1->CR, ADC_CR_ADSTP);
+		while (ADC1->CR & ADC_CR_ADSTP) {                         //ADSTP and ADSTART cleared by hardware
+			/*
+			 * ⏳...
+			 */
+		}
+	}
+}
+
 /* ────────────────────────────────────────────────────────────── /
  * Function : ADC1_Read()
  * Purpose  : Read ADC1 conversion result
- * Details  : Returns ADC result after conversion
+ * Details  : Returns ADC result after conversion. Spins on
+ *            EOC: ADC1_ReadAsync() (adc_async.c) does not.
  * Runtime  : ~X.Xxx
  * ────────────────────────────────────────────────────────────── */
 uint16_t ADC1_Read(void){
+	uint32_t spins = 0;
 
-	while (!(ADC1->ISR & ADC_ISR_EOC));                           //Wait for end of conversion (EOC)
+	while (!(ADC1->ISR & ADC_ISR_EOC)) {                          //Wait for end of conversion (EOC)
+		spins++;
+	}
+	ADC_INSTR_READ_SPINS(spins);
 
-	return ADC1->DR;                                              //Read the value
+	return (uint16_t)READ_REG(ADC1->DR);                          //Read the value (clears EOC)
 }
 
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           SCAN DE-INTERLEAVING                                           */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Scan_GetLength()
+ * Purpose  : Number of conversions in one scan
+ * Details  : DMA blocks should be a multiple of this length
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Scan_GetLength(void) {
 
+	return scan_length;
+}
 
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Scan_GetOrder()
+ * Purpose  : Channel number converted at each scan position
+ * Details  : pChannels must hold ADC_SCAN_MAX_CHANNELS entries
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Scan_GetOrder(uint8_t *pChannels) {
+
+	for (uint32_t i = 0; i < scan_length; i++) {
+		pChannels[i] = scan_order[i];
+	}
+	return scan_length;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Scan_Deinterleave()
+ * Purpose  : Split an interleaved DMA block into per-channel runs
+ * Details  : pOut[i] receives scan position i (see GetOrder).
+ *            pData must start on a scan boundary. Returns the
+ *            number of samples written to each pOut[i].
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Scan_Deinterleave(const uint16_t *pData, uint32_t Length, uint16_t *const pOut[]) {
+	const uint32_t n      = scan_length;
+	const uint32_t frames = Length / n;
+
+	for (uint32_t c = 0; c < n; c++) {
+		const uint16_t *src = &pData[c];
+		uint16_t       *dst = pOut[c];
+		uint32_t        f   = frames;
+
+		while (f >= 2U) {                                         //Strided gather, unrolled by 2
+			dst[0] = src[0];
+			dst[1] = src[n];
+			src   += 2U * n;
+			dst   += 2;
+			f     -= 2U;
+		}
+		if (f) {
+			dst[0] = src[0];
+		}
+	}
+
+	return frames;
+}
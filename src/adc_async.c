@@ -0,0 +1,287 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_async.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 28, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Interrupt Sampling - EOC / EOS Callbacks, No Polling  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Low-rate sampling without DMA and without busy-waiting: the ADC raises EOC per conversion and EOS per    *
+ * scan, the interrupt moves ADC_DR into a scan-ordered result array and hands it to the callbacks.         *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - ADC1_ReadAsync(): one software-started scan (CONT = 0, EXTEN = 00), returns at once; the previous    *
+ *     conversion mode is restored at EOS.                                                                  *
+ *   - ADC_Async_Start(): conversions keep running in the configured mode, OnConversion / OnSequence per    *
+ *     EOC / EOS, OnOverrun on OVR.                                                                         *
+ *   - A scan hit by an overrun is dropped and counted, the next EOS re-synchronises the scan position.     *
+ *   - ADC_Async_GetLast() returns the newest complete scan for callers that poll instead.                  *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - One interrupt per conversion: meant for rates of a few kHz at most, the DMA stream is for more.      *
+ *   - CFGR1 and IER are only changed with ADSTART = 0 (single mode clears it at EOS by itself).            *
+ *   - ADC1_Read() remains for code that has nothing else to do; it spins on EOC.                           *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_async.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           ASYNC STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define ASYNC_FLAGS                          (ADC_ISR_EOC | ADC_ISR_EOS | ADC_ISR_OVR)         // Same bits in IER
+#define ASYNC_CFGR1_MODE                     (ADC_CFGR1_CONT | ADC_CFGR1_EXTEN | ADC_CFGR1_DMAEN | ADC_CFGR1_DMACFG)
+
+static ADC_AsyncConfig_t      async_config;
+static ADC_SequenceCallback_t async_read_callback;
+static void                  *async_read_ctx;
+static volatile bool          async_running;                     //ADC_Async_Start()
+static volatile bool          async_oneshot;                     //ADC1_ReadAsync() scan in flight
+static uint32_t               async_cfgr1;                       //Mode bits saved by ADC1_ReadAsync()
+static uint8_t                async_order[ADC_SCAN_MAX_CHANNELS];
+static uint32_t               async_length;
+static uint16_t               async_results[ADC_SCAN_MAX_CHANNELS];  //Scan being collected
+static uint16_t               async_last[ADC_SCAN_MAX_CHANNELS];     //Newest complete scan
+static uint32_t               async_index;                       //Next scan position
+static bool                   async_broken;                      //OVR in the current scan
+static ADC_AsyncStats_t       async_stats;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_Arm()
+ * Purpose  : Take the scan order, clear flags, unmask EOC/EOS/OVR
+ * Details  : ADSTART = 0. Enables ADC1_IRQn.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Async_Arm(void) {
+
+	async_length = ADC_Scan_GetOrder(async_order);
+	async_index  = 0;
+	async_broken = false;
+
+	WRITE_REG(ADC1->ISR, ASYNC_FLAGS);                            //Clear stale EOC/EOS/OVR (write 1)
+	SET_BIT(ADC1->IER, ASYNC_FLAGS);                              //EOCIE, EOSIE, OVRIE
+
+	HAL_NVIC_SetPriority(ADC1_IRQn, ADC_ASYNC_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(ADC1_IRQn);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_Disarm()
+ * Purpose  : Mask EOC/EOS/OVR, restore the ReadAsync() mode
+ * Details  : Conversions stopped (ADSTART = 0)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Async_Disarm(void) {
+
+	CLEAR_BIT(ADC1->IER, ASYNC_FLAGS);
+	WRITE_REG(ADC1->ISR, ASYNC_FLAGS);
+
+	if (async_oneshot) {
+		MODIFY_REG(ADC1->CFGR1, ASYNC_CFGR1_MODE, async_cfgr1);
+		async_oneshot = false;
+	}
+	async_running = false;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONTROL                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_Start()
+ * Purpose  : Interrupt-driven sampling in the configured mode
+ * Details  : Stops conversions, clears DMAEN, keeps CONT or the
+ *            timer trigger. Callbacks may be NULL (poll with
+ *            ADC_Async_GetLast()).
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Async_Start(const ADC_AsyncConfig_t *pConfig) {
+
+	if (pConfig == NULL) {
+		return false;
+	}
+
+	ADC_Async_Stop();
+	async_config = *pConfig;
+
+	CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_DMAEN | ADC_CFGR1_DMACFG);   //Results stay in DR for the EOC interrupt
+	ADC_Async_Arm();
+	async_running = true;
+
+	ADC1_Start();
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_Stop()
+ * Purpose  : Stop conversions and the interrupts of this module
+ * Details  : Also cancels a pending ADC1_ReadAsync() (no call)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Async_Stop(void) {
+
+	ADC1_Stop();
+	ADC_Async_Disarm();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC1_ReadAsync()
+ * Purpose  : Convert the configured channels once, don't wait
+ * Details  : False while converting (stream, Start, a previous
+ *            read). Callback (ADC1 interrupt context, may be
+ *            NULL) gets the scan at EOS, Length 0 if an overrun
+ *            lost part of it.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC1_ReadAsync(ADC_SequenceCallback_t Callback, void *pCtx) {
+
+	if (async_running || async_oneshot || (ADC1->CR & ADC_CR_ADSTART) || !(ADC1->CR & ADC_CR_ADEN)) {
+		return false;
+	}
+
+	async_read_callback = Callback;
+	async_read_ctx      = pCtx;
+	async_cfgr1         = READ_REG(ADC1->CFGR1) & ASYNC_CFGR1_MODE;
+
+	CLEAR_BIT(ADC1->CFGR1, ASYNC_CFGR1_MODE);                     //CONT = 0, EXTEN = 00, DMAEN = 0: one scan
+	ADC_Async_Arm();
+	async_oneshot = true;
+
+	ADC1_Start();
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_IsBusy()
+ * Purpose  : ADC1_ReadAsync() scan still converting
+ * Details  : __WFI() until false instead of spinning on it
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Async_IsBusy(void) {
+
+	return async_oneshot;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_GetLast()
+ * Purpose  : Newest complete scan, one result per scan position
+ * Details  : Returns its number (ADC_AsyncStats_t.Sequences),
+ *            0 before the first one. pResults may be NULL.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Async_GetLast(uint16_t *pResults) {
+	uint32_t primask = __get_PRIMASK();
+	uint32_t sequence;
+
+	__disable_irq();
+	sequence = async_stats.Sequences;
+	if (pResults != NULL) {
+		for (uint32_t i = 0; i < async_length; i++) {
+			pResults[i] = async_last[i];
+		}
+	}
+	__set_PRIMASK(primask);
+
+	return sequence;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_GetStats()
+ * Purpose  : Copy the interrupt counters
+ * Details  : None
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Async_GetStats(ADC_AsyncStats_t *pStats) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	*pStats = async_stats;
+	__set_PRIMASK(primask);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT HANDLING                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Async_IRQHandler()
+ * Purpose  : Serve OVR, EOC (read DR) and EOS in that order
+ * Details  : Call from ADC1_IRQHandler(). The last EOC of a scan
+ *            and its EOS arrive together and are served in one
+ *            entry.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Async_IRQHandler(void) {
+	uint32_t pending = ADC1->ISR & ADC1->IER & ASYNC_FLAGS;
+	bool     complete;
+
+	if (pending == 0U) {
+		return;
+	}
+
+	if (pending & ADC_ISR_OVR) {
+		WRITE_REG(ADC1->ISR, ADC_ISR_OVR);                        //OVRMOD = 0: DR still holds the older result
+		async_stats.Overruns++;
+		async_broken = true;
+		if (async_config.OnOverrun != NULL) {
+			async_config.OnOverrun(async_config.pCtx);
+		}
+	}
+
+	if (pending & ADC_ISR_EOC) {
+		uint16_t value = (uint16_t)READ_REG(ADC1->DR);            //Clears EOC
+		uint32_t index = async_index;
+
+		async_stats.Conversions++;
+		if (index < async_length) {
+			async_results[index] = value;
+			if (async_running && (async_config.OnConversion != NULL)) {
+				async_config.OnConversion(index, async_order[index], value, async_config.pCtx);
+			}
+		} else {
+			async_broken = true;                                  //More EOCs than positions: EOS was lost
+		}
+		async_index = index + 1U;
+	}
+
+	if (!(pending & ADC_ISR_EOS)) {
+		return;
+	}
+
+	WRITE_REG(ADC1->ISR, ADC_ISR_EOS);                            //Clear EOS (write 1)
+	complete = !async_broken && (async_index == async_length);
+	if (complete) {
+		for (uint32_t i = 0; i < async_length; i++) {
+			async_last[i] = async_results[i];
+		}
+		async_stats.Sequences++;
+	} else {
+		async_stats.Incomplete++;
+	}
+	async_index  = 0;
+	async_broken = false;
+
+	if (async_oneshot) {
+		ADC_SequenceCallback_t callback = async_read_callback;
+
+		ADC1_Stop();                                              //Single mode: ADSTART is already 0
+		ADC_Async_Disarm();
+		if (callback != NULL) {
+			callback(async_results, complete ? async_length : 0U, async_read_ctx);
+		}
+	} else if (complete && (async_config.OnSequence != NULL)) {
+		async_config.OnSequence(async_results, async_length, async_config.pCtx);
+	}
+}
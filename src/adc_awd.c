@@ -0,0 +1,263 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_awd.c                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 30, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Analog Watchdogs - Window Events with Hysteresis      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Event-driven monitoring with the ADC analog watchdogs: the converter keeps running, the CPU only         *
+ * wakes when a conversion leaves its window.                                                               *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - AWD1 on one channel or all channels (AWD1SGL/AWD1CH), AWD2/AWD3 on one channel each (AWD2CR/AWD3CR). *
+ *   - One callback per watchdog with ABOVE / BELOW / INSIDE events.                                        *
+ *   - Software hysteresis: after an excursion the window is moved so that only the return (by              *
+ *     Hysteresis codes) raises the next interrupt, then the original window is restored.                   *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - AWDxCR/AWD1EN are only writable with ADSTART = 0: ADC_AWD_Config() stops conversions.                *
+ *   - Thresholds (AWDxTR) may be rewritten while converting, which is what the hysteresis relies on.       *
+ *   - The reported value is ADC_DR at interrupt time, i.e. the conversion that raised the flag as long     *
+ *     as the interrupt is served within one conversion time. In a scan or under DMA, DR may already hold   *
+ *     another channel or a later conversion: a value that does not explain the flag is dropped and counted *
+ *     (ADC_AWD_GetMissed()). A level that stays out raises the flag again; a one-sample spike is lost.     *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_awd.h"
+#include "stm32g030xx.h"
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           WATCHDOG STATE                                                 */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef enum {
+	AWD_STATE_ARMED = 0,                                          //Window [Low, High]
+	AWD_STATE_ABOVE = 1,                                          //Window [High - Hyst, MAX]: wait for return
+	AWD_STATE_BELOW = 2                                           //Window [0, Low + Hyst]: wait for return
+} AWD_State_t;
+
+static ADC_AWD_Config_t     awd_config[ADC_AWD_COUNT];
+static volatile AWD_State_t awd_state[ADC_AWD_COUNT];
+static volatile uint32_t    awd_missed[ADC_AWD_COUNT];          //Flags whose DR value could not be attributed
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_SetWindow()
+ * Purpose  : Program HTx/LTx of one watchdog
+ * Details  : Takes effect from the next conversion
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_AWD_SetWindow(ADC_AWD_t Watchdog, uint32_t Low, uint32_t High) {
+	uint32_t tr = (High << ADC_AWD1TR_HT1_Pos) | (Low << ADC_AWD1TR_LT1_Pos);  //Same layout for TR1..TR3
+
+	switch (Watchdog) {
+	case ADC_AWD1: WRITE_REG(ADC1->AWD1TR, tr); break;
+	case ADC_AWD2: WRITE_REG(ADC1->AWD2TR, tr); break;
+	default:       WRITE_REG(ADC1->AWD3TR, tr); break;
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONFIGURATION                                                  */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_Config()
+ * Purpose  : Configure and arm one analog watchdog
+ * Details  : Stops conversions (ADSTART = 0 needed), restart
+ *            them afterwards. Enables ADC1_IRQn.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_AWD_Config(ADC_AWD_t Watchdog, const ADC_AWD_Config_t *pConfig) {
+	uint32_t flag;
+
+	if ((Watchdog >= ADC_AWD_COUNT) || (pConfig == NULL) || (pConfig->Callback == NULL)) {
+		return false;
+	}
+	if ((pConfig->Low > pConfig->High) || (pConfig->High > ADC_AWD_THRESHOLD_MAX)) {
+		return false;
+	}
+	if ((pConfig->Channels != ADC_AWD_ALL_CHANNELS) && ((pConfig->Channels == 0U) || (pConfig->Channels & ~ADC_CHSELR_CHSEL))) {
+		return false;
+	}
+	if ((Watchdog == ADC_AWD1) && (pConfig->Channels != ADC_AWD_ALL_CHANNELS) && (pConfig->Channels & (pConfig->Channels - 1U))) {
+		return false;                                             //AWD1 guards one channel or all of them
+	}
+	if ((Watchdog != ADC_AWD1) && (pConfig->Channels & (pConfig->Channels - 1U))) {
+		return false;                                             //AWD2/AWD3: one channel, DR must tell its value
+	}
+
+	ADC1_Stop();
+
+	flag = ADC_ISR_AWD1 << (uint32_t)Watchdog;                    //AWD1..3 flags are adjacent (same in IER)
+	CLEAR_BIT(ADC1->IER, flag);
+
+	awd_config[Watchdog] = *pConfig;
+	awd_state[Watchdog]  = AWD_STATE_ARMED;
+	awd_missed[Watchdog] = 0;
+	ADC_AWD_SetWindow(Watchdog, pConfig->Low, pConfig->High);
+
+	/*
+	 * 14.8: Analog window watchdogs (AWD1EN, AWD1SGL, AWD1CH, AWD2CR, AWD3CR)
+	 */
+	switch (Watchdog) {
+	case ADC_AWD1:
+		if (pConfig->Channels == ADC_AWD_ALL_CHANNELS) {
+			CLEAR_BIT(ADC1->CFGR1, ADC_CFGR1_AWD1SGL);            //0: All channels
+		} else {
+			uint32_t ch = 0;
+			while (!(pConfig->Channels & (1UL << ch))) {
+				ch++;
+			}
+			MODIFY_REG(ADC1->CFGR1, ADC_CFGR1_AWD1CH, ch << ADC_CFGR1_AWD1CH_Pos);
+			SET_BIT(ADC1->CFGR1, ADC_CFGR1_AWD1SGL);              //1: Single channel (AWD1CH)
+		}
+		SET_BIT(ADC1->CFGR1, ADC_CFGR1_AWD1EN);
+		break;
+
+	case ADC_AWD2:
+		WRITE_REG(ADC1->AWD2CR, pConfig->Channels & ADC_CHSELR_CHSEL);
+		break;
+
+	default:
+		WRITE_REG(ADC1->AWD3CR, pConfig->Channels & ADC_CHSELR_CHSEL);
+		break;
+	}
+
+	WRITE_REG(ADC1->ISR, flag);                                   //Clear a stale AWDx flag (write 1)
+	SET_BIT(ADC1->IER, flag);
+
+	HAL_NVIC_SetPriority(ADC1_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(ADC1_IRQn);
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_Disable()
+ * Purpose  : Stop reporting events of one watchdog
+ * Details  : Masks AWDxIE only, conversions keep running
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_AWD_Disable(ADC_AWD_t Watchdog) {
+	uint32_t flag = ADC_ISR_AWD1 << (uint32_t)Watchdog;
+
+	CLEAR_BIT(ADC1->IER, flag);
+	WRITE_REG(ADC1->ISR, flag);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_Enable()
+ * Purpose  : Resume events of a configured watchdog
+ * Details  : Drops the flag of excursions seen while masked, so
+ *            the next out-of-window conversion is the first event
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_AWD_Enable(ADC_AWD_t Watchdog) {
+	uint32_t flag = ADC_ISR_AWD1 << (uint32_t)Watchdog;
+
+	WRITE_REG(ADC1->ISR, flag);
+	SET_BIT(ADC1->IER, flag);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_GetMissed()
+ * Purpose  : Flags dropped since ADC_AWD_Config()
+ * Details  : DR at interrupt time did not explain the flag
+ *            (another channel or a later conversion)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_AWD_GetMissed(ADC_AWD_t Watchdog) {
+
+	return (Watchdog < ADC_AWD_COUNT) ? awd_missed[Watchdog] : 0U;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT HANDLING                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_Service()
+ * Purpose  : Advance the hysteresis state of one watchdog
+ * Details  : Moves the window, then calls the user callback.
+ *            Only a value outside the window currently armed
+ *            raised the flag: any other (DR of another channel
+ *            or conversion) is counted as missed, no event
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_AWD_Service(ADC_AWD_t Watchdog, uint16_t Value) {
+	const ADC_AWD_Config_t *cfg   = &awd_config[Watchdog];
+	uint32_t                above = (cfg->High > cfg->Hysteresis) ? (uint32_t)(cfg->High - cfg->Hysteresis) : 0U;
+	uint32_t                below = (uint32_t)cfg->Low + cfg->Hysteresis;
+	ADC_AWD_Event_t         event;
+
+	if (below > ADC_AWD_THRESHOLD_MAX) {
+		below = ADC_AWD_THRESHOLD_MAX;
+	}
+
+	if ((awd_state[Watchdog] == AWD_STATE_ARMED) && (Value > cfg->High)) {
+		ADC_AWD_SetWindow(Watchdog, above, ADC_AWD_THRESHOLD_MAX);  //Window [High - Hyst, MAX]
+		awd_state[Watchdog] = AWD_STATE_ABOVE;
+		event = ADC_AWD_EVENT_ABOVE;
+	} else if ((awd_state[Watchdog] == AWD_STATE_ARMED) && (Value < cfg->Low)) {
+		ADC_AWD_SetWindow(Watchdog, 0, below);                    //Window [0, Low + Hyst]
+		awd_state[Watchdog] = AWD_STATE_BELOW;
+		event = ADC_AWD_EVENT_BELOW;
+	} else if (((awd_state[Watchdog] == AWD_STATE_ABOVE) && (Value < above)) ||
+	           ((awd_state[Watchdog] == AWD_STATE_BELOW) && (Value > below))) {
+		ADC_AWD_SetWindow(Watchdog, cfg->Low, cfg->High);         //Returned by at least Hysteresis: re-arm
+		awd_state[Watchdog] = AWD_STATE_ARMED;
+		event = ADC_AWD_EVENT_INSIDE;
+	} else {
+		awd_missed[Watchdog]++;                                   //Not the flagged sample: cannot tell the side
+		return;
+	}
+
+	cfg->Callback(Watchdog, event, Value);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_AWD_IRQHandler()
+ * Purpose  : Service AWD1..AWD3 flags
+ * Details  : Call from ADC1_IRQHandler(), after the EOC owner
+ *            (ADC_Async_IRQHandler()): reading DR clears EOC.
+ *            An EOC still pending under EOCIE is left to it, the
+ *            flags are served on the next entry. DR is scaled to
+ *            12 bits (RES, ALIGN, OVS) to meet the thresholds.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_AWD_IRQHandler(void) {
+	uint32_t isr     = ADC1->ISR;
+	uint32_t ier     = ADC1->IER;
+	uint32_t pending = isr & ier & (ADC_ISR_AWD1 | ADC_ISR_AWD2 | ADC_ISR_AWD3);
+	uint32_t bits    = ADC1_GetResultBits();
+	uint32_t value;
+
+	if (pending == 0U) {
+		return;
+	}
+	if ((isr & ier & ADC_ISR_EOC) && !(ADC1->CFGR1 & ADC_CFGR1_DMAEN)) {
+		return;                                                   //Sample not taken yet: DR belongs to the EOC ISR
+	}
+
+	value = READ_REG(ADC1->DR) & ADC_DR_DATA;                     //Moved by DMA or the EOC ISR, re-reading is harmless
+	value = (bits >= 12U) ? (value >> (bits - 12U)) : (value << (12U - bits));  //Thresholds are 12-bit codes
+	WRITE_REG(ADC1->ISR, pending);                                //Clear the AWDx flags (write 1)
+
+	for (uint32_t wd = 0; wd < (uint32_t)ADC_AWD_COUNT; wd++) {
+		if (pending & (ADC_ISR_AWD1 << wd)) {
+			ADC_AWD_Service((ADC_AWD_t)wd, (uint16_t)value);
+		}
+	}
+}
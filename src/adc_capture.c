@@ -0,0 +1,545 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_capture.c                        ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 18, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Triggered Capture - Pre-Trigger History over DMA      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Fault recorder on top of the circular ADC_Start_DMA16() mode.                                            *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - While waiting for the trigger nothing runs on the core: DMA1 Channel1 is masked in the NVIC after    *
+ *     the first half-transfer (pre-trigger history filled), level/slope triggers come from AWD1 in         *
+ *     hardware, GPIO triggers from EXTI.                                                                   *
+ *   - The trigger ISR reads CNDTR first. For AWD triggers it walks back from that write position over      *
+ *     the trigger channel's samples to the first one past Level after the last re-arm sample, so the       *
+ *     trigger point is exact even when the ISR ran a few samples late.                                     *
+ *   - Post-trigger samples are counted from CNDTR at each HT/TC; once complete ADSTP and EN = 0 freeze     *
+ *     the buffer.                                                                                          *
+ *   - The result is two contiguous runs of the DMA buffer in time order: no memmove, no copy.              *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Slopes reuse the hysteresis state machine of adc_awd.c: RISING is the INSIDE event of a window       *
+ *     [Level - Hysteresis, MAX], FALLING the one of [0, Level + Hysteresis].                               *
+ *   - AWD compares 12-bit codes: level/slope triggers need right-aligned results without oversampling.     *
+ *   - The DMA channel, ADC1 and AWD1 belong to the capture from Arm to Done/Abort; restart the stream      *
+ *     afterwards.                                                                                          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_capture.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+
+#define CAPTURE_EXTICR_BITS  8U                                   //EXTImx field width in EXTI_EXTICRx
+#define CAPTURE_EXTI_PORTS   6U                                   //PA..PF
+#define CAPTURE_AWD_BITS     12U                                  //HTx/LTx compare 12-bit codes
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CAPTURE STATE                                                  */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint16_t                    *cap_buffer;
+static uint32_t                     cap_length;
+static uint32_t                     cap_scan;                     //Samples per scan
+static uint32_t                     cap_rank;                     //Scan position of the trigger channel
+static uint32_t                     cap_shift;                    //Result -> 12-bit AWD scale
+static ADC_CaptureConfig_t          cap_config;
+static volatile ADC_CaptureState_t  cap_state;
+static uint32_t                     cap_enable_pos;               //Write position when the trigger was enabled
+static uint32_t                     cap_trigger;                  //Buffer index of the trigger scan
+static int32_t                      cap_written;                  //Samples written from cap_trigger on
+static uint32_t                     cap_last;                     //Write position at the last count
+static ADC_Capture_t                cap_result;
+static uint32_t                     cap_channel;                  //DMA1 channel of the ADC
+static DMA_Channel_TypeDef         *cap_dma;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_WritePos()
+ * Purpose  : Buffer index the DMA writes next
+ * Details  : CNDTR counts down from Length, reloads at 0
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t ADC_Capture_WritePos(void) {
+	uint32_t pos = cap_length - cap_dma->CNDTR;
+
+	return (pos < cap_length) ? pos : 0U;
+}
+
+static uint32_t ADC_Capture_Ahead(uint32_t From, uint32_t To) {
+	return (To >= From) ? (To - From) : (To + cap_length - From);
+}
+
+static uint32_t ADC_Capture_Back(uint32_t Index, uint32_t Count) {
+	return (Index >= Count) ? (Index - Count) : (Index + cap_length - Count);
+}
+
+static bool ADC_Capture_IsRising(void) {
+	return (cap_config.Source == ADC_TRIG_LEVEL_ABOVE) || (cap_config.Source == ADC_TRIG_RISING);
+}
+
+static IRQn_Type ADC_Capture_ExtiIRQn(uint32_t Pin) {
+	return (Pin < 2U) ? EXTI0_1_IRQn : (Pin < 4U) ? EXTI2_3_IRQn : EXTI4_15_IRQn;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Source()
+ * Purpose  : Let the trigger source raise events, or mask it
+ * Details  : Excursions seen while masked are dropped, so a
+ *            level already crossed fires on the next sample
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Capture_Source(bool Enable) {
+	uint32_t line;
+
+	if (cap_config.Source != ADC_TRIG_GPIO) {
+		if (Enable) {
+			ADC_AWD_Enable(ADC_AWD1);
+		} else {
+			ADC_AWD_Disable(ADC_AWD1);
+		}
+		return;
+	}
+
+	line = 1UL << cap_config.ExtiPin;
+	if (Enable) {
+		WRITE_REG(EXTI->RPR1, line);                              //Clear stale edges (write 1)
+		WRITE_REG(EXTI->FPR1, line);
+		SET_BIT(EXTI->IMR1, line);
+	} else {
+		CLEAR_BIT(EXTI->IMR1, line);
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TRIGGER AND FREEZE                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Freeze()
+ * Purpose  : Stop ADC and DMA, publish the two-run view
+ * Details  : Samples written after the last post-trigger one
+ *            cost pre-trigger history only past the guard
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Capture_Freeze(void) {
+	uint32_t post = cap_config.PostScans * cap_scan;
+	uint32_t pre  = cap_config.PreScans * cap_scan;
+	uint32_t room, start, pos;
+
+	ADC1_Stop();
+	CLEAR_BIT(cap_dma->CCR, DMA_CCR_EN);
+
+	pos          = ADC_Capture_WritePos();
+	cap_written += (int32_t)ADC_Capture_Ahead(cap_last, pos);
+
+	room = ((uint32_t)cap_written < cap_length) ? (cap_length - (uint32_t)cap_written) : 0U;
+	if (pre > room) {
+		pre = room - (room % cap_scan);                           //DMA ran into the oldest history
+	}
+
+	start = ADC_Capture_Back(cap_trigger, pre);
+
+	cap_result.Length       = pre + post;
+	cap_result.TriggerIndex = pre;
+	cap_result.pFirst       = &cap_buffer[start];
+	cap_result.FirstLength  = (cap_result.Length < cap_length - start) ? cap_result.Length : (cap_length - start);
+	cap_result.SecondLength = cap_result.Length - cap_result.FirstLength;
+	cap_result.pSecond      = (cap_result.SecondLength != 0U) ? cap_buffer : NULL;
+
+	cap_state = ADC_CAPTURE_DONE;
+	if (cap_config.Callback != NULL) {
+		cap_config.Callback(&cap_result);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Count()
+ * Purpose  : Add the samples written since the last count
+ * Details  : Called at least every half buffer, so the distance
+ *            between two write positions is unambiguous
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Capture_Count(void) {
+	uint32_t pos = ADC_Capture_WritePos();
+
+	cap_written += (int32_t)ADC_Capture_Ahead(cap_last, pos);
+	cap_last     = pos;
+
+	if (cap_written >= (int32_t)(cap_config.PostScans * cap_scan)) {
+		ADC_Capture_Freeze();
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Fire()
+ * Purpose  : Latch the trigger scan, start counting post samples
+ * Details  : Pos = write position read at ISR entry, Written =
+ *            samples already in from Index on (< 0: not yet).
+ *            The DMA interrupt comes back with stale HT/TC gone.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Capture_Fire(uint32_t Pos, uint32_t Index, int32_t Written) {
+
+	ADC_Capture_Source(false);
+
+	cap_trigger = Index;
+	cap_written = Written;
+	cap_last    = Pos;
+	cap_state   = ADC_CAPTURE_TRIGGERED;
+
+	DMA1_ClearFlags(cap_channel, DMA_FLAG_HT | DMA_FLAG_TC);
+	HAL_NVIC_EnableIRQ(DMA1_GetIRQn(cap_channel));
+
+	ADC_Capture_Count();                                          //Short post-trigger part may be complete already
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Locate()
+ * Purpose  : Buffer index of the sample that tripped AWD1
+ * Details  : Walks back from Pos over the trigger channel only:
+ *            the oldest sample past Level newer than the last
+ *            re-arm sample (below Level - Hysteresis for RISING,
+ *            not above Level for LEVEL_ABOVE, mirrored falling).
+ *            Never earlier than the enable point. False when the
+ *            walk ran out of ADC_CAPTURE_SEARCH scans first.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool ADC_Capture_Locate(uint32_t Pos, uint32_t *pIndex) {
+	const bool     rising = ADC_Capture_IsRising();
+	const bool     slope  = (cap_config.Source == ADC_TRIG_RISING) || (cap_config.Source == ADC_TRIG_FALLING);
+	const int32_t  level  = (int32_t)cap_config.Level;
+	const int32_t  rearm  = rising ? (slope ? level - (int32_t)cap_config.Hysteresis : level + 1)
+	                               : (slope ? level + (int32_t)cap_config.Hysteresis : level - 1);
+	const uint32_t avail  = ADC_Capture_Ahead(cap_enable_pos, Pos);
+	uint32_t       last   = ADC_Capture_Back(Pos, 1U);
+	uint32_t       back   = ((last % cap_scan) + cap_scan - cap_rank) % cap_scan;
+	uint32_t       index  = ADC_Capture_Back(last, back);
+	bool           found  = false;
+
+	*pIndex = index;                                              //Fallback: newest trigger-channel sample
+	back   += 1U;                                                 //Distance of index behind Pos
+
+	for (uint32_t n = 0; n < ADC_CAPTURE_SEARCH; n++) {
+		int32_t x;
+
+		if (back > avail) {
+			return found;                                         //Older samples predate the enable
+		}
+
+		x = (int32_t)((uint32_t)cap_buffer[index] << cap_shift);
+		if (rising ? (x < rearm) : (x > rearm)) {
+			return found;
+		}
+		if (rising ? (x > level) : (x < level)) {
+			*pIndex = index;
+			found   = true;
+		}
+
+		index  = ADC_Capture_Back(index, cap_scan);
+		back  += cap_scan;
+	}
+
+	return false;                                                 //Trigger may be older than the search
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_OnAwd()
+ * Purpose  : AWD1 event from ADC_AWD_IRQHandler()
+ * Details  : Levels fire on ABOVE/BELOW, slopes on INSIDE (the
+ *            return after the re-arm excursion)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Capture_OnAwd(ADC_AWD_t Watchdog, ADC_AWD_Event_t Event, uint16_t Value) {
+	uint32_t        pos = ADC_Capture_WritePos();                 //First: the DMA keeps moving
+	uint32_t        index;
+	ADC_AWD_Event_t fire;
+	bool            exact;
+
+	(void)Watchdog;
+	(void)Value;
+
+	switch (cap_config.Source) {
+	case ADC_TRIG_LEVEL_ABOVE: fire = ADC_AWD_EVENT_ABOVE;  break;
+	case ADC_TRIG_LEVEL_BELOW: fire = ADC_AWD_EVENT_BELOW;  break;
+	default:                   fire = ADC_AWD_EVENT_INSIDE; break;
+	}
+	if ((Event != fire) || (cap_state != ADC_CAPTURE_ARMED)) {
+		return;
+	}
+
+	exact = ADC_Capture_Locate(pos, &index);
+
+	cap_result.Exact          = exact;
+	cap_result.TriggerLatency = ADC_Capture_Ahead(index, pos) - 1U;
+
+	index = ADC_Capture_Back(index, cap_rank);                    //Start of the trigger scan
+	ADC_Capture_Fire(pos, index, (int32_t)ADC_Capture_Ahead(index, pos));
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CAPTURE CONTROL                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_ConfigSource()
+ * Purpose  : Set up AWD1 or the EXTI line, events masked
+ * Details  : ADC_AWD_Config() stops conversions, so this runs
+ *            before the DMA start
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool ADC_Capture_ConfigSource(const ADC_CaptureConfig_t *pConfig) {
+	ADC_AWD_Config_t awd = { .Channels = 1UL << pConfig->Channel, .Hysteresis = pConfig->Hysteresis,
+	                         .Callback = ADC_Capture_OnAwd };
+	uint8_t          order[ADC_SCAN_MAX_CHANNELS];
+	uint32_t         n, line, shift;
+
+	if (pConfig->Source == ADC_TRIG_GPIO) {
+		if ((pConfig->ExtiPin > 15U) || (pConfig->ExtiPort >= CAPTURE_EXTI_PORTS) ||
+		    ((pConfig->Edge & ADC_EDGE_BOTH) == 0U)) {
+			return false;
+		}
+
+		line  = 1UL << pConfig->ExtiPin;
+		shift = (pConfig->ExtiPin & 3U) * CAPTURE_EXTICR_BITS;
+
+		CLEAR_BIT(EXTI->IMR1, line);
+		MODIFY_REG(EXTI->EXTICR[pConfig->ExtiPin >> 2], 0xFFUL << shift, (uint32_t)pConfig->ExtiPort << shift);
+		MODIFY_REG(EXTI->RTSR1, line, (pConfig->Edge & ADC_EDGE_RISING) ? line : 0U);
+		MODIFY_REG(EXTI->FTSR1, line, (pConfig->Edge & ADC_EDGE_FALLING) ? line : 0U);
+
+		HAL_NVIC_SetPriority(ADC_Capture_ExtiIRQn(pConfig->ExtiPin), 1, 0);
+		HAL_NVIC_EnableIRQ(ADC_Capture_ExtiIRQn(pConfig->ExtiPin));
+
+		cap_rank = 0;
+		return true;
+	}
+
+	if ((pConfig->Source > ADC_TRIG_FALLING) || (ADC1_GetResultBits() != ADC1_GetResolutionBits())) {
+		return false;                                             //Left-aligned / oversampled: not the AWD scale
+	}
+
+	n = ADC_Scan_GetOrder(order);
+	for (cap_rank = 0; (cap_rank < n) && (order[cap_rank] != pConfig->Channel); cap_rank++) {
+	}
+	if (cap_rank == n) {
+		return false;                                             //Channel is not converted
+	}
+
+	switch (pConfig->Source) {
+	case ADC_TRIG_LEVEL_ABOVE:
+		if (pConfig->Level >= ADC_AWD_THRESHOLD_MAX) {
+			return false;
+		}
+		awd.Low  = 0;
+		awd.High = pConfig->Level;
+		break;
+
+	case ADC_TRIG_LEVEL_BELOW:
+		if (pConfig->Level == 0U) {
+			return false;
+		}
+		awd.Low  = pConfig->Level;
+		awd.High = ADC_AWD_THRESHOLD_MAX;
+		break;
+
+	case ADC_TRIG_RISING:
+		if (pConfig->Level <= pConfig->Hysteresis) {
+			return false;                                         //Re-arm level below code 0
+		}
+		awd.Low  = (uint16_t)(pConfig->Level - pConfig->Hysteresis);
+		awd.High = ADC_AWD_THRESHOLD_MAX;
+		break;
+
+	default:
+		if ((uint32_t)pConfig->Level + pConfig->Hysteresis >= ADC_AWD_THRESHOLD_MAX) {
+			return false;
+		}
+		awd.Low  = 0;
+		awd.High = (uint16_t)(pConfig->Level + pConfig->Hysteresis);
+		break;
+	}
+
+	if (!ADC_AWD_Config(ADC_AWD1, &awd)) {
+		return false;
+	}
+	ADC_AWD_Disable(ADC_AWD1);                                    //Until the pre-trigger history is in
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Arm()
+ * Purpose  : Start circular acquisition and wait for a trigger
+ * Details  : Length: multiple of two scans, <= 65535. Pre + post
+ *            <= ADC_CAPTURE_MAX_SCANS(Length, scan length).
+ *            Stops a running stream or capture first.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Capture_Arm(uint16_t *pBuffer, uint32_t Length, const ADC_CaptureConfig_t *pConfig) {
+	uint32_t scan = ADC_Scan_GetLength();
+
+	if ((pBuffer == NULL) || (pConfig == NULL) || (scan == 0U) || (Length > 0xFFFFU) || (Length % (2U * scan))) {
+		return false;
+	}
+	if ((Length / 2U <= ADC_CAPTURE_GUARD) || (pConfig->PostScans == 0U) ||
+	    (pConfig->PreScans + pConfig->PostScans > ADC_CAPTURE_MAX_SCANS(Length, scan))) {
+		return false;
+	}
+	if (DMA1_GetAdcChannel() == DMA1_CHANNEL_ANY) {
+		return false;                                             //DMA1_InitAdc() not called
+	}
+
+	ADC_Capture_Abort();
+
+	cap_channel = DMA1_GetAdcChannel();
+	cap_dma     = DMA1_GetChannel(cap_channel);
+
+	cap_config = *pConfig;
+	cap_buffer = pBuffer;
+	cap_length = Length;
+	cap_scan   = scan;
+	cap_shift  = CAPTURE_AWD_BITS - ADC1_GetResolutionBits();
+
+	if (!ADC_Capture_ConfigSource(pConfig)) {
+		cap_config.Source = ADC_TRIG_LEVEL_ABOVE;                 //Keep the EXTI handler out
+		return false;
+	}
+
+	cap_result.Exact          = true;                             //EXTI: the edge is the ISR entry
+	cap_result.TriggerLatency = 0;
+	cap_state                 = ADC_CAPTURE_PREFILL;
+
+	DMA1_ClearFlags(cap_channel, DMA_FLAG_ALL);                   //No stale HT/TC from a previous stream
+	HAL_NVIC_EnableIRQ(DMA1_GetIRQn(cap_channel));
+
+	if (!ADC_Start_DMA16(ADC1, cap_dma, pBuffer, Length)) {
+		ADC_Capture_Abort();
+		return false;
+	}
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Abort()
+ * Purpose  : Drop a pending capture, release ADC and DMA
+ * Details  : A finished capture stays readable until re-armed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Capture_Abort(void) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	if ((cap_state != ADC_CAPTURE_IDLE) && (cap_state != ADC_CAPTURE_DONE)) {
+		ADC_Capture_Source(false);
+		ADC1_Stop();
+		CLEAR_BIT(cap_dma->CCR, DMA_CCR_EN);
+		DMA1_ClearFlags(cap_channel, DMA_FLAG_ALL);
+		HAL_NVIC_EnableIRQ(DMA1_GetIRQn(cap_channel));            //Masked while ARMED, the stream needs it
+		cap_state = ADC_CAPTURE_IDLE;
+	}
+	__set_PRIMASK(primask);
+}
+
+ADC_CaptureState_t ADC_Capture_GetState(void) {
+	return cap_state;
+}
+
+bool ADC_Capture_IsDone(void) {
+	return cap_state == ADC_CAPTURE_DONE;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_Get()
+ * Purpose  : Two-run view of the frozen capture
+ * Details  : False until the capture is done. The runs point
+ *            into the armed buffer, valid until the next Arm.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Capture_Get(ADC_Capture_t *pCapture) {
+
+	if (cap_state != ADC_CAPTURE_DONE) {
+		return false;
+	}
+	*pCapture = cap_result;
+	return true;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT HANDLING                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_IRQHandler()
+ * Purpose  : Service HT/TC of the ADC DMA channel while capturing
+ * Details  : False when no capture owns the channel, the stream
+ *            handler runs then. First event: history filled,
+ *            enable the trigger and mask the channel interrupt
+ *            (the whole vector if the channel shares one).
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Capture_IRQHandler(uint32_t Flags) {
+	ADC_CaptureState_t state = cap_state;
+	uint32_t           pending;
+
+	if ((state == ADC_CAPTURE_IDLE) || (state == ADC_CAPTURE_DONE)) {
+		return false;
+	}
+
+	pending = Flags & (DMA_FLAG_HT | DMA_FLAG_TC);
+	DMA1_ClearFlags(cap_channel, pending);
+
+	if (state == ADC_CAPTURE_PREFILL) {
+		cap_enable_pos = ADC_Capture_WritePos();                  //>= half a buffer in: pre-trigger history complete
+		cap_state      = ADC_CAPTURE_ARMED;
+		HAL_NVIC_DisableIRQ(DMA1_GetIRQn(cap_channel));           //Silent until the trigger
+		ADC_Capture_Source(true);
+	} else if (state == ADC_CAPTURE_TRIGGERED) {
+		ADC_Capture_Count();
+	}
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Capture_EXTI_IRQHandler()
+ * Purpose  : GPIO trigger
+ * Details  : Call from the EXTIx_IRQHandler of ExtiPin. The
+ *            trigger scan is the first one starting after the
+ *            edge; only this line's pending bits are cleared.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Capture_EXTI_IRQHandler(void) {
+	uint32_t line, pos, index, partial;
+
+	if (cap_config.Source != ADC_TRIG_GPIO) {
+		return;
+	}
+
+	pos  = ADC_Capture_WritePos();                                //First: the DMA keeps moving
+	line = 1UL << cap_config.ExtiPin;
+	if (!((EXTI->RPR1 | EXTI->FPR1) & line)) {
+		return;
+	}
+	WRITE_REG(EXTI->RPR1, line);
+	WRITE_REG(EXTI->FPR1, line);
+
+	if (cap_state != ADC_CAPTURE_ARMED) {
+		return;
+	}
+
+	partial = pos % cap_scan;
+	index   = (partial != 0U) ? (pos + cap_scan - partial) : pos;
+	index   = (index < cap_length) ? index : (index - cap_length);
+	ADC_Capture_Fire(pos, index, -(int32_t)((cap_scan - partial) % cap_scan));
+}
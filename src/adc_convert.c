@@ -0,0 +1,181 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_convert.c                        ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 14, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Conversion - Fixed-Point Code to Voltage Kernels      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Block conversion of raw ADC codes to voltage without floating point. The Cortex-M0+ has no FPU, so       *
+ * the float formula previously used in the DMA ISR goes through the soft-float library for every           *
+ * sample (int->float, two multiplies and two divides).                                                     *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Millivolt (uint16_t) and Q16.16 volt (uint32_t) block kernels, unrolled by 4.                        *
+ *   - Scale factors are integer constants folded at compile time (adc_convert.h).                          *
+ *   - ADC_Convert_Benchmark() times the float and fixed paths on the target with SysTick.                  *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Expected cost on the M0+: the float path spends a few hundred cycles per sample in                   *
+ *     __aeabi_ui2f/__aeabi_fmul/__aeabi_fdiv, the fixed path about 6 cycles per sample                     *
+ *     (LDRH, MULS, ADDS, LSRS, STRH + loop share). Use ADC_Convert_Benchmark() for real numbers.           *
+ *   - Conversion error against the exact formula stays within 1 mV over the full 12-bit range.            *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_convert.h"
+#include "adc_instr.h"
+#include "stm32g030xx.h"
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           BLOCK KERNELS                                                  */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Convert_Block_mV()
+ * Purpose  : Convert a DMA block of raw codes to millivolts
+ * Details  : pOut may alias pRaw for in-place conversion.
+ *            ADC_RESOLUTION_BITS codes: other result widths
+ *            use _Scaled with ADC_CONVERT_MV_Q16_BITS()
+ * Runtime  : ~6 cycles/sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Convert_Block_mV(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length) {
+	ADC_Convert_Block_mV_Scaled(pRaw, pOut, Length, ADC_CONVERT_MV_Q16);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Convert_Block_mV_Scaled()
+ * Purpose  : Same with a runtime Q16 scale (measured VDDA)
+ * Details  : ScaleQ16 <= ADC_CONVERT_MV_Q16_AT(3600) keeps the
+ *            product in 32 bits; the constant is a register on
+ *            the M0+ either way, so the fixed path costs the same
+ * Runtime  : ~6 cycles/sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Convert_Block_mV_Scaled(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length, uint32_t ScaleQ16) {
+	const uint32_t k = ScaleQ16;
+
+	while (Length >= 4U) {
+		uint32_t r0 = pRaw[0];
+		uint32_t r1 = pRaw[1];
+		uint32_t r2 = pRaw[2];
+		uint32_t r3 = pRaw[3];
+
+		pOut[0] = (uint16_t)((r0 * k + 0x8000UL) >> 16);
+		pOut[1] = (uint16_t)((r1 * k + 0x8000UL) >> 16);
+		pOut[2] = (uint16_t)((r2 * k + 0x8000UL) >> 16);
+		pOut[3] = (uint16_t)((r3 * k + 0x8000UL) >> 16);
+
+		pRaw   += 4;
+		pOut   += 4;
+		Length -= 4U;
+	}
+
+	while (Length--) {
+		*pOut++ = (uint16_t)(((uint32_t)*pRaw++ * k + 0x8000UL) >> 16);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Convert_Block_Q16()
+ * Purpose  : Convert a DMA block of raw codes to Q16.16 volts
+ * Details  : 1.0 V == 65536
+ * Runtime  : ~6 cycles/sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Convert_Block_Q16(const uint16_t *pRaw, uint32_t *pOut, uint32_t Length) {
+	const uint32_t k = ADC_CONVERT_V_Q24;
+
+	while (Length >= 4U) {
+		uint32_t r0 = pRaw[0];
+		uint32_t r1 = pRaw[1];
+		uint32_t r2 = pRaw[2];
+		uint32_t r3 = pRaw[3];
+
+		pOut[0] = (r0 * k + 0x80UL) >> 8;
+		pOut[1] = (r1 * k + 0x80UL) >> 8;
+		pOut[2] = (r2 * k + 0x80UL) >> 8;
+		pOut[3] = (r3 * k + 0x80UL) >> 8;
+
+		pRaw   += 4;
+		pOut   += 4;
+		Length -= 4U;
+	}
+
+	while (Length--) {
+		*pOut++ = ((uint32_t)*pRaw++ * k + 0x80UL) >> 8;
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CYCLE COMPARISON                                               */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Convert_Benchmark()
+ * Purpose  : Time float vs fixed-point conversion of one block
+ * Details  : Needs SysTick running (HAL_Init). Timed in runs of
+ *            ADC_CONVERT_BENCH_CHUNK samples, each well under one
+ *            tick, so ADC_Instr_Elapsed() never misses a reload.
+ *            PRIMASK is only held across one timed run: pending
+ *            DMA / SysTick IRQs are taken between runs.
+ * Runtime  : Length * (float + fixed cost)
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Convert_Benchmark(const uint16_t *pRaw, uint32_t Length, ADC_ConvertBench_t *pResult) {
+	static uint16_t  fixed_out[ADC_CONVERT_BENCH_MAX];
+	volatile float   float_out;
+	uint32_t         primask;
+	uint32_t         t0, t1, overhead, cycles, n;
+	uint32_t         float_cycles = 0, fixed_cycles = 0;
+
+	if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) || (Length > ADC_CONVERT_BENCH_MAX)) {
+		return false;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	t0 = SysTick->VAL;
+	t1 = SysTick->VAL;
+	__set_PRIMASK(primask);
+	overhead = ADC_Instr_Elapsed(t0, t1);
+
+	for (uint32_t i = 0; i < Length; i += n) {
+		n = ((Length - i) < ADC_CONVERT_BENCH_CHUNK) ? (Length - i) : ADC_CONVERT_BENCH_CHUNK;
+
+		/*
+		 * Reference: the formula from DMA1_Channel1_IRQHandler
+		 */
+		__disable_irq();
+		t0 = SysTick->VAL;
+		for (uint32_t j = i; j < i + n; j++) {
+			float_out = (V_REF_plus * pRaw[j] / 4095) * (47+10)/10;
+		}
+		t1 = SysTick->VAL;
+		__set_PRIMASK(primask);
+		cycles = ADC_Instr_Elapsed(t0, t1);
+		float_cycles += (cycles > overhead) ? (cycles - overhead) : 0U;
+
+		__disable_irq();
+		t0 = SysTick->VAL;
+		ADC_Convert_Block_mV(&pRaw[i], &fixed_out[i], n);
+		t1 = SysTick->VAL;
+		__set_PRIMASK(primask);
+		cycles = ADC_Instr_Elapsed(t0, t1);
+		fixed_cycles += (cycles > overhead) ? (cycles - overhead) : 0U;
+	}
+
+	pResult->FloatCycles = float_cycles;
+	pResult->FixedCycles = fixed_cycles;
+
+	(void)float_out;
+	pResult->Samples = Length;
+
+	return true;
+}
@@ -0,0 +1,218 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_decim.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 9, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Decimator - CIC + Compensating Q15 FIR on DMA Blocks  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Integer-only decimation for the Cortex-M0+: sample fast for anti-aliasing, hand the application a        *
+ * clean low-rate Q15 stream.                                                                               *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Raw codes are centred to signed Q15 (code << (16 - bits)) - 32768 on the way in.                     *
+ *   - CIC: 3 integrators per input, 3 combs per R inputs, all in uint32 (modulo arithmetic, overflow       *
+ *     cancels in the combs). Gain R^3 is removed by a shift plus a Q15 correction, so any R in 1..32.      *
+ *   - FIR: 16 symmetric Q15 taps, 8 multiplies per output (pairs folded), fully unrolled, mirrored delay   *
+ *     line so the MAC never wraps. Evaluated only every second CIC output.                                 *
+ *   - All state in ADC_Decim_t: blocks of any length, split anywhere, give the same output stream.         *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Taps: least-squares fit of 1/sinc^3 up to 0.2 * fs_out, stop band from fs_out / 2 (-43 dB there,    *
+ *     below -60 dB from 0.6 * fs_out), DC gain exactly 1. CIC + FIR is flat within 0.2 dB up to            *
+ *     0.2 * fs_out and -3.4 dB at 0.3 * fs_out.                                                            *
+ *   - Cost per input on the M0+: ~10 cycles (load, shift, 3 adds, phase), plus ~25 cycles per CIC output   *
+ *     and ~40 cycles per final output.                                                                     *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_decim.h"
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(ADC_DECIM_FIR_TAPS == 16U, "ADC_Decim_Fir() is unrolled for 16 taps");
+_Static_assert(ADC_DECIM_CIC_ORDER == 3U, "ADC_Decim_Process() is unrolled for a 3rd-order CIC");
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           COEFFICIENTS                                                   */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* First half of the symmetric compensator, outer tap first (h[15 - k] = h[k]), sum of all 16 = 32768 */
+static const int32_t decim_taps[ADC_DECIM_FIR_TAPS / 2U] = {
+	208, 299, -309, -1452, -1495, 1380, 6673, 11080
+};
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Sat16()
+ * Purpose  : Clamp to the int16 range
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline int16_t ADC_Decim_Sat16(int32_t x) {
+
+	if (x > INT16_MAX) {
+		return INT16_MAX;
+	}
+	if (x < INT16_MIN) {
+		return INT16_MIN;
+	}
+	return (int16_t)x;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Comb()
+ * Purpose  : Comb section + gain normalisation, one CIC output
+ * Details  : Result is Q15 in the input's scale
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int16_t ADC_Decim_Comb(ADC_Decim_t *pDecim, uint32_t x) {
+	uint32_t c1 = x  - pDecim->Comb[0];
+	uint32_t c2 = c1 - pDecim->Comb[1];
+	uint32_t c3 = c2 - pDecim->Comb[2];
+	int32_t  y;
+
+	pDecim->Comb[0] = x;
+	pDecim->Comb[1] = c1;
+	pDecim->Comb[2] = c2;
+
+	y = (int32_t)c3 >> pDecim->CicShift;                          //|c3| <= 2^15 * R^3, no wrap left
+	y = (y * pDecim->CicCorr + 0x4000L) >> 15;
+
+	return ADC_Decim_Sat16(y);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Fir()
+ * Purpose  : Push one CIC output, run the FIR every 2nd one
+ * Details  : Returns true when *pOut was written
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool ADC_Decim_Fir(ADC_Decim_t *pDecim, int16_t x, int16_t *pOut) {
+	uint32_t       idx = pDecim->DelayIndex;
+	const int16_t *w;
+	int32_t        acc;
+
+	pDecim->Delay[idx]                      = x;
+	pDecim->Delay[idx + ADC_DECIM_FIR_TAPS] = x;                  //Mirror: window is always contiguous
+	idx = (idx + 1U) & (ADC_DECIM_FIR_TAPS - 1U);
+	pDecim->DelayIndex = idx;
+
+	if (++pDecim->FirPhase < ADC_DECIM_FIR_RATIO) {
+		return false;
+	}
+	pDecim->FirPhase = 0;
+
+	w = &pDecim->Delay[idx];                                      //w[0] oldest ... w[15] newest
+
+	acc  = decim_taps[0] * ((int32_t)w[0] + w[15]);
+	acc += decim_taps[1] * ((int32_t)w[1] + w[14]);
+	acc += decim_taps[2] * ((int32_t)w[2] + w[13]);
+	acc += decim_taps[3] * ((int32_t)w[3] + w[12]);
+	acc += decim_taps[4] * ((int32_t)w[4] + w[11]);
+	acc += decim_taps[5] * ((int32_t)w[5] + w[10]);
+	acc += decim_taps[6] * ((int32_t)w[6] + w[9]);
+	acc += decim_taps[7] * ((int32_t)w[7] + w[8]);                //sum|h| < 1.4, |acc| < 2^31
+
+	*pOut = ADC_Decim_Sat16((acc + 0x4000L) >> 15);
+	return true;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONFIGURATION                                                  */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Init()
+ * Purpose  : Configure a decimator for Ratio = fs_in / fs_out
+ * Details  : Ratio even, 2..ADC_DECIM_RATIO_MAX; InputBits is
+ *            the DMA word width in use (8..16)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Decim_Init(ADC_Decim_t *pDecim, uint32_t Ratio, uint32_t InputBits) {
+	uint32_t r, gain, shift = 0;
+
+	if ((pDecim == NULL) || (Ratio < ADC_DECIM_FIR_RATIO) || (Ratio > ADC_DECIM_RATIO_MAX) ||
+	    ((Ratio % ADC_DECIM_FIR_RATIO) != 0U) || (InputBits < 8U) || (InputBits > 16U)) {
+		return false;
+	}
+
+	r    = Ratio / ADC_DECIM_FIR_RATIO;
+	gain = r * r * r;
+	while ((1UL << shift) < gain) {
+		shift++;
+	}
+
+	pDecim->CicRatio   = r;
+	pDecim->CicShift   = shift;
+	pDecim->CicCorr    = (int32_t)(((1UL << (15U + shift)) + gain / 2U) / gain);
+	pDecim->InputShift = 16U - InputBits;
+
+	ADC_Decim_Reset(pDecim);
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Reset()
+ * Purpose  : Clear filter state, keep the configuration
+ * Details  : Use after a gap in the input (stream restart)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Decim_Reset(ADC_Decim_t *pDecim) {
+
+	memset(pDecim->Integrator, 0, sizeof(pDecim->Integrator));
+	memset(pDecim->Comb, 0, sizeof(pDecim->Comb));
+	memset(pDecim->Delay, 0, sizeof(pDecim->Delay));
+	pDecim->DelayIndex = 0;
+	pDecim->CicPhase   = 0;
+	pDecim->FirPhase   = 0;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           BLOCK PROCESSING                                               */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Decim_Process()
+ * Purpose  : Filter one block of raw codes
+ * Details  : pOut needs ADC_DECIM_OUT_MAX(Length, Ratio) slots,
+ *            returns the number written
+ * Runtime  : ~10 cycles per input + per-output cost
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Decim_Process(ADC_Decim_t *pDecim, const uint16_t *pIn, uint32_t Length, int16_t *pOut) {
+	uint32_t i1    = pDecim->Integrator[0];                       //Integrators kept in registers
+	uint32_t i2    = pDecim->Integrator[1];
+	uint32_t i3    = pDecim->Integrator[2];
+	uint32_t phase = pDecim->CicPhase;
+	uint32_t ratio = pDecim->CicRatio;
+	uint32_t shift = pDecim->InputShift;
+	int16_t *pStart = pOut;
+
+	while (Length--) {
+		i1 += ((uint32_t)*pIn++ << shift) - 32768U;
+		i2 += i1;
+		i3 += i2;
+
+		if (++phase == ratio) {
+			phase = 0;
+			if (ADC_Decim_Fir(pDecim, ADC_Decim_Comb(pDecim, i3), pOut)) {
+				pOut++;
+			}
+		}
+	}
+
+	pDecim->Integrator[0] = i1;
+	pDecim->Integrator[1] = i2;
+	pDecim->Integrator[2] = i3;
+	pDecim->CicPhase      = phase;
+
+	return (uint32_t)(pOut - pStart);
+}
@@ -0,0 +1,247 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_export.c                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Capture Export - Packed Frames over USART2 DMA        ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Gets raw captures off the device without stalling acquisition or copying bytes on the CPU.               *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Samples are encoded once, straight into a frame buffer, and a DMA1 channel sends that buffer to      *
+ *     USART2 TDR: no staging copy, no per-byte interrupt. One DMA interrupt per frame.                     *
+ *   - Pool of ADC_EXPORT_FRAMES buffers used as a ring: the main loop fills, the DMA TC interrupt           *
+ *     retires the frame on the wire and starts the next queued one.                                        *
+ *   - Frames hold up to ADC_EXPORT_FRAME_SAMPLES samples and span DMA blocks, so framing costs 16 bytes    *
+ *     per frame, not per block.                                                                            *
+ *   - When every buffer is busy the samples are dropped and counted, acquisition is never held up.         *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - 12-bit codes at 7812 sps: 16-bit words need 156 kbaud, ADC_PACK_RAW ~122 kbaud, ADC_PACK_DELTA on    *
+ *     a slow signal ~60 kbaud. Wideband noise does not compress: DELTA then costs up to ~15 % over RAW.    *
+ *   - The queue count is shared with the DMA interrupt: it is incremented with interrupts masked.          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_export.h"
+#include "usart.h"
+#include "dma.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           EXPORT STATE                                                   */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint8_t            export_frame[ADC_EXPORT_FRAMES][ADC_EXPORT_FRAME_BYTES];
+static uint32_t           export_length[ADC_EXPORT_FRAMES];
+static ADC_PackWriter_t   export_writer;                          //Open frame (main loop only)
+static bool               export_open;
+static ADC_PackMode_t     export_mode;
+static uint32_t           export_bits;
+static uint32_t           export_fill;                            //Buffer being encoded
+static uint32_t           export_send;                            //Buffer on the wire (oldest queued)
+static volatile uint32_t  export_queued;                          //Closed frames not yet sent, incl. on the wire
+static volatile bool      export_busy;                            //DMA owns export_frame[export_send]
+static uint16_t           export_sequence;
+static uint32_t           export_index;                           //Stream index of the next sample offered
+static uint32_t           export_first;                           //Stream index of the open frame's first sample
+static ADC_ExportStats_t  export_stats;
+static uint32_t           export_channel;                         //DMA1 channel from DMA1_InitUsartTx(), 0 = none
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_Send()
+ * Purpose  : Hand the oldest queued frame to the DMA
+ * Details  : Interrupts masked or DMA interrupt context
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Export_Send(void) {
+
+	if (export_busy || (export_queued == 0U)) {
+		return;
+	}
+
+	export_busy = USART_Start_DMA(USART2, DMA1_GetChannel(export_channel), export_frame[export_send],
+	                              export_length[export_send]);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_Close()
+ * Purpose  : Finish the open frame and queue it
+ * Details  : CRC over the frame, then one masked section
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Export_Close(void) {
+	uint32_t length = ADC_Pack_End(&export_writer, export_sequence++, export_first);
+	uint32_t primask;
+
+	export_length[export_fill] = length;
+	export_fill  = (export_fill + 1U) % ADC_EXPORT_FRAMES;
+	export_open  = false;
+
+	export_stats.Frames++;
+	export_stats.Bytes   += length;
+	export_stats.Samples += export_writer.Count;
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	export_queued++;
+	ADC_Export_Send();
+	__set_PRIMASK(primask);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           EXPORT CONTROL                                                 */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_Init()
+ * Purpose  : Bring up USART2 + a DMA1 channel, empty the pool
+ * Details  : SampleBits = ADC1_GetResultBits() of the stream.
+ *            The channel is allocated once and kept.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Export_Init(uint32_t Baud, ADC_PackMode_t Mode, uint32_t SampleBits) {
+
+	if ((SampleBits == 0U) || (SampleBits > 16U) || ((Mode != ADC_PACK_RAW) && (Mode != ADC_PACK_DELTA))) {
+		return false;
+	}
+	if (!USART2_InitTx(Baud, NULL)) {
+		return false;
+	}
+	if (export_channel == DMA1_CHANNEL_ANY) {
+		const DMA_ChannelConfig_t dma = {
+			.Request     = DMA_REQ_USART2_TX,
+			.Channel     = DMA1_CHANNEL_ANY,
+			.Priority    = DMA_PRIORITY_MEDIUM,                   //Below the ADC: a late frame costs nothing
+			.IrqPriority = 2U,
+			.Handler     = ADC_Export_IRQHandler,
+			.pCtx        = NULL
+		};
+
+		export_channel = DMA1_InitUsartTx(&dma);
+		if (export_channel == DMA1_CHANNEL_ANY) {
+			return false;
+		}
+	}
+
+	export_mode     = Mode;
+	export_bits     = SampleBits;
+	export_open     = false;
+	export_fill     = 0;
+	export_send     = 0;
+	export_queued   = 0;
+	export_busy     = false;
+	export_sequence = 0;
+	export_index    = 0;
+
+	export_stats.Frames         = 0;
+	export_stats.Bytes          = 0;
+	export_stats.Samples        = 0;
+	export_stats.DroppedSamples = 0;
+	export_stats.DmaErrors      = 0;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_Block()
+ * Purpose  : Encode one block into the frame pool
+ * Details  : Returns the samples taken, the rest was dropped
+ *            (no free buffer). Main loop only.
+ * Runtime  : ~X.Xxx per sample
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Export_Block(const uint16_t *pData, uint32_t Length) {
+	uint32_t taken = 0;
+
+	while (taken < Length) {
+		if (!export_open) {
+			if (export_queued >= ADC_EXPORT_FRAMES) {
+				break;                                            //All buffers queued or on the wire
+			}
+			ADC_Pack_Begin(&export_writer, export_frame[export_fill], export_mode, export_bits,
+			               ADC_EXPORT_FRAME_SAMPLES);
+			export_first = export_index + taken;
+			export_open  = true;
+		}
+
+		taken += ADC_Pack_Put(&export_writer, &pData[taken], Length - taken);
+
+		if (ADC_Pack_IsFull(&export_writer)) {
+			ADC_Export_Close();
+		}
+	}
+
+	export_stats.DroppedSamples += Length - taken;
+	export_index += Length;
+
+	return taken;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_Flush()
+ * Purpose  : Send the partly filled frame now
+ * Details  : E.g. before stopping the stream
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Export_Flush(void) {
+
+	if (export_open && (export_writer.Count != 0U)) {
+		ADC_Export_Close();
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_GetStats()
+ * Purpose  : Copy the export counters
+ * Details  : BitsPerSampleQ8 = link cost of all frames so far
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Export_GetStats(ADC_ExportStats_t *pStats) {
+
+	*pStats = export_stats;
+	pStats->Pending = export_queued;
+	pStats->BitsPerSampleQ8 = (export_stats.Samples != 0U) ?
+	                          (uint32_t)(((uint64_t)export_stats.Bytes << 11) / export_stats.Samples) : 0U;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT HANDLING                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Export_IRQHandler()
+ * Purpose  : Frame sent (TC) or failed (TE): start the next one
+ * Details  : Registered by ADC_Export_Init(). A frame
+ *            lost to TE is counted, its sequence gap shows it.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Export_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx) {
+	uint32_t pending = Flags & (DMA_FLAG_TC | DMA_FLAG_TE);
+
+	(void)pCtx;
+	if (pending == 0U) {
+		return;
+	}
+
+	DMA1_ClearFlags(Channel, DMA_FLAG_ALL);                       //TC/HT/TE of the channel in one write
+
+	if (pending & DMA_FLAG_TE) {
+		export_stats.DmaErrors++;
+	}
+
+	export_busy = false;
+	export_send = (export_send + 1U) % ADC_EXPORT_FRAMES;
+	export_queued--;
+	ADC_Export_Send();
+}
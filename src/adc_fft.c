@@ -0,0 +1,523 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_fft.c                            ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: March 3, 2026                        ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Spectrum - Q15 Real FFT, Window and Band Energies     ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Integer-only spectral analysis for the Cortex-M0+: a frame of N samples becomes a peak and a few band    *
+ * levels, so only those leave the device instead of the raw stream.                                        *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Real input packed as N/2 complex points in the frame itself (even samples real, odd imaginary):      *
+ *     radix-2 DIT on N/2 points plus one split pass, half the work and no second buffer.                   *
+ *   - Butterflies use four 16x16 -> 32 MULS: single-cycle on the M0+, so no 3-multiply tricks, and the     *
+ *     twiddle pair is loaded once per group. The W = 1 butterflies of every stage skip the multiplies.     *
+ *   - Block floating point: each pass shifts by 0..2 bits only as far as the data needs (OR of the         *
+ *     magnitudes from the pass before), so small signals keep their resolution. The exponent is applied    *
+ *     once to the results.                                                                                 *
+ *   - Twiddles: a quarter-wave Q15 sine table folded by the compiler from a polynomial in constant         *
+ *     expressions, so it sits in flash with no start-up code and no libm. The Hann window reuses it.       *
+ *   - Mean removed before the window, peak and band levels from squared magnitudes (one square root per    *
+ *     band, none per bin).                                                                                 *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Samples are held as Q14 ((code << 15) >> bits) - 16384, so the mean-free frame fits int16.           *
+ *   - Every pass keeps |re|, |im| < 19776 (2.414 * 2^13): headroom for the next butterfly and for the      *
+ *     32-bit products of the split pass.                                                                   *
+ *   - Cost: (N/4) * log2(N/2) butterflies + N/4 split steps + N window multiplies per frame, all of it in  *
+ *     the call to ADC_Fft_Update() that completes the frame.                                               *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_fft.h"
+#include "adc_stats.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(ADC_FFT_MAX_LOG2 <= ADC_FFT_TABLE_LOG2, "Twiddle table too coarse for ADC_FFT_MAX_LOG2");
+_Static_assert(ADC_FFT_MAX_LOG2 >= ADC_FFT_MIN_LOG2, "ADC_FFT_MAX_LOG2 below the smallest frame");
+_Static_assert(ADC_FFT_TABLE_LOG2 == 9U, "fft_sin[] is expanded for 129 entries");
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           TWIDDLE TABLE                                                  */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#define FFT_QUARTER                          (1UL << (ADC_FFT_TABLE_LOG2 - 2U))
+#define FFT_HALF                             (1UL << (ADC_FFT_TABLE_LOG2 - 1U))
+
+/* sin(pi/2 * x) for x in [0, 1]: odd Taylor series to x^15, error < 1e-11 (far below 1 LSB of Q15) */
+#define FFT_SIN(x)                           ((x) * (1.5707963267948966 + (x) * (x) * (-0.6459640975062462 +   \
+                                             (x) * (x) * (0.07969262624616703 + (x) * (x) * (-0.004681754135318687 + \
+                                             (x) * (x) * (0.00016044118478735975 + (x) * (x) * (-3.598843235212084e-06 + \
+                                             (x) * (x) * (5.692172921967924e-08 + (x) * (x) * -6.688035109811464e-10))))))))
+
+#define FFT_TW(k)                            (int16_t)(32767.0 * FFT_SIN((double)(k) / (double)FFT_QUARTER) + 0.5),
+#define FFT_TW4(k)                           FFT_TW(k) FFT_TW((k) + 1) FFT_TW((k) + 2) FFT_TW((k) + 3)
+#define FFT_TW16(k)                          FFT_TW4(k) FFT_TW4((k) + 4) FFT_TW4((k) + 8) FFT_TW4((k) + 12)
+#define FFT_TW64(k)                          FFT_TW16(k) FFT_TW16((k) + 16) FFT_TW16((k) + 32) FFT_TW16((k) + 48)
+
+/* sin(2 * pi * k / 2^ADC_FFT_TABLE_LOG2) in Q15 for k = 0..FFT_QUARTER, evaluated at compile time */
+static const int16_t fft_sin[FFT_QUARTER + 1U] = {
+	FFT_TW64(0) FFT_TW64(64) FFT_TW(128)
+};
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Twiddle()
+ * Purpose  : cos and sin of 2 * pi * k / 2^ADC_FFT_TABLE_LOG2
+ * Details  : k in 0..FFT_HALF (upper half circle), Q15
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline void ADC_Fft_Twiddle(uint32_t k, int32_t *pCos, int32_t *pSin) {
+
+	if (k <= FFT_QUARTER) {
+		*pSin = fft_sin[k];
+		*pCos = fft_sin[FFT_QUARTER - k];
+	} else {
+		*pSin = fft_sin[FFT_HALF - k];
+		*pCos = -fft_sin[k - FFT_QUARTER];
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           HELPERS                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Abs()
+ * Purpose  : |v| without a branch
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline uint32_t ADC_Fft_Abs(int32_t v) {
+	int32_t sign = v >> 31;
+
+	return (uint32_t)((v ^ sign) - sign);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Headroom()
+ * Purpose  : Right shift for the next pass
+ * Details  : Peak is the OR of all |re|, |im|. A pass grows a
+ *            component by up to 1 + sqrt(2): 0 below 2^13, 1
+ *            below 2^14, else 2 keeps it under 19776.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline uint32_t ADC_Fft_Headroom(uint32_t Peak) {
+
+	if (Peak >= 0x4000U) {
+		return 2U;
+	}
+	return (Peak >= 0x2000U) ? 1U : 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Scale()
+ * Purpose  : v * 2^Exp, rounded, saturated to uint32
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t ADC_Fft_Scale(uint64_t v, int32_t Exp) {
+
+	if (Exp < 0) {
+		if (Exp <= -64) {
+			return 0U;
+		}
+		v = (v + (1ULL << (-Exp - 1))) >> -Exp;
+	} else if (Exp < 32) {
+		v = (v <= (UINT32_MAX >> Exp)) ? (v << Exp) : UINT32_MAX;
+	} else {
+		v = (v != 0U) ? UINT32_MAX : 0U;
+	}
+	return (v > UINT32_MAX) ? UINT32_MAX : (uint32_t)v;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TRANSFORM                                                      */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_BitReverse()
+ * Purpose  : Reorder M complex points for the DIT passes
+ * Details  : Reversed counter kept incrementally, no table
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Fft_BitReverse(int16_t *pData, uint32_t M) {
+	uint32_t j = 0;
+
+	for (uint32_t i = 0; i < M; i++) {
+		uint32_t bit = M >> 1;
+
+		if (i < j) {
+			int16_t re = pData[2U * i];
+			int16_t im = pData[2U * i + 1U];
+
+			pData[2U * i]      = pData[2U * j];
+			pData[2U * i + 1U] = pData[2U * j + 1U];
+			pData[2U * j]      = re;
+			pData[2U * j + 1U] = im;
+		}
+		while (j & bit) {
+			j  ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Butterfly()
+ * Purpose  : a, b = (a + t) >> Shift, (a - t) >> Shift
+ * Details  : t = W * b already formed; ORs the outputs into
+ *            *pPeak for the next pass
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline void ADC_Fft_Butterfly(int16_t *pA, int16_t *pB, int32_t Tr, int32_t Ti, uint32_t Shift,
+                                     uint32_t *pPeak) {
+	const int32_t round = (int32_t)(1UL << Shift) >> 1;
+	int32_t ar = pA[0];
+	int32_t ai = pA[1];
+	int32_t v0 = (ar + Tr + round) >> Shift;
+	int32_t v1 = (ai + Ti + round) >> Shift;
+	int32_t v2 = (ar - Tr + round) >> Shift;
+	int32_t v3 = (ai - Ti + round) >> Shift;
+
+	pA[0] = (int16_t)v0;
+	pA[1] = (int16_t)v1;
+	pB[0] = (int16_t)v2;
+	pB[1] = (int16_t)v3;
+	*pPeak |= ADC_Fft_Abs(v0) | ADC_Fft_Abs(v1) | ADC_Fft_Abs(v2) | ADC_Fft_Abs(v3);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Passes()
+ * Purpose  : Radix-2 DIT on 2^Log2M bit-reversed points
+ * Details  : Returns the summed pass shifts; *pPeak in: OR of
+ *            the input magnitudes, out: of the result
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int32_t ADC_Fft_Passes(int16_t *pData, uint32_t Log2M, uint32_t *pPeak) {
+	const uint32_t m     = 1UL << Log2M;
+	uint32_t       peak  = *pPeak;
+	uint32_t       tw    = ADC_FFT_TABLE_LOG2 - 1U;               //W_2h^j = table index j << tw
+	int32_t        total = 0;
+
+	for (uint32_t half = 1U; half < m; half <<= 1, tw--) {
+		const uint32_t shift = ADC_Fft_Headroom(peak);
+
+		peak   = 0;
+		total += (int32_t)shift;
+
+		for (uint32_t i = 0; i < m; i += 2U * half) {             //W = 1: no multiplies
+			int16_t *pB = &pData[2U * (i + half)];
+
+			ADC_Fft_Butterfly(&pData[2U * i], pB, pB[0], pB[1], shift, &peak);
+		}
+		for (uint32_t j = 1U; j < half; j++) {
+			int32_t c, s;
+
+			ADC_Fft_Twiddle(j << tw, &c, &s);
+			for (uint32_t i = j; i < m; i += 2U * half) {
+				int16_t *pB = &pData[2U * (i + half)];
+				int32_t  br = pB[0];
+				int32_t  bi = pB[1];
+				int32_t  tr = (br * c + bi * s + 0x4000L) >> 15;  //W * b, W = c - j s
+				int32_t  ti = (bi * c - br * s + 0x4000L) >> 15;
+
+				ADC_Fft_Butterfly(&pData[2U * i], pB, tr, ti, shift, &peak);
+			}
+		}
+	}
+
+	*pPeak = peak;
+	return total;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Split()
+ * Purpose  : N/2-point complex spectrum Z -> N-point real X
+ * Details  : X[k] = Fe + W^k Fo, Fe = (Z[k] + Z*[M-k]) / 2,
+ *            Fo = -j (Z[k] - Z*[M-k]) / 2; k and M - k share
+ *            one pass. X[0] and X[N/2] are real and packed
+ *            into the first pair.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int32_t ADC_Fft_Split(int16_t *pData, uint32_t Log2N, uint32_t Peak) {
+	const uint32_t m     = 1UL << (Log2N - 1U);
+	const uint32_t tw    = ADC_FFT_TABLE_LOG2 - Log2N;            //W_N^k = table index k << tw
+	const uint32_t shift = ADC_Fft_Headroom(Peak);
+	const int32_t  round = (int32_t)(1UL << shift);               //Half LSB of >> (shift + 1)
+	int32_t        zr    = pData[0];
+	int32_t        zi    = pData[1];
+
+	pData[0] = (int16_t)((zr + zi + (round >> 1)) >> shift);      //DC
+	pData[1] = (int16_t)((zr - zi + (round >> 1)) >> shift);      //Nyquist
+
+	for (uint32_t k = 1U; k <= m / 2U; k++) {
+		int16_t *pA = &pData[2U * k];
+		int16_t *pB = &pData[2U * (m - k)];
+		int32_t  ar = pA[0], ai = pA[1];
+		int32_t  br = pB[0], bi = pB[1];
+		int32_t  er = ar + br, ei = ai - bi;                      //2 Fe
+		int32_t  fr = ai + bi, fi = br - ar;                      //2 Fo, |.| < 2^15.5: products fit int32
+		int32_t  c, s, tr, ti;
+
+		ADC_Fft_Twiddle(k << tw, &c, &s);
+		tr = (fr * c + fi * s + 0x4000L) >> 15;
+		ti = (fi * c - fr * s + 0x4000L) >> 15;
+
+		pA[0] = (int16_t)((er + tr + round) >> (shift + 1U));
+		pA[1] = (int16_t)((ei + ti + round) >> (shift + 1U));
+		pB[0] = (int16_t)((er - tr + round) >> (shift + 1U));     //W^(M-k) = -W*^k: same products
+		pB[1] = (int16_t)((ti - ei + round) >> (shift + 1U));
+	}
+
+	return (int32_t)shift;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Transform()
+ * Purpose  : In-place real FFT of 2^Log2Points int16 samples
+ * Details  : Out: pData[0] = X[0], pData[1] = X[N/2] (both
+ *            real), pData[2k], pData[2k+1] = Re, Im X[k] for
+ *            k = 1..N/2-1. X = DFT / 2^Return; -1 if the size
+ *            is out of range.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+int32_t ADC_Fft_Transform(int16_t *pData, uint32_t Log2Points) {
+	const uint32_t n    = 1UL << Log2Points;
+	uint32_t       peak = 0;
+	int32_t        exponent;
+
+	if ((Log2Points < ADC_FFT_MIN_LOG2) || (Log2Points > ADC_FFT_TABLE_LOG2)) {
+		return -1;
+	}
+
+	for (uint32_t i = 0; i < n; i++) {
+		peak |= ADC_Fft_Abs(pData[i]);
+	}
+	ADC_Fft_BitReverse(pData, n / 2U);
+	exponent  = ADC_Fft_Passes(pData, Log2Points - 1U, &peak);
+	exponent += ADC_Fft_Split(pData, Log2Points, peak);
+
+	return exponent;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           SPECTRUM ENGINE                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Power()
+ * Purpose  : |X[k]|^2 of the spectrum in Frame, k = 1..N/2
+ * Details  : The real Nyquist bin is quartered so that a tone
+ *            there reads its amplitude like any other bin
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline uint32_t ADC_Fft_Power(const ADC_Fft_t *pFft, uint32_t k) {
+	const int16_t *x = pFft->Frame;
+	int32_t        re, im;
+
+	if (k == pFft->Points / 2U) {
+		re = x[1];
+		return ((uint32_t)(re * re)) >> 2;
+	}
+	re = x[2U * k];
+	im = x[2U * k + 1U];
+	return (uint32_t)(re * re) + (uint32_t)(im * im);             //< 2 * 19776^2
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Shift()
+ * Purpose  : log2 of Q4 codes per |X[k]| unit (amplitude)
+ * Details  : Amplitude = 2 |DFT| / (N * window gain), Hann
+ *            gain 1/2; Q14 -> Q4 codes is 2^(bits - 11)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int32_t ADC_Fft_Shift(const ADC_Fft_t *pFft) {
+	const ADC_FftConfig_t *pCfg = &pFft->Config;
+
+	return pFft->Exponent + 1 + ((pCfg->Window == ADC_FFT_WINDOW_HANN) ? 1 : 0) - (int32_t)pCfg->Log2Points +
+	       (int32_t)pCfg->InputBits - 11;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Frame()
+ * Purpose  : Close a full frame: window, transform, reduce
+ * Details  : Once per frame. Band RMS^2 = sum |A|^2 / 2 / ENBW,
+ *            one square root per band and one for the peak.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Fft_Frame(ADC_Fft_t *pFft) {
+	const ADC_FftConfig_t *pCfg  = &pFft->Config;
+	const uint32_t         log2n = pCfg->Log2Points;
+	const uint32_t         n     = pFft->Points;
+	const int32_t          mean  = (pFft->Sum + (int32_t)(n / 2U)) >> log2n;
+	ADC_FftResult_t       *pRes  = &pFft->Result;
+	int16_t               *x     = pFft->Frame;
+	uint32_t               best  = 0, best_bin = 1U;
+	int32_t                shift;
+
+	if (pCfg->Window == ADC_FFT_WINDOW_HANN) {
+		const uint32_t tw = ADC_FFT_TABLE_LOG2 - log2n;
+
+		for (uint32_t i = 0; i < n; i++) {                        //w = (1 - cos(2 pi i / N)) / 2, symmetric
+			int32_t c, s;
+
+			ADC_Fft_Twiddle(((i <= n / 2U) ? i : n - i) << tw, &c, &s);
+			x[i] = (int16_t)(((x[i] - mean) * ((32768L - c) >> 1) + 0x4000L) >> 15);
+		}
+	} else {
+		for (uint32_t i = 0; i < n; i++) {
+			x[i] = (int16_t)(x[i] - mean);
+		}
+	}
+
+	pFft->Exponent = ADC_Fft_Transform(x, log2n);
+	shift          = ADC_Fft_Shift(pFft);
+
+	for (uint32_t k = 1U; k <= n / 2U; k++) {
+		uint32_t p = ADC_Fft_Power(pFft, k);
+
+		if (p > best) {
+			best     = p;
+			best_bin = k;
+		}
+	}
+
+	for (uint32_t b = 0; b < pCfg->NumBands; b++) {
+		uint64_t sum = 0;
+
+		for (uint32_t k = pCfg->Bands[b].Low; k <= pCfg->Bands[b].High; k++) {
+			sum += ADC_Fft_Power(pFft, k);
+		}
+		sum <<= 15;                                               //|A|^2 / 2, root in Q8
+		if (pCfg->Window == ADC_FFT_WINDOW_HANN) {
+			sum = (sum * 2U) / 3U;                                //ENBW 1.5 bins
+		}
+		pRes->BandRmsQ4[b] = ADC_Fft_Scale(ADC_Stats_Sqrt64(sum), shift - 8);
+	}
+
+	pRes->MeanQ4  = ADC_Fft_Scale((uint64_t)(pFft->Sum + 16384L * (int32_t)n),
+	                              (int32_t)pCfg->InputBits - 11 - (int32_t)log2n);
+	pRes->PeakBin = best_bin;
+	pRes->PeakQ4  = ADC_Fft_Scale(ADC_Stats_Sqrt64((uint64_t)best << 16), shift - 8);
+	pRes->Sequence++;
+
+	if (pCfg->Callback != NULL) {
+		pCfg->Callback(pRes);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Init()
+ * Purpose  : Check and take the configuration, clear the state
+ * Details  : Bands need 1 <= Low <= High <= N/2
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Fft_Init(ADC_Fft_t *pFft, const ADC_FftConfig_t *pConfig) {
+
+	if ((pFft == NULL) || (pConfig == NULL) || (pConfig->Log2Points < ADC_FFT_MIN_LOG2) ||
+	    (pConfig->Log2Points > ADC_FFT_MAX_LOG2) || (pConfig->Window > ADC_FFT_WINDOW_HANN) ||
+	    (pConfig->InputBits < 6U) || (pConfig->InputBits > 16U) || (pConfig->Channels == 0U) ||
+	    (pConfig->Position >= pConfig->Channels) || (pConfig->NumBands > ADC_FFT_MAX_BANDS)) {
+		return false;
+	}
+	for (uint32_t b = 0; b < pConfig->NumBands; b++) {
+		if ((pConfig->Bands[b].Low == 0U) || (pConfig->Bands[b].Low > pConfig->Bands[b].High) ||
+		    (pConfig->Bands[b].High > (1UL << (pConfig->Log2Points - 1U)))) {
+			return false;
+		}
+	}
+
+	memset(pFft, 0, sizeof(*pFft));
+	pFft->Config = *pConfig;
+	pFft->Points = 1UL << pConfig->Log2Points;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Update()
+ * Purpose  : Feed one block (interleaved when Channels > 1)
+ * Details  : Takes every Channels-th sample at Position, the
+ *            scan phase follows on from the last block. Runs
+ *            the transform when a frame fills.
+ * Runtime  : ~X.Xxx per sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Fft_Update(ADC_Fft_t *pFft, const uint16_t *pData, uint32_t Length) {
+	const uint32_t channels = pFft->Config.Channels;
+	const uint32_t bits     = pFft->Config.InputBits;
+	uint32_t       filled   = pFft->Filled;                       //Locals: stay in registers
+	int32_t        sum      = pFft->Sum;
+
+	for (uint32_t i = (pFft->Config.Position + channels - pFft->Phase) % channels; i < Length; i += channels) {
+		int32_t v = (int32_t)(((uint32_t)pData[i] << 15) >> bits) - 16384L;   //Q14, centred
+
+		pFft->Frame[filled++] = (int16_t)v;
+		sum += v;
+
+		if (filled == pFft->Points) {
+			pFft->Filled = 0;                                     //Frame now holds the spectrum
+			pFft->Sum    = sum;
+			ADC_Fft_Frame(pFft);
+			filled = 0;
+			sum    = 0;
+		}
+	}
+
+	pFft->Filled = filled;
+	pFft->Sum    = sum;
+	pFft->Phase  = (pFft->Phase + Length) % channels;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_Get()
+ * Purpose  : Copy the results of the last completed frame
+ * Details  : False until the first frame has closed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Fft_Get(const ADC_Fft_t *pFft, ADC_FftResult_t *pResult) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	*pResult = pFft->Result;
+	__set_PRIMASK(primask);
+
+	return pResult->Sequence != 0U;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Fft_GetMagnitude()
+ * Purpose  : Amplitude per bin of the last frame, Q4 codes
+ * Details  : pOut[0] = MeanQ4, pOut[1..N/2]: ADC_FFT_BINS()
+ *            entries. Only from the frame callback (or before
+ *            the next ADC_Fft_Update()); returns 0 otherwise.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Fft_GetMagnitude(const ADC_Fft_t *pFft, uint32_t *pOut) {
+	const int32_t shift = ADC_Fft_Shift(pFft) - 8;
+
+	if ((pFft->Result.Sequence == 0U) || (pFft->Filled != 0U)) {
+		return 0U;
+	}
+
+	pOut[0] = pFft->Result.MeanQ4;
+	for (uint32_t k = 1U; k <= pFft->Points / 2U; k++) {
+		pOut[k] = ADC_Fft_Scale(ADC_Stats_Sqrt64((uint64_t)ADC_Fft_Power(pFft, k) << 16), shift);
+	}
+
+	return pFft->Points / 2U + 1U;
+}
@@ -0,0 +1,259 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_instr.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 6, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Instrumentation - ISR Timing and Acquisition Health   ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Hot-path instrumentation for the Cortex-M0+, which has no DWT cycle counter.                             *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Duration: SysTick->VAL at entry and exit, one reload is unwrapped (HAL runs SysTick at HCLK with a   *
+ *     1 ms period, so anything under 1 ms is exact to the cycle).                                          *
+ *   - Latency: the DMA keeps counting while the ISR is pending, so (CNDTR position - HT/TC boundary) at   *
+ *     entry is how many samples late the ISR started. No timer needed, resolution is one sample period.    *
+ *   - Samples per second from the HT/TC flags actually serviced, over ADC_INSTR_SPS_WINDOW_MS windows.     *
+ *   - ADC OVR counted on rising edges (sampled at DMA ISR entry and exit, the flag is left for the         *
+ *     queue to clear), TEIF of the ADC DMA channel counted and cleared here.                               *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Cost per instrumented DMA ISR: five peripheral reads, one shift-compare log2 and a handful of        *
+ *     increments. No division except once per window, no interrupt masking on the hot path.                *
+ *   - DMA1_InitAdc() does not enable TEIE, and a transfer error stops the channel, so TEIF is also polled  *
+ *     by ADC_Instr_GetSnapshot().                                                                          *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_instr.h"
+#include "dma.h"
+#include "main.h"
+#include "stm32g030xx.h"
+#include <string.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INSTRUMENTATION STATE                                          */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static ADC_InstrSnapshot_t  instr;                                //Written in interrupt context only
+static uint32_t             instr_block;                          //Samples per HT/TC event
+static uint32_t             instr_window_start;                   //HAL tick of the current window
+static uint32_t             instr_window_samples;
+static bool                 instr_ovr_seen;                       //OVR was set at the last sample
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Log2()
+ * Purpose  : Histogram bin for a cycle count
+ * Details  : floor(log2(x)), 0 for 0. The M0+ has no CLZ, five
+ *            compare/shift steps instead of a 32-step loop
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t ADC_Instr_Log2(uint32_t x) {
+	uint32_t bin = 0;
+
+	if (x >= (1UL << 16)) { x >>= 16; bin += 16U; }
+	if (x >= (1UL << 8))  { x >>= 8;  bin += 8U;  }
+	if (x >= (1UL << 4))  { x >>= 4;  bin += 4U;  }
+	if (x >= (1UL << 2))  { x >>= 2;  bin += 2U;  }
+	if (x >= (1UL << 1))  {           bin += 1U;  }
+
+	return (bin < ADC_INSTR_HIST_BINS) ? bin : (ADC_INSTR_HIST_BINS - 1U);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Elapsed()
+ * Purpose  : Core cycles between two SysTick->VAL readings
+ * Details  : SysTick counts down and reloads from LOAD. Exact
+ *            for intervals shorter than one tick only. Shared
+ *            with adc_convert.c and adc_lowpower.c.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Instr_Elapsed(uint32_t Start, uint32_t End) {
+
+	if (Start >= End) {
+		return Start - End;
+	}
+	return Start + (SysTick->LOAD + 1U) - End;                    //One reload in between
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_SampleOverrun()
+ * Purpose  : Count ADC_ISR_OVR rising edges
+ * Details  : Does not clear OVR, ADC_Queue_Push() owns that
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Instr_SampleOverrun(void) {
+	bool ovr = (ADC1->ISR & ADC_ISR_OVR) != 0U;
+
+	if (ovr && !instr_ovr_seen) {
+		instr.AdcOverruns++;
+	}
+	instr_ovr_seen = ovr;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_DmaEntry()
+ * Purpose  : Latency, sample count and TEIF at DMA ISR entry
+ * Details  : CNDTR runs from 2 * block down to 1, the position
+ *            past the last HT/TC is (2 * block - CNDTR) mod block
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Instr_DmaEntry(void) {
+	uint32_t channel = DMA1_GetAdcChannel();
+	uint32_t cndtr = (channel != DMA1_CHANNEL_ANY) ? DMA1_GetChannel(channel)->CNDTR : 0U;
+	uint32_t flags = (channel != DMA1_CHANNEL_ANY) ? DMA1_GetFlags(channel) : 0U;
+	uint32_t blocks = ((flags & DMA_FLAG_HT) ? 1U : 0U) + ((flags & DMA_FLAG_TC) ? 1U : 0U);
+	ADC_InstrIsrStats_t *pIsr = &instr.Isr[ADC_INSTR_ISR_DMA];
+
+	if (flags & DMA_FLAG_TE) {
+		DMA1_ClearFlags(channel, DMA_FLAG_TE);
+		instr.DmaErrors++;
+	}
+
+	if ((blocks != 0U) && (instr_block != 0U)) {
+		uint32_t late = (2U * instr_block) - cndtr;
+
+		if (late >= instr_block) {
+			late -= instr_block;                                  //Past HT: count from the midpoint
+		}
+		pIsr->Latency[(late < ADC_INSTR_HIST_BINS) ? late : (ADC_INSTR_HIST_BINS - 1U)]++;
+		if (late > pIsr->MaxLatency) {
+			pIsr->MaxLatency = late;
+		}
+
+		instr.Samples        += blocks * instr_block;
+		instr_window_samples += blocks * instr_block;
+	}
+
+	uint32_t now = HAL_GetTick();
+	uint32_t span = now - instr_window_start;
+
+	if (span >= ADC_INSTR_SPS_WINDOW_MS) {
+		instr.SamplesPerSecond = (instr_window_samples * 1000U) / span;
+		instr_window_start     = now;
+		instr_window_samples   = 0;
+	}
+
+	ADC_Instr_SampleOverrun();
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONTROL                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Start()
+ * Purpose  : Clear all counters and set the DMA block length
+ * Details  : BlockLength = half the ADC_Stream_Start() length
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Instr_Start(uint32_t BlockLength) {
+
+	ADC_Instr_Reset();
+	instr_block = BlockLength;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Reset()
+ * Purpose  : Clear all counters, keep the block length
+ * Details  : Safe while running, interrupts masked briefly
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Instr_Reset(void) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	memset(&instr, 0, sizeof(instr));
+	instr_window_samples = 0;
+	instr_ovr_seen       = false;
+	__set_PRIMASK(primask);
+
+	instr_window_start = HAL_GetTick();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_GetSnapshot()
+ * Purpose  : Consistent copy of all counters for export
+ * Details  : Interrupts masked for the copy (~100 words), also
+ *            polls TEIF which raises no interrupt by default
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Instr_GetSnapshot(ADC_InstrSnapshot_t *pSnapshot) {
+	uint32_t primask = __get_PRIMASK();
+	uint32_t channel = DMA1_GetAdcChannel();
+
+	__disable_irq();
+	if ((channel != DMA1_CHANNEL_ANY) && (DMA1_GetFlags(channel) & DMA_FLAG_TE)) {
+		DMA1_ClearFlags(channel, DMA_FLAG_TE);
+		instr.DmaErrors++;
+	}
+	*pSnapshot = instr;
+	__set_PRIMASK(primask);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           HOOKS (INTERRUPT CONTEXT)                                      */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Enter()
+ * Purpose  : First statement of an instrumented ISR
+ * Details  : Returns the SysTick start value for the exit hook
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Instr_Enter(ADC_InstrIsr_t Isr) {
+	uint32_t start = SysTick->VAL;
+
+	if (Isr == ADC_INSTR_ISR_DMA) {
+		ADC_Instr_DmaEntry();
+	}
+
+	return start;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_Exit()
+ * Purpose  : Last statement of an instrumented ISR
+ * Details  : Duration includes the entry hook itself
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Instr_Exit(ADC_InstrIsr_t Isr, uint32_t Start) {
+	ADC_InstrIsrStats_t *pIsr = &instr.Isr[Isr];
+	uint32_t cycles;
+
+	if (Isr == ADC_INSTR_ISR_DMA) {
+		ADC_Instr_SampleOverrun();                                //After the queue had its chance to clear OVR
+	}
+
+	cycles = ADC_Instr_Elapsed(Start, SysTick->VAL);
+
+	pIsr->Count++;
+	pIsr->Duration[ADC_Instr_Log2(cycles)]++;
+	if (cycles > pIsr->MaxCycles) {
+		pIsr->MaxCycles = cycles;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Instr_ReadSpins()
+ * Purpose  : Record one ADC1_Read() and its EOC poll count
+ * Details  : Called through ADC_INSTR_READ_SPINS()
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Instr_ReadSpins(uint32_t Spins) {
+
+	instr.Reads++;
+	instr.ReadSpins += Spins;
+	if (Spins > instr.MaxReadSpins) {
+		instr.MaxReadSpins = Spins;
+	}
+}
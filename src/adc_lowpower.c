@@ -0,0 +1,208 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_lowpower.c                       ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 13, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Low-Power Profile - AUTOFF/WAIT, Sleep, Stop          ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Battery profile for the streaming pipeline.                                                              *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Conversions are paced by TIM3 TRGO instead of CONT, so AUTOFF can power the ADC down between         *
+ *     scans. WAIT holds each conversion until DMA has read DR, so OVR is impossible.                       *
+ *   - Between DMA blocks the core sleeps (WFI, SLEEPDEEP = 0). TIM3, ADC and DMA keep running, so the      *
+ *     stream keeps the always-on guarantees: >= ADC_PLAN_TARGET_SPS, no gaps, same HT/TC blocks.           *
+ *   - Stop 1 only when acquisition is idle: on the G0 the DMA and TIM3 clocks halt in Stop, so entering    *
+ *     it mid-stream would drop samples. Wake-up runs on HSISYS, the Restore callback (SystemClock_Config)  *
+ *     re-applies the clock tree before anything else runs.                                                 *
+ *   - Metrics: wake-ups per second and awake core cycles per block, from SysTick->VAL around each WFI.     *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - The idle check runs with PRIMASK set: a block published between the check and WFI still wakes the    *
+ *     core (pending IRQ), its handler runs right after __enable_irq().                                     *
+ *   - A sleep never spans more than one SysTick period, the tick interrupt ends it, so one reload is       *
+ *     unwrapped at most.                                                                                   *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_lowpower.h"
+#include "adc_instr.h"
+#include "dma.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           PROFILE STATE                                                  */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static ADC_ClockRestore_t   lp_restore;
+static ADC_LowPowerStats_t  lp_stats;                             //Main loop only, no masking needed
+static uint32_t             lp_window_start;                      //HAL tick
+static uint32_t             lp_window_sleep;                      //Core cycles spent in WFI
+static uint32_t             lp_window_wakeups;
+static uint32_t             lp_window_blocks;
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_Window()
+ * Purpose  : Close the metrics window once it is complete
+ * Details  : Window length in cycles = ms * (LOAD + 1)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_LowPower_Window(void) {
+	uint32_t now  = HAL_GetTick();
+	uint32_t span = now - lp_window_start;
+	uint32_t total, awake;
+
+	if (span < ADC_LP_WINDOW_MS) {
+		return;
+	}
+
+	total = span * (SysTick->LOAD + 1U);
+	awake = (total > lp_window_sleep) ? (total - lp_window_sleep) : 0U;
+
+	lp_stats.WakeupsPerSecond    = (lp_window_wakeups * 1000U) / span;
+	lp_stats.BlocksPerSecond     = (lp_window_blocks * 1000U) / span;
+	lp_stats.AwakeCyclesPerBlock = (lp_window_blocks != 0U) ? (awake / lp_window_blocks) : awake;
+	lp_stats.AwakePermille       = awake / (total / 1000U);
+
+	lp_window_start   = now;
+	lp_window_sleep   = 0;
+	lp_window_wakeups = 0;
+	lp_window_blocks  = 0;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           PROFILE CONTROL                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_Start()
+ * Purpose  : Switch to triggered, auto-off acquisition
+ * Details  : RateHz = scans per second. False if a scan plus
+ *            tSTAB does not fit one period (triggers would be
+ *            lost). Restore runs after each Stop.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_LowPower_Start(uint32_t RateHz, ADC_ClockRestore_t Restore, TIM_Timebase_t *pTimebase) {
+	uint32_t scan_ns = ADC_Scan_GetLength() * (1000000000UL / ADC_PLAN_SPS) + ADC_LP_TSTAB_NS;
+
+	if ((RateHz == 0U) || (RateHz > 1000000000UL / scan_ns)) {
+		return false;                                             //A trigger during a scan is ignored
+	}
+	if (!ADC1_ConfigTimerTrigger(RateHz, pTimebase)) {
+		return false;
+	}
+	ADC1_ConfigAutoOff(true);
+
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);                     //PWR_CR1 (LPMS) access
+	CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);                   //WFI = Sleep, peripherals keep running
+
+	lp_restore = Restore;
+	memset(&lp_stats, 0, sizeof(lp_stats));
+	lp_window_sleep   = 0;
+	lp_window_wakeups = 0;
+	lp_window_blocks  = 0;
+	lp_window_start   = HAL_GetTick();
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_End()
+ * Purpose  : Back to the always-on CONT profile
+ * Details  : Stops conversions, restart the stream afterwards
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_LowPower_End(void) {
+
+	ADC1_ConfigAutoOff(false);
+	ADC1_ConfigFreeRun();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_Idle()
+ * Purpose  : Sleep until the next interrupt if nothing is due
+ * Details  : pPending (e.g. ADC_Queue_Depth) is checked with
+ *            interrupts masked; NULL sleeps unconditionally
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_LowPower_Idle(uint32_t (*pPending)(void)) {
+
+	__disable_irq();
+	if ((pPending == NULL) || (pPending() == 0U)) {
+		uint32_t start = SysTick->VAL;
+
+		__WFI();                                                  //Wakes on a pending IRQ despite PRIMASK
+		lp_window_sleep += ADC_Instr_Elapsed(start, SysTick->VAL);
+		lp_window_wakeups++;
+		lp_stats.Wakeups++;
+	}
+	__enable_irq();                                               //The waking handler runs here
+
+	ADC_LowPower_Window();
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_BlockDone()
+ * Purpose  : Count one processed block for the metrics
+ * Details  : Call from the main loop per dequeued block
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_LowPower_BlockDone(void) {
+
+	lp_window_blocks++;
+	lp_stats.Blocks++;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_EnterStop()
+ * Purpose  : Stop 1 until an EXTI/RTC wake-up
+ * Details  : Refused (false) while ADSTART or the DMA channel is
+ *            active. Clocks are restored before returning.
+ *            Enables the PWR clock itself (LPMS write).
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_LowPower_EnterStop(void) {
+	uint32_t channel = DMA1_GetAdcChannel();
+
+	if ((ADC1->CR & ADC_CR_ADSTART) ||
+	    ((channel != DMA1_CHANNEL_ANY) && (DMA1_GetChannel(channel)->CCR & DMA_CCR_EN))) {
+		return false;                                             //Stream running: Stop would drop samples
+	}
+
+	TIM3_Stop();
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_PWREN);                     //PWR_CR1 access without ADC_LowPower_Start()
+	MODIFY_REG(PWR->CR1, PWR_CR1_LPMS, PWR_CR1_LPMS_0);           //001: Stop 1
+	SET_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+
+	__WFI();
+
+	CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);                   //Later WFIs are plain Sleep again
+	if (lp_restore != NULL) {
+		lp_restore();                                             //Woke on HSISYS: rebuild the clock tree
+	}
+	lp_stats.StopEntries++;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_LowPower_GetStats()
+ * Purpose  : Copy the energy metrics
+ * Details  : Per-second values update once per window
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_LowPower_GetStats(ADC_LowPowerStats_t *pStats) {
+
+	*pStats = lp_stats;
+}
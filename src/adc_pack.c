@@ -0,0 +1,406 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_pack.c                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Sample Packing - Bit-Packed / Delta-Rice Frames       ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Compact wire format for raw captures. The encoder writes straight into the buffer the USART DMA sends    *
+ * from, the decoder is the same file built on the host.                                                    *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - RAW: Bits per sample with no padding, 12-bit codes take 1.5 bytes instead of a 16-bit word.          *
+ *   - DELTA: first sample raw, then zigzag deltas in Rice(k) codes. k adapts per sample from a running     *
+ *     mean (LOCO-I style, window ADC_PACK_RICE_RESET), so slow signals cost 3..6 bits per sample.          *
+ *   - A prefix of ADC_PACK_RICE_ESCAPE ones escapes to the raw sample: one code is at most ESCAPE + Bits   *
+ *     bits, and a delta frame that could overflow the bit-packed size closes early instead.                *
+ *   - Frames decode on their own (no state carried over), so one corrupt frame costs only its samples.     *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - Bits go out MSB first through a 32-bit accumulator that never holds more than 7 + 17 bits.           *
+ *   - CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) with a 16-entry nibble table: 32 bytes of flash.       *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_pack.h"
+#include <stddef.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CRC                                                            */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static const uint16_t pack_crc_nibble[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_Crc16()
+ * Purpose  : CRC-16/CCITT-FALSE over Length bytes
+ * Details  : Pass 0xFFFF to start, the previous result to chain
+ * Runtime  : ~X.Xxx per byte
+ * ────────────────────────────────────────────────────────────── */
+uint16_t ADC_Pack_Crc16(const uint8_t *pData, uint32_t Length, uint16_t Crc) {
+	uint32_t crc = Crc;
+
+	while (Length--) {
+		uint32_t b = *pData++;
+
+		crc = (crc << 4) ^ pack_crc_nibble[((crc >> 12) ^ (b >> 4)) & 0xFU];
+		crc = (crc << 4) ^ pack_crc_nibble[((crc >> 12) ^ b) & 0xFU];
+		crc &= 0xFFFFU;
+	}
+
+	return (uint16_t)crc;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           HELPERS                                                        */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static void ADC_Pack_Le16(uint8_t *p, uint32_t v) {
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+}
+
+static void ADC_Pack_Le32(uint8_t *p, uint32_t v) {
+	ADC_Pack_Le16(p, v);
+	ADC_Pack_Le16(p + 2, v >> 16);
+}
+
+static uint32_t ADC_Unpack_Le16(const uint8_t *p) {
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_RiceK()
+ * Purpose  : Rice parameter from the running mean
+ * Details  : Smallest k with N * 2^k >= Sum, at most Bits
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline uint32_t ADC_Pack_RiceK(uint32_t Sum, uint32_t N, uint32_t Bits) {
+	uint32_t k = 0;
+
+	while (((N << k) < Sum) && (k < Bits)) {
+		k++;
+	}
+	return k;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_Bits()
+ * Purpose  : Append Count (<= 17) bits, MSB first
+ * Details  : Whole bytes are stored as soon as they are complete
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline void ADC_Pack_Bits(ADC_PackWriter_t *pWriter, uint32_t Value, uint32_t Count) {
+	uint32_t acc  = (pWriter->Acc << Count) | Value;              //Flushed high bits may fall off
+	uint32_t bits = pWriter->AccBits + Count;
+
+	while (bits >= 8U) {
+		bits -= 8U;
+		pWriter->pPayload[pWriter->Pos++] = (uint8_t)(acc >> bits);
+	}
+
+	pWriter->Acc     = acc;
+	pWriter->AccBits = bits;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_Room()
+ * Purpose  : Can the worst-case code of the next sample fit?
+ * Details  : Raw sample: Bits; delta: ESCAPE + Bits
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static inline bool ADC_Pack_Room(const ADC_PackWriter_t *pWriter) {
+	uint32_t used = pWriter->Pos * 8U + pWriter->AccBits;
+	uint32_t need = pWriter->Bits;
+
+	if ((pWriter->Mode == ADC_PACK_DELTA) && (pWriter->Count != 0U)) {
+		need += ADC_PACK_RICE_ESCAPE;
+	}
+	return (pWriter->Count < pWriter->MaxSamples) && (used + need <= pWriter->Capacity * 8U);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           FRAME WRITER                                                   */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_Begin()
+ * Purpose  : Open a frame in pFrame
+ * Details  : Bits 1..16, pFrame holds
+ *            ADC_PACK_FRAME_MAX(MaxSamples, Bits) bytes. The
+ *            payload bound (delta frames close within it too)
+ *            must fit the 16-bit length field
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Pack_Begin(ADC_PackWriter_t *pWriter, uint8_t *pFrame, ADC_PackMode_t Mode, uint32_t Bits,
+                    uint32_t MaxSamples) {
+
+	if ((pWriter == NULL) || (pFrame == NULL) || (Bits == 0U) || (Bits > 16U) || (MaxSamples == 0U) ||
+	    (MaxSamples > UINT16_MAX) || ((Mode != ADC_PACK_RAW) && (Mode != ADC_PACK_DELTA))) {
+		return false;
+	}
+	if (ADC_PACK_PAYLOAD_MAX(MaxSamples, Bits) > ADC_PACK_PAYLOAD_LIMIT) {
+		return false;                                             //ADC_Pack_End() could not encode Pos
+	}
+
+	pWriter->pFrame     = pFrame;
+	pWriter->pPayload   = &pFrame[ADC_PACK_HEADER_BYTES];
+	pWriter->Capacity   = ADC_PACK_PAYLOAD_MAX(MaxSamples, Bits);
+	pWriter->Pos        = 0;
+	pWriter->Acc        = 0;
+	pWriter->AccBits    = 0;
+	pWriter->Count      = 0;
+	pWriter->MaxSamples = MaxSamples;
+	pWriter->Bits       = Bits;
+	pWriter->Mode       = Mode;
+	pWriter->Prev       = 0;
+	pWriter->RiceSum    = 4U;                                     //Start at k = 2
+	pWriter->RiceN      = 1U;
+
+	pFrame[0] = ADC_PACK_SYNC0;
+	pFrame[1] = ADC_PACK_SYNC1;
+	pFrame[2] = (uint8_t)Mode;
+	pFrame[3] = (uint8_t)Bits;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_Put()
+ * Purpose  : Encode samples into the open frame
+ * Details  : Returns the number taken; fewer than Length means
+ *            the frame is full (close it, put the rest into the
+ *            next one). Codes are masked to Bits.
+ * Runtime  : ~X.Xxx per sample
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Pack_Put(ADC_PackWriter_t *pWriter, const uint16_t *pData, uint32_t Length) {
+	uint32_t bits = pWriter->Bits;
+	uint32_t mask = (1UL << bits) - 1U;
+	uint32_t n    = 0;
+
+	if (pWriter->Mode == ADC_PACK_RAW) {
+		while ((n < Length) && ADC_Pack_Room(pWriter)) {
+			ADC_Pack_Bits(pWriter, pData[n++] & mask, bits);
+			pWriter->Count++;
+		}
+		return n;
+	}
+
+	while ((n < Length) && ADC_Pack_Room(pWriter)) {
+		uint32_t x = pData[n++] & mask;
+
+		if (pWriter->Count++ == 0U) {
+			ADC_Pack_Bits(pWriter, x, bits);                      //Frames decode on their own
+		} else {
+			int32_t  d = (int32_t)x - (int32_t)pWriter->Prev;
+			uint32_t u = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);  //Zigzag: 0, -1, 1, -2 ... -> 0, 1, 2, 3
+			uint32_t k = ADC_Pack_RiceK(pWriter->RiceSum, pWriter->RiceN, bits);
+			uint32_t q = u >> k;
+
+			if (q < ADC_PACK_RICE_ESCAPE) {
+				ADC_Pack_Bits(pWriter, (1UL << (q + 1U)) - 2U, q + 1U);  //q ones, then a zero
+				if (k != 0U) {
+					ADC_Pack_Bits(pWriter, u & ((1UL << k) - 1U), k);
+				}
+			} else {
+				ADC_Pack_Bits(pWriter, (1UL << ADC_PACK_RICE_ESCAPE) - 1U, ADC_PACK_RICE_ESCAPE);
+				ADC_Pack_Bits(pWriter, x, bits);
+			}
+
+			pWriter->RiceSum += u;
+			if (++pWriter->RiceN == ADC_PACK_RICE_RESET) {
+				pWriter->RiceSum >>= 1;
+				pWriter->RiceN   >>= 1;
+			}
+		}
+		pWriter->Prev = x;
+	}
+
+	return n;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_IsFull()
+ * Purpose  : No room left for another sample
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Pack_IsFull(const ADC_PackWriter_t *pWriter) {
+	return !ADC_Pack_Room(pWriter);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Pack_End()
+ * Purpose  : Close the frame: header fields, padding, CRC
+ * Details  : Returns the frame length in bytes, ready to send
+ * Runtime  : ~X.Xxx per byte (CRC)
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Pack_End(ADC_PackWriter_t *pWriter, uint16_t Sequence, uint32_t FirstSample) {
+	uint8_t *p = pWriter->pFrame;
+	uint32_t length;
+	uint16_t crc;
+
+	if (pWriter->AccBits != 0U) {
+		pWriter->pPayload[pWriter->Pos++] = (uint8_t)(pWriter->Acc << (8U - pWriter->AccBits));
+		pWriter->AccBits = 0;
+	}
+
+	ADC_Pack_Le16(&p[4], Sequence);
+	ADC_Pack_Le16(&p[6], pWriter->Count);
+	ADC_Pack_Le16(&p[8], pWriter->Pos);
+	ADC_Pack_Le32(&p[10], FirstSample);
+
+	length = ADC_PACK_HEADER_BYTES + pWriter->Pos;
+	crc    = ADC_Pack_Crc16(&p[2], length - 2U, 0xFFFFU);
+	ADC_Pack_Le16(&p[length], crc);
+
+	return length + ADC_PACK_CRC_BYTES;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           FRAME READER                                                   */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	const uint8_t *pData;
+	uint32_t       BitPos;
+	uint32_t       BitEnd;
+} ADC_Unpack_Reader_t;
+
+static bool ADC_Unpack_Bits(ADC_Unpack_Reader_t *pReader, uint32_t Count, uint32_t *pValue) {
+	uint32_t v = 0;
+
+	if (pReader->BitPos + Count > pReader->BitEnd) {
+		return false;
+	}
+	while (Count--) {
+		uint32_t pos = pReader->BitPos++;
+
+		v = (v << 1) | ((pReader->pData[pos >> 3] >> (7U - (pos & 7U))) & 1U);
+	}
+
+	*pValue = v;
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Unpack_Payload()
+ * Purpose  : Decode Count samples, mirror of ADC_Pack_Put()
+ * Details  : False on a code that runs past the payload or a
+ *            sample outside 0..2^Bits - 1
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static bool ADC_Unpack_Payload(ADC_Unpack_Reader_t *pReader, const ADC_FrameInfo_t *pInfo, uint16_t *pOut) {
+	uint32_t bits = pInfo->Bits;
+	uint32_t sum  = 4U, n = 1U;
+	uint32_t prev = 0, x;
+
+	for (uint32_t i = 0; i < pInfo->Count; i++) {
+		if ((pInfo->Mode == ADC_PACK_RAW) || (i == 0U)) {
+			if (!ADC_Unpack_Bits(pReader, bits, &x)) {
+				return false;
+			}
+		} else {
+			uint32_t k = ADC_Pack_RiceK(sum, n, bits);
+			uint32_t q = 0, bit = 1U, u, low = 0;
+			int32_t  d;
+
+			while ((q < ADC_PACK_RICE_ESCAPE) && ADC_Unpack_Bits(pReader, 1U, &bit) && bit) {
+				q++;
+			}
+			if (q == ADC_PACK_RICE_ESCAPE) {
+				if (!ADC_Unpack_Bits(pReader, bits, &x)) {
+					return false;
+				}
+				d = (int32_t)x - (int32_t)prev;
+				u = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+			} else {
+				if (bit || ((k != 0U) && !ADC_Unpack_Bits(pReader, k, &low))) {
+					return false;                                 //Ran out inside the code
+				}
+				u = (q << k) | low;
+				d = (int32_t)(u >> 1) ^ -(int32_t)(u & 1U);
+				x = (uint32_t)((int32_t)prev + d);
+				if (x >> bits) {
+					return false;
+				}
+			}
+
+			sum += u;
+			if (++n == ADC_PACK_RICE_RESET) {
+				sum >>= 1;
+				n   >>= 1;
+			}
+		}
+		pOut[i] = (uint16_t)x;
+		prev    = x;
+	}
+
+	return (pReader->BitEnd - pReader->BitPos) < 8U;              //Only the padding may be left
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Unpack_Frame()
+ * Purpose  : Check and decode the frame at pFrame
+ * Details  : pInfo->FrameBytes is valid from _CRC on, NO_SYNC /
+ *            HEADER / CRC: resync one byte further. A Count
+ *            above OutMax is reported as ADC_UNPACK_HEADER.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+ADC_UnpackStatus_t ADC_Unpack_Frame(const uint8_t *pFrame, uint32_t Length, ADC_FrameInfo_t *pInfo,
+                                    uint16_t *pOut, uint32_t OutMax) {
+	ADC_Unpack_Reader_t reader;
+	uint32_t payload, total, code_max;
+
+	if ((Length >= 1U) && (pFrame[0] != ADC_PACK_SYNC0)) {
+		return ADC_UNPACK_NO_SYNC;
+	}
+	if ((Length >= 2U) && (pFrame[1] != ADC_PACK_SYNC1)) {
+		return ADC_UNPACK_NO_SYNC;
+	}
+	if (Length < ADC_PACK_HEADER_BYTES) {
+		return ADC_UNPACK_SHORT;
+	}
+
+	pInfo->Mode        = (ADC_PackMode_t)pFrame[2];
+	pInfo->Bits        = pFrame[3];
+	pInfo->Sequence    = (uint16_t)ADC_Unpack_Le16(&pFrame[4]);
+	pInfo->Count       = ADC_Unpack_Le16(&pFrame[6]);
+	pInfo->FirstSample = ADC_Unpack_Le16(&pFrame[10]) | (ADC_Unpack_Le16(&pFrame[12]) << 16);
+	payload            = ADC_Unpack_Le16(&pFrame[8]);
+
+	code_max = (pInfo->Mode == ADC_PACK_DELTA) ? (pInfo->Bits + ADC_PACK_RICE_ESCAPE) : pInfo->Bits;
+	if ((pFrame[2] > ADC_PACK_DELTA) || (pInfo->Bits == 0U) || (pInfo->Bits > 16U) ||
+	    (pInfo->Count > OutMax) || (payload > ADC_PACK_PAYLOAD_MAX(pInfo->Count, code_max))) {
+		return ADC_UNPACK_HEADER;
+	}
+
+	total = ADC_PACK_HEADER_BYTES + payload;
+	pInfo->FrameBytes = total + ADC_PACK_CRC_BYTES;
+	if (Length < pInfo->FrameBytes) {
+		return ADC_UNPACK_SHORT;
+	}
+	if (ADC_Pack_Crc16(&pFrame[2], total - 2U, 0xFFFFU) != ADC_Unpack_Le16(&pFrame[total])) {
+		return ADC_UNPACK_CRC;
+	}
+
+	reader.pData  = &pFrame[ADC_PACK_HEADER_BYTES];
+	reader.BitPos = 0;
+	reader.BitEnd = payload * 8U;
+
+	return ADC_Unpack_Payload(&reader, pInfo, pOut) ? ADC_UNPACK_OK : ADC_UNPACK_PAYLOAD;
+}
@@ -0,0 +1,150 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_queue.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 27, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Queue - Lock-Free SPSC Block Descriptor Queue         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Lock-free queue between the DMA interrupt (producer) and the main loop (consumer).                       *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - No LDREX/STREX and no interrupt masking: the Cortex-M0+ has neither exclusive access nor a need       *
+ *     for it here. queue_head is only written by the producer, queue_tail only by the consumer, and        *
+ *     both are aligned 32-bit words, so every update is a single atomic store.                             *
+ *   - Free-running indices: depth = head - tail, slot = index & (DEPTH - 1).                               *
+ *   - Counters for dropped descriptors, peak depth and ADC OVR events.                                     *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - The slot is written before the head is advanced (__DMB), the consumer copies the slot before         *
+ *     advancing the tail, so neither side ever sees a half-written descriptor.                             *
+ *   - A dropped descriptor is not handed to the consumer: the producer must release it to the stream.      *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_queue.h"
+#include "stm32g030xx.h"
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           QUEUE STATE                                                    */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static ADC_Block_t                queue_slots[ADC_QUEUE_DEPTH];
+static volatile uint32_t          queue_head;                     //Written by the producer only
+static volatile uint32_t          queue_tail;                     //Written by the consumer only
+static volatile ADC_QueueStats_t  queue_stats;                    //Written by the producer only
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Queue_Reset()
+ * Purpose  : Empty the queue and clear the counters
+ * Details  : Call before ADC_Stream_Start(), not while running
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Queue_Reset(void) {
+
+	queue_head = 0;
+	queue_tail = 0;
+
+	queue_stats.Published   = 0;
+	queue_stats.Dropped     = 0;
+	queue_stats.PeakDepth   = 0;
+	queue_stats.AdcOverruns = 0;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           PRODUCER (INTERRUPT CONTEXT)                                   */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Queue_Push()
+ * Purpose  : Publish one block descriptor
+ * Details  : Returns false (and counts a drop) when full. Also
+ *            samples and clears ADC_ISR_OVR once per block.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Queue_Push(const ADC_Block_t *pBlock) {
+	uint32_t head = queue_head;
+	uint32_t depth;
+
+	if (ADC1->ISR & ADC_ISR_OVR) {
+		WRITE_REG(ADC1->ISR, ADC_ISR_OVR);                        //Clear OVR (write 1)
+		queue_stats.AdcOverruns++;
+	}
+
+	if ((head - queue_tail) >= ADC_QUEUE_DEPTH) {
+		queue_stats.Dropped++;
+		return false;
+	}
+
+	queue_slots[head & (ADC_QUEUE_DEPTH - 1U)] = *pBlock;
+	__DMB();                                                      //Slot contents before the new head
+	queue_head = head + 1U;
+
+	queue_stats.Published++;
+	depth = (head + 1U) - queue_tail;
+	if (depth > queue_stats.PeakDepth) {
+		queue_stats.PeakDepth = depth;
+	}
+
+	return true;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           CONSUMER (MAIN LOOP)                                           */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Queue_Pop()
+ * Purpose  : Take the oldest block descriptor
+ * Details  : Returns false when the queue is empty
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Queue_Pop(ADC_Block_t *pBlock) {
+	uint32_t tail = queue_tail;
+
+	if (queue_head == tail) {
+		return false;
+	}
+
+	__DMB();                                                      //Head observed before reading the slot
+	*pBlock = queue_slots[tail & (ADC_QUEUE_DEPTH - 1U)];
+	__DMB();                                                      //Slot copied before it is handed back
+	queue_tail = tail + 1U;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Queue_Depth()
+ * Purpose  : Current number of queued descriptors
+ * Details  : Snapshot, may change immediately after
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Queue_Depth(void) {
+
+	return queue_head - queue_tail;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Queue_GetStats()
+ * Purpose  : Copy the queue counters
+ * Details  : Each field is read atomically, not the set
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Queue_GetStats(ADC_QueueStats_t *pStats) {
+
+	pStats->Published   = queue_stats.Published;
+	pStats->Dropped     = queue_stats.Dropped;
+	pStats->PeakDepth   = queue_stats.PeakDepth;
+	pStats->AdcOverruns = queue_stats.AdcOverruns;
+}
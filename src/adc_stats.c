@@ -0,0 +1,241 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_stats.c                          ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 11, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Statistics - Single-Pass Windowed Channel Statistics  ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Incremental statistics over DMA blocks: every sample is touched once, nothing is buffered.               *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Per sample: two compares, one add, one 16x16 multiply and a 64-bit add (ADDS/ADCS) on the M0+.       *
+ *   - Interleaved scans are walked with a stride per channel, so the inner loop keeps its accumulators     *
+ *     in registers instead of indexing by channel on every sample. The scan phase carries over blocks.     *
+ *   - Window results (divisions, integer square roots) are computed once per window, not per sample.       *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - RMS uses the 64-bit sum of squares: mean square in Q8, isqrt -> Q4. AC RMS is sqrt of the exact      *
+ *     integer variance (SumSq - Sum^2 / n) / n, so it stays accurate on top of a large DC level.           *
+ *   - Results are published per channel as the window closes; ADC_Stats_Get() masks interrupts for the    *
+ *     copy so a reader in the main loop never sees a half-written result from the DMA ISR.                 *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_stats.h"
+#include "stm32g030xx.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           HELPERS                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Sqrt64()
+ * Purpose  : floor(sqrt(x)) for a 64-bit value
+ * Details  : Bit-by-bit, 32 iterations, no multiply or divide.
+ *            Shared with adc_fft.c (band and bin magnitudes)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t ADC_Stats_Sqrt64(uint64_t x) {
+	uint64_t root = 0;
+	uint64_t bit  = 1ULL << 62;
+
+	while (bit > x) {
+		bit >>= 2;
+	}
+	while (bit != 0U) {
+		if (x >= root + bit) {
+			x   -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (uint32_t)root;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Clear()
+ * Purpose  : Start a new window for one channel
+ * Details  : -
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Stats_Clear(ADC_StatsAcc_t *pAcc) {
+
+	pAcc->Sum   = 0;
+	pAcc->SumSq = 0;
+	pAcc->Count = 0;
+	pAcc->Min   = UINT16_MAX;
+	pAcc->Max   = 0;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Publish()
+ * Purpose  : Close a full window and derive the results
+ * Details  : Once per window: a few 64-bit divides, two isqrt
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Stats_Publish(ADC_Stats_t *pStats, uint32_t Channel) {
+	const ADC_StatsAcc_t *pAcc = &pStats->Acc[Channel];
+	ADC_StatsResult_t    *pRes = &pStats->Result[Channel];
+	uint32_t n = pAcc->Count;
+	uint64_t sum = pAcc->Sum;
+	uint64_t sum2_n;                                              //Sum^2 / n in Q8, without a 2^64 Sum^2
+	uint64_t ms_q8, var_q8;
+
+	sum2_n = ((sum * (sum / n)) << 8) + ((sum * (sum % n)) << 8) / n;
+	ms_q8  = pAcc->SumSq << 8;                                    //SumSq < 2^48, no overflow
+	var_q8 = (ms_q8 > sum2_n) ? (ms_q8 - sum2_n) / n : 0U;        //n * variance, exact up to here
+
+	pRes->Count      = n;
+	pRes->Min        = pAcc->Min;
+	pRes->Max        = pAcc->Max;
+	pRes->PeakToPeak = (uint16_t)(pAcc->Max - pAcc->Min);
+	pRes->MeanQ4     = (uint32_t)(((sum << 4) + n / 2U) / n);
+	pRes->RmsQ4      = ADC_Stats_Sqrt64((ms_q8 + n / 2U) / n);
+	pRes->AcRmsQ4    = ADC_Stats_Sqrt64(var_q8);
+	pRes->Sequence++;
+
+	if (pStats->Callback != NULL) {
+		pStats->Callback(Channel, pRes);
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Run()
+ * Purpose  : Accumulate Count samples of one channel
+ * Details  : pData advances by Stride (scan length), the
+ *            window may close any number of times in between
+ * Runtime  : ~X.Xxx per sample
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Stats_Run(ADC_Stats_t *pStats, uint32_t Channel, const uint16_t *pData, uint32_t Count, uint32_t Stride) {
+	ADC_StatsAcc_t *pAcc = &pStats->Acc[Channel];
+	uint32_t sum    = pAcc->Sum;                                  //Locals: stay in registers
+	uint64_t sumsq  = pAcc->SumSq;
+	uint32_t filled = pAcc->Count;
+	uint32_t window = pStats->Window;
+	uint16_t min    = pAcc->Min;
+	uint16_t max    = pAcc->Max;
+
+	while (Count--) {
+		uint32_t v = *pData;
+
+		pData += Stride;
+		if (v < min) {
+			min = (uint16_t)v;
+		}
+		if (v > max) {
+			max = (uint16_t)v;
+		}
+		sum   += v;
+		sumsq += v * v;
+
+		if (++filled == window) {
+			pAcc->Sum   = sum;
+			pAcc->SumSq = sumsq;
+			pAcc->Count = filled;
+			pAcc->Min   = min;
+			pAcc->Max   = max;
+			ADC_Stats_Publish(pStats, Channel);
+
+			sum = 0; sumsq = 0; filled = 0;
+			min = UINT16_MAX; max = 0;
+		}
+	}
+
+	pAcc->Sum   = sum;
+	pAcc->SumSq = sumsq;
+	pAcc->Count = filled;
+	pAcc->Min   = min;
+	pAcc->Max   = max;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           STATISTICS ENGINE                                              */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Init()
+ * Purpose  : Set scan length and window, clear everything
+ * Details  : Window is per channel, 1..ADC_STATS_WINDOW_MAX
+ *            samples; Callback may be NULL
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Stats_Init(ADC_Stats_t *pStats, uint32_t Channels, uint32_t Window, ADC_StatsCallback_t Callback) {
+
+	if ((pStats == NULL) || (Channels == 0U) || (Channels > ADC_STATS_MAX_CHANNELS) ||
+	    (Window == 0U) || (Window > ADC_STATS_WINDOW_MAX)) {
+		return false;
+	}
+
+	memset(pStats, 0, sizeof(*pStats));
+	pStats->Channels = Channels;
+	pStats->Window   = Window;
+	pStats->Callback = Callback;
+
+	for (uint32_t c = 0; c < Channels; c++) {
+		ADC_Stats_Clear(&pStats->Acc[c]);
+	}
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Update()
+ * Purpose  : Feed one block (interleaved when Channels > 1)
+ * Details  : Blocks need not hold whole scans, the channel of
+ *            the first sample follows on from the last block
+ * Runtime  : ~X.Xxx per sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Stats_Update(ADC_Stats_t *pStats, const uint16_t *pData, uint32_t Length) {
+	uint32_t channels = pStats->Channels;
+	uint32_t phase    = pStats->Phase;
+
+	if (channels == 1U) {
+		ADC_Stats_Run(pStats, 0U, pData, Length, 1U);
+		return;
+	}
+
+	for (uint32_t c = 0; c < channels; c++) {
+		uint32_t first = (c + channels - phase) % channels;        //Offset of this channel's first sample
+
+		if (first < Length) {
+			ADC_Stats_Run(pStats, c, &pData[first], (Length - first + channels - 1U) / channels, channels);
+		}
+	}
+
+	pStats->Phase = (phase + Length) % channels;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stats_Get()
+ * Purpose  : Copy the last completed window of one channel
+ * Details  : False until the first window has closed
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Stats_Get(const ADC_Stats_t *pStats, uint32_t Channel, ADC_StatsResult_t *pResult) {
+	uint32_t primask;
+
+	if (Channel >= pStats->Channels) {
+		return false;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*pResult = pStats->Result[Channel];
+	__set_PRIMASK(primask);
+
+	return pResult->Sequence != 0U;
+}
@@ -0,0 +1,201 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_stream.c                         ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 12, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Streaming - Ping-Pong Block Delivery over DMA         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This module turns the circular ADC DMA buffer into a gapless stream of fixed-size blocks.                *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Half-transfer and transfer-complete interrupts split the buffer into two blocks.                     *
+ *   - Each block is handed to the consumer in place (zero-copy) with a running sequence number.            *
+ *   - Detects and counts a block that is still held by the consumer when DMA wraps back into it.           *
+ *   - Half-word buffers (ADC_Stream_Start) or byte-packed ones for 6/8-bit results (ADC_Stream_Start8).    *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - The buffer length must be even; each block is Length / 2 samples.                                    *
+ *   - The consumer has one block time (Length / 2 conversions) to release a block.                         *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_stream.h"
+#include "stm32g030xx.h"
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           STREAM STATE                                                   */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint16_t                   *stream_buffer;
+static uint8_t                    *stream_buffer8;                //Byte-packed stream (ADC_Stream_Start8)
+static uint32_t                    stream_half;                   //Samples per block
+static ADC_BlockCallback_t         stream_callback;
+static volatile uint32_t           stream_sequence;
+static volatile bool               stream_busy[2];                //Block owned by the consumer
+static volatile ADC_StreamStats_t  stream_stats;
+static uint32_t                    stream_channel;                //DMA1 channel of the ADC (DMA1_InitAdc())
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_Deliver()
+ * Purpose  : Hand one half of the DMA buffer to the consumer
+ * Details  : DMA is now filling the other half, check it is free
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Stream_Deliver(uint32_t half) {
+	ADC_Block_t block;
+
+	if (stream_busy[half ^ 1U]) {
+		stream_stats.Overruns++;                                  //DMA is overwriting a block still in use
+	}
+
+	stream_busy[half] = true;
+
+	if (stream_buffer8 != NULL) {
+		block.pData8      = &stream_buffer8[half * stream_half];
+		block.SampleBytes = 1U;
+	} else {
+		block.pData       = &stream_buffer[half * stream_half];
+		block.SampleBytes = 2U;
+	}
+	block.Length   = stream_half;
+	block.Sequence = stream_sequence++;
+
+	stream_stats.BlocksDelivered++;
+	stream_callback(&block);
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           STREAM CONTROL                                                 */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_Reset()
+ * Purpose  : Common stream state for both buffer widths
+ * Details  : Runs before DMA is enabled
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Stream_Reset(uint32_t Length, ADC_BlockCallback_t Callback) {
+
+	stream_half     = Length / 2U;
+	stream_callback = Callback;
+	stream_channel  = DMA1_GetAdcChannel();
+	stream_sequence = 0;
+	stream_busy[0]  = false;
+	stream_busy[1]  = false;
+
+	stream_stats.BlocksDelivered = 0;
+	stream_stats.Overruns        = 0;
+	stream_stats.LateIRQs        = 0;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_Start()
+ * Purpose  : Start gapless ping-pong acquisition into pBuffer
+ * Details  : Length must be even, Callback receives each block
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Stream_Start(uint16_t *pBuffer, uint32_t Length, ADC_BlockCallback_t Callback) {
+
+	if ((pBuffer == NULL) || (Callback == NULL) || (Length < 2U) || (Length & 1U)) {
+		return false;
+	}
+
+	stream_buffer  = pBuffer;
+	stream_buffer8 = NULL;
+	ADC_Stream_Reset(Length, Callback);
+	if (stream_channel == DMA1_CHANNEL_ANY) {
+		return false;                                             //DMA1_InitAdc() not called
+	}
+
+	return ADC_Start_DMA16(ADC1, DMA1_GetChannel(stream_channel), pBuffer, Length);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_Start8()
+ * Purpose  : Same as ADC_Stream_Start(), one byte per sample
+ * Details  : Needs ADC1_GetResultBits() <= 8 (6/8-bit modes),
+ *            blocks carry pData8
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Stream_Start8(uint8_t *pBuffer, uint32_t Length, ADC_BlockCallback_t Callback) {
+
+	if ((pBuffer == NULL) || (Callback == NULL) || (Length < 2U) || (Length & 1U)) {
+		return false;
+	}
+
+	stream_buffer  = NULL;
+	stream_buffer8 = pBuffer;
+	ADC_Stream_Reset(Length, Callback);
+
+	if (stream_channel == DMA1_CHANNEL_ANY) {
+		return false;
+	}
+
+	return ADC_Start_DMA8(ADC1, DMA1_GetChannel(stream_channel), pBuffer, Length);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_Release()
+ * Purpose  : Give a delivered block back to the DMA
+ * Details  : May be called from the callback or later from main
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Stream_Release(const ADC_Block_t *pBlock) {
+
+	stream_busy[pBlock->Sequence & 1U] = false;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_GetStats()
+ * Purpose  : Copy the stream counters
+ * Details  : Counters are reset by ADC_Stream_Start()
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Stream_GetStats(ADC_StreamStats_t *pStats) {
+
+	pStats->BlocksDelivered = stream_stats.BlocksDelivered;
+	pStats->Overruns        = stream_stats.Overruns;
+	pStats->LateIRQs        = stream_stats.LateIRQs;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           INTERRUPT HANDLING                                             */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Stream_IRQHandler()
+ * Purpose  : Service HT/TC of the ADC DMA channel
+ * Details  : Call from the DMA_Handler_t given to DMA1_InitAdc()
+ *            with its Flags (no second DMA_ISR read)
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Stream_IRQHandler(uint32_t Flags) {
+	uint32_t pending = Flags & (DMA_FLAG_HT | DMA_FLAG_TC);
+
+	if (pending == 0U) {
+		return;
+	}
+
+	DMA1_ClearFlags(stream_channel, pending);
+
+	if (pending == (DMA_FLAG_HT | DMA_FLAG_TC)) {
+		/*
+		 * The ISR was held off for a whole block: deliver both halves in sequence order
+		 */
+		stream_stats.LateIRQs++;
+		ADC_Stream_Deliver(stream_sequence & 1U);
+	}
+
+	ADC_Stream_Deliver(stream_sequence & 1U);
+}
@@ -0,0 +1,340 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: adc_vref.c                           ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 23, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 ADC Supply Tracking - VREFINT Ratiometric Correction      ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * Tracks VDDA (= VREF+ on the G030) from VREFINT samples taken in the running scan, so millivolt results   *
+ * follow the real supply instead of the 3.3 V assumed at build time.                                       *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - No extra conversions: VREFINT / TSENSE are positions of the DMA scan, picked out of each block       *
+ *     with a stride (scan phase carried over blocks, as in adc_stats.c).                                   *
+ *   - Per sample one add; per window one 64-bit division for VDDA = 3.0 V * VREFINT_CAL / average and      *
+ *     one for the Q16 scale, which is cached and applied per block by ADC_Vref_Convert_Block_mV().         *
+ *   - Temperature from TS_CAL1 and the typical slope, corrected to the measured VDDA first.                *
+ *   - Windows with an impossible VDDA (outside 1.7-3.6 V, e.g. a disturbed sample) keep the old scale.     *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - VREFEN/TSEN are written with ADSTART = 0. The first window after ADC_Vref_Start() is dropped: it     *
+ *     holds the start-up of the reference buffer and the sensor.                                           *
+ *   - Until the first accepted window the nominal ADC_CONVERT_MV_Q16 (ADC_VREF_mV) is used.                *
+ *   - The internal channels need a long sampling time (ADC_VREF_TSMP_MIN_NS); ADC_Vref_AddChannels()       *
+ *     reuses a long enough SMPx of the scan before adding a second one. It lowers the scan rate.           *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "adc_vref.h"
+#include "stm32g030xx.h"
+
+#define ADC_VREF_NONE                        UINT32_MAX
+#define ADC_VREF_WINDOW_MAX                  65536UL    // Sum of 16-bit codes stays within uint32
+#define ADC_VREF_CAL_FULL_SCALE              4095U      // Calibration words are 12-bit codes
+
+_Static_assert(((uint64_t)ADC_FULL_SCALE * ADC_CONVERT_MV_Q16_AT(ADC_VREF_VDDA_MAX_mV) + 0x8000U) <= 0xFFFFFFFFULL,
+               "ADC_Vref_Convert_Block_mV: full-scale product overflows 32 bits at ADC_VREF_VDDA_MAX_mV");
+_Static_assert((((uint64_t)ADC_FULL_SCALE * ADC_CONVERT_MV_Q16_AT(ADC_VREF_VDDA_MAX_mV) + 0x8000U) >> 16) <= 0xFFFFU,
+               "ADC_Vref_Convert_Block_mV: full-scale millivolts do not fit uint16_t at ADC_VREF_VDDA_MAX_mV");
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           TRACKING STATE                                                 */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+static uint32_t vref_channels = 1U;                               //Scan length
+static uint32_t vref_slot     = ADC_VREF_NONE;                    //Scan position of VREFINT
+static uint32_t temp_slot     = ADC_VREF_NONE;                    //Scan position of TSENSE
+static uint32_t vref_phase;                                       //Scan position of the next incoming sample
+static uint32_t vref_window;
+static uint32_t vref_sum, vref_count;
+static uint32_t temp_sum, temp_count;
+static uint16_t vref_cal, temp_cal;
+static bool     vref_discard;                                     //Next window is start-up, drop it
+
+static volatile uint32_t vref_scale = ADC_CONVERT_MV_Q16;         //Cached, read by the block conversion
+static ADC_VrefResult_t  vref_result = { .Vdda_mV = ADC_VREF_mV, .ScaleQ16 = ADC_CONVERT_MV_Q16,
+                                         .Temp_dC = INT32_MIN };
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           HELPERS                                                        */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Accumulate()
+ * Purpose  : Sum the samples of one scan position in a block
+ * Details  : Stride = scan length, first sample from the phase
+ * Runtime  : ~3 cycles/scan
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t ADC_Vref_Accumulate(const uint16_t *pData, uint32_t Length, uint32_t Slot, uint32_t *pCount) {
+	const uint32_t n   = vref_channels;
+	uint32_t       i   = (Slot + n - vref_phase) % n;
+	uint32_t       sum = 0;
+
+	for (; i < Length; i += n) {
+		sum += pData[i];
+		(*pCount)++;
+	}
+	return sum;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Temperature()
+ * Purpose  : 0.1 degC from the TSENSE average of the window
+ * Details  : Code rescaled to the 3.0 V calibration conditions
+ *            (x VDDA / 3.0 V), then TS_CAL1 + Avg_Slope. Q4
+ *            intermediate keeps the averaged fraction.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static int32_t ADC_Vref_Temperature(uint32_t Vdda_mV) {
+	int64_t ts_q4 = (int64_t)(((uint64_t)temp_sum * 16U * Vdda_mV * ADC_VREF_CAL_FULL_SCALE) /
+	                          ((uint64_t)temp_count * ADC_FULL_SCALE * ADC_VREF_CAL_mV));
+	int64_t delta = (ts_q4 - ((int64_t)temp_cal * 16)) * ((int64_t)ADC_VREF_CAL_mV * 10000);
+	int64_t den   = (int64_t)ADC_VREF_CAL_FULL_SCALE * 16 * ADC_VREF_TS_SLOPE_uV;
+
+	delta += (delta >= 0) ? (den / 2) : -(den / 2);               //Round to nearest
+
+	return (ADC_VREF_CAL_DEGC * 10) + (int32_t)(delta / den);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Close()
+ * Purpose  : End of a window: VDDA, scale and temperature
+ * Details  : VDDA = 3000 * VREFINT_CAL * FS * n / (sum * 4095)
+ *            with FS = ADC_FULL_SCALE, so any resolution of the
+ *            conversion path gets the exact ratio
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void ADC_Vref_Close(void) {
+	ADC_VrefResult_t result = vref_result;
+	uint64_t         num = (uint64_t)ADC_VREF_CAL_mV * vref_cal * ADC_FULL_SCALE * vref_count;
+	uint64_t         den = (uint64_t)vref_sum * ADC_VREF_CAL_FULL_SCALE;
+	uint32_t         vdda = (den != 0U) ? (uint32_t)((num + den / 2U) / den) : 0U;
+	uint32_t         primask;
+
+	if (vref_discard) {
+		vref_discard = false;
+	} else if ((vdda < ADC_VREF_VDDA_MIN_mV) || (vdda > ADC_VREF_VDDA_MAX_mV)) {
+		result.Rejected++;
+	} else {
+		result.Sequence++;
+		result.Vdda_mV  = vdda;
+		result.ScaleQ16 = ADC_CONVERT_MV_Q16_AT(vdda);
+		result.Temp_dC  = (temp_count != 0U) ? ADC_Vref_Temperature(vdda) : INT32_MIN;
+		vref_scale      = result.ScaleQ16;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	vref_result = result;
+	__set_PRIMASK(primask);
+
+	vref_sum   = 0;
+	vref_count = 0;
+	temp_sum   = 0;
+	temp_count = 0;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           DATA PROCESSING                                                */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Update()
+ * Purpose  : Feed one interleaved block of the running scan
+ * Details  : Blocks need not hold whole scans. A window closes
+ *            at the block that completes it, so it may hold a
+ *            few samples more than Window.
+ * Runtime  : ~3 cycles per scan + one close per window
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Vref_Update(const uint16_t *pData, uint32_t Length) {
+
+	if (vref_slot == ADC_VREF_NONE) {
+		return;
+	}
+
+	vref_sum += ADC_Vref_Accumulate(pData, Length, vref_slot, &vref_count);
+	if (temp_slot != ADC_VREF_NONE) {
+		temp_sum += ADC_Vref_Accumulate(pData, Length, temp_slot, &temp_count);
+	}
+	vref_phase = (vref_phase + Length) % vref_channels;
+
+	if (vref_count >= vref_window) {
+		ADC_Vref_Close();
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Convert_Block_mV()
+ * Purpose  : ADC_Convert_Block_mV() with the cached VDDA scale
+ * Details  : pOut may alias pRaw. Internal channel positions
+ *            are converted too; skip them when reading.
+ * Runtime  : ~6 cycles/sample
+ * ────────────────────────────────────────────────────────────── */
+void ADC_Vref_Convert_Block_mV(const uint16_t *pRaw, uint16_t *pOut, uint32_t Length) {
+	ADC_Convert_Block_mV_Scaled(pRaw, pOut, Length, vref_scale);
+}
+
+uint32_t ADC_Vref_GetScale(void) {
+	return vref_scale;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Get()
+ * Purpose  : Copy the last VDDA / temperature result
+ * Details  : False until a window has been accepted
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Vref_Get(ADC_VrefResult_t *pResult) {
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	*pResult = vref_result;
+	__set_PRIMASK(primask);
+
+	return pResult->Sequence != 0U;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/*																											*/
+/*                                           LOW-LEVEL FUNCTIONS                                            */
+/*																										    */
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_AddChannels()
+ * Purpose  : Append VREFINT (and TSENSE) to a scan config
+ * Details  : Sampling time: the shortest SMPx already in the
+ *            scan that covers ADC_VREF_TSMP_MIN_NS, else the
+ *            shortest code that does (160.5 if none). Channels
+ *            already present are left alone.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Vref_AddChannels(ADC_ScanConfig_t *pConfig, bool Temperature) {
+	static const uint32_t smp_half[8] = { 3U, 7U, 15U, 25U, 39U, 79U, 159U, 321U };
+	const uint64_t        need_half   = (2ULL * ADC_VREF_TSMP_MIN_NS * ADC_PLAN_FADC_HZ + 999999999ULL) / 1000000000ULL;
+	ADC_SampleTime_t      smp = ADC_SMP_160_5;
+	bool                  reuse = false;
+	uint8_t               add[2] = { ADC_VREF_CHANNEL_VREFINT, ADC_VREF_CHANNEL_TSENSE };
+
+	if (pConfig == NULL) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < pConfig->NumChannels; i++) {
+		ADC_SampleTime_t st = pConfig->SampleTime[i];
+
+		if ((smp_half[st] >= need_half) && (!reuse || (st < smp))) {
+			smp   = st;                                           //Reuse: keeps the second SMPx free
+			reuse = true;
+		}
+	}
+	for (uint32_t s = (uint32_t)ADC_SMP_1_5; !reuse && (s <= (uint32_t)ADC_SMP_160_5); s++) {
+		if (smp_half[s] >= need_half) {
+			smp = (ADC_SampleTime_t)s;
+			break;
+		}
+	}
+
+	for (uint32_t a = 0; a < (Temperature ? 2U : 1U); a++) {
+		bool present = false;
+
+		for (uint32_t i = 0; i < pConfig->NumChannels; i++) {
+			present |= (pConfig->Channels[i] == add[a]);
+		}
+		if (present) {
+			continue;
+		}
+		if (pConfig->NumChannels >= ADC_SCAN_MAX_CHANNELS) {
+			return false;
+		}
+		pConfig->Channels[pConfig->NumChannels]   = add[a];
+		pConfig->SampleTime[pConfig->NumChannels] = smp;
+		pConfig->NumChannels++;
+	}
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Start()
+ * Purpose  : Enable VREFINT/TSENSE and track the current scan
+ * Details  : Call after ADC1_ConfigScan(), before the stream
+ *            starts (CCR with ADSTART = 0). False if VREFINT is
+ *            not scanned, the ADC runs, the results are not at
+ *            the conversion scale or the factory word is blank.
+ *            Window = VREFINT samples per VDDA update.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Vref_Start(uint32_t Window) {
+	uint8_t  order[ADC_SCAN_MAX_CHANNELS];
+	uint32_t n = ADC_Scan_GetOrder(order);
+	uint32_t slot = ADC_VREF_NONE, tslot = ADC_VREF_NONE;
+	uint32_t ccr  = ADC_CCR_VREFEN;
+
+	if ((Window == 0U) || (Window > ADC_VREF_WINDOW_MAX) || (READ_REG(ADC1->CR) & ADC_CR_ADSTART) ||
+	    (ADC1_GetResultBits() != ADC_RESOLUTION_BITS)) {
+		return false;
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		slot  = ((order[i] == ADC_VREF_CHANNEL_VREFINT) && (slot == ADC_VREF_NONE)) ? i : slot;
+		tslot = ((order[i] == ADC_VREF_CHANNEL_TSENSE) && (tslot == ADC_VREF_NONE)) ? i : tslot;
+	}
+
+	vref_cal = *VREFINT_CAL_ADDR;
+	temp_cal = *TEMPSENSOR_CAL1_ADDR;
+	if ((slot == ADC_VREF_NONE) || (vref_cal == 0U) || (vref_cal >= ADC_VREF_CAL_FULL_SCALE)) {
+		return false;
+	}
+	if ((temp_cal == 0U) || (temp_cal >= ADC_VREF_CAL_FULL_SCALE)) {
+		tslot = ADC_VREF_NONE;                                    //No usable TS_CAL1: VDDA only
+	}
+	if (tslot != ADC_VREF_NONE) {
+		ccr |= ADC_CCR_TSEN;
+	}
+
+	/*
+	 * 14.10 / 14.11: internal channels connected (ADSTART = 0)
+	 */
+	MODIFY_REG(ADC->CCR, ADC_CCR_VREFEN | ADC_CCR_TSEN, ccr);
+
+	vref_channels = n;
+	vref_slot     = slot;
+	temp_slot     = tslot;
+	vref_phase    = 0;
+	vref_window   = Window;
+	vref_sum      = 0;
+	vref_count    = 0;
+	temp_sum      = 0;
+	temp_count    = 0;
+	vref_discard  = true;
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Vref_Stop()
+ * Purpose  : Stop tracking, disconnect VREFINT/TSENSE
+ * Details  : Needs ADSTART = 0 (false otherwise). The last
+ *            measured scale stays in use.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Vref_Stop(void) {
+
+	if (READ_REG(ADC1->CR) & ADC_CR_ADSTART) {
+		return false;
+	}
+	vref_slot = ADC_VREF_NONE;
+	temp_slot = ADC_VREF_NONE;
+	CLEAR_BIT(ADC->CCR, ADC_CCR_VREFEN | ADC_CCR_TSEN);          //Saves the reference buffer / sensor current
+
+	return true;
+}
@@ -13,6 +13,10 @@
  *                                                                                                          *
  * Key Features:                                                                                            *
  *   - Configure DMA channels, and priorities.                                                              *
+ *   - Channel allocator: any free channel (or a requested one) per DMAMUX request, so ADC, USART and       *
+ *     SPI streams run side by side without hard-wired channel numbers.                                     *
+ *   - Owns the shared G0 vectors (Ch1, Ch2/3, Ch4/5) and dispatches to the handler of each channel with    *
+ *     its flags, one DMA_ISR read per vector entry.                                                        *
  *   - Start and monitor memory-to-peripheral or peripheral-to-memory transfers.                            *
  *   - Interrupt callbacks for transfer complete or error events.                                           *
  *                                                                                                          *
@@ -23,6 +27,7 @@
  * Notes:                                                                                                   *
  *   - Ensure DMA and associated peripheral clocks are enabled before use.                                  *
  *   - Polling or interrupt-driven transfers are supported.                                                 *
+ *   - Channels sharing a vector share one NVIC priority: the most urgent of their configurations.          *
  *                                                                                                          */
 /* ******************* ──────────────────────────────────────────────────────────────── ******************* */
 
@@ -33,56 +38,349 @@
 /* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 
 #include "dma.h"
+#include "adc.h"
 #include "stm32g030xx.h"
 
 
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CHANNEL TABLE                                                  */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+typedef struct {
+	uint32_t      Request;                                        //0: free
+	DMA_Handler_t Handler;
+	void         *pCtx;
+} DMA_Slot_t;
+
+static DMA_Slot_t dma_slot[DMA1_CHANNELS];
+static uint8_t    dma_irq_priority[3];                           //Per vector, valid while one of its channels is in use
+static uint32_t   dma_adc_channel;                                //DMA1_InitAdc(), DMA1_CHANNEL_ANY = none
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_Vector()
+ * Purpose  : Shared G0 vector of a channel: 0 = Ch1, 1 = Ch2/3,
+ *            2 = Ch4/5 (+ DMAMUX overrun)
+ * Details  : Channel 1..DMA1_CHANNELS
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static uint32_t DMA1_Vector(uint32_t Channel) {
+	return (Channel <= 1U) ? 0U : (Channel <= 3U) ? 1U : 2U;
+}
+
+static DMAMUX_Channel_TypeDef *DMA1_GetMux(uint32_t Channel) {
+
+	switch (Channel) {
+	case 1U: return DMAMUX1_Channel0;
+	case 2U: return DMAMUX1_Channel1;
+	case 3U: return DMAMUX1_Channel2;
+	case 4U: return DMAMUX1_Channel3;
+	case 5U: return DMAMUX1_Channel4;
+	default: return NULL;
+	}
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_Dispatch()
+ * Purpose  : Route one shared vector to the channel handlers
+ * Details  : One ISR read for all channels of the vector. Flags
+ *            of channels without a handler are cleared so they
+ *            cannot keep the line busy.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+static void DMA1_Dispatch(uint32_t First, uint32_t Last) {
+	uint32_t isr = DMA1->ISR;
+
+	for (uint32_t ch = First; ch <= Last; ch++) {
+		uint32_t    flags = (isr >> (4U * (ch - 1U))) & DMA_FLAG_ALL;
+		DMA_Slot_t *slot  = &dma_slot[ch - 1U];
+
+		if ((flags & (DMA_FLAG_TC | DMA_FLAG_HT | DMA_FLAG_TE)) == 0U) {
+			continue;
+		}
+		if (slot->Handler != NULL) {
+			slot->Handler(ch, flags, slot->pCtx);
+		} else {
+			DMA1_ClearFlags(ch, DMA_FLAG_ALL);
+		}
+	}
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INITIALIZATIONS                                                */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
 /* ────────────────────────────────────────────────────────────── /
  * Function : DMA1_Init()
- * Purpose  : Initialize DMA, Enable clock, circular mode
- * Details  : Sets priority, CIRC mode, sizes, and interrupts
+ * Purpose  : Enable the DMA1/DMAMUX clock, release all channels
+ * Details  : Call once before any DMA1_Alloc()
  * Runtime  : ~X.Xxx ms
  * ────────────────────────────────────────────────────────────── */
 void DMA1_Init(void) {
 
 	SET_BIT(RCC->AHBENR,RCC_AHBENR_DMA1EN);                       //DMA1 and DMAMUX clock enable
 
-	SET_BIT(DMAMUX1_Channel0->CCR, DMAMUX_ADC_DMA );              //Set ADC as DMA trigger
+	for (uint32_t ch = 1U; ch <= DMA1_CHANNELS; ch++) {
+		DMA1_Free(ch);
+	}
+	dma_adc_channel = DMA1_CHANNEL_ANY;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_InitAdc()
+ * Purpose  : Allocate and set up the ADC channel, circular mode
+ * Details  : Channel, priority and handler from pConfig, Request
+ *            is forced to DMA_REQ_ADC. Sets CIRC, sizes, HT/TC
+ *            interrupts. Replaces a previous ADC channel.
+ *            Returns the channel, DMA1_CHANNEL_ANY if none free.
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+uint32_t DMA1_InitAdc(const DMA_ChannelConfig_t *pConfig) {
+	DMA_ChannelConfig_t  config = *pConfig;
+	DMA_Channel_TypeDef *dma;
+
+	if (dma_adc_channel != DMA1_CHANNEL_ANY) {
+		DMA1_Free(dma_adc_channel);
+	}
+	config.Request  = DMA_REQ_ADC;
+	dma_adc_channel = DMA1_Alloc(&config);
+	if (dma_adc_channel == DMA1_CHANNEL_ANY) {
+		return DMA1_CHANNEL_ANY;
+	}
+	dma = DMA1_GetChannel(dma_adc_channel);
 
 	/*
-	 * Enable NVIC IRQ
+	 *  Configure DMA_CCRx register parameters (EN = 0 after DMA1_Alloc())
 	 */
-	HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 1, 0);
-	HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+	MODIFY_REG(dma->CCR, DMA_CCR_PL, (uint32_t)config.Priority << DMA_CCR_PL_Pos);  //Channel priority
+	CLEAR_BIT(dma->CCR, DMA_CCR_DIR);                             //0: Data transfer direction (Peripheral--->Memory)
+	SET_BIT(dma->CCR, DMA_CCR_CIRC);                              //1: Circular mode EN
+	CLEAR_BIT(dma->CCR, DMA_CCR_PINC);                            //0: Peripheral incremented mode EN
+	SET_BIT(dma->CCR, DMA_CCR_MINC);                              //1: Memory incremented mode EN
+	DMA1_ConfigDataWidth(dma, 16U);                               //01: Peripheral / memory size 16Bits
+	SET_BIT(dma->CCR, DMA_CCR_HTIE);                              //1: Half transfer interrupt EN (ping-pong)
+	SET_BIT(dma->CCR, DMA_CCR_TCIE);                              //1: Transfer complete interrupt EN
 
+	return dma_adc_channel;
+}
 
-	CLEAR_BIT(DMA1_Channel1->CCR, DMA_CCR_EN);                    // Disable channel first for configuration
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_InitUsartTx()
+ * Purpose  : Allocate a channel for USART TX, memory to peripheral
+ * Details  : Byte-wide, one-shot per frame (no CIRC). pConfig
+ *            gives request (USART instance), channel, priority
+ *            (keep it below the ADC channel so sampling is never
+ *            stalled) and the TC/TE handler. Returns the channel,
+ *            DMA1_CHANNEL_ANY if none is free.
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+uint32_t DMA1_InitUsartTx(const DMA_ChannelConfig_t *pConfig) {
+	uint32_t             channel = DMA1_Alloc(pConfig);
+	DMA_Channel_TypeDef *dma;
+
+	if (channel == DMA1_CHANNEL_ANY) {
+		return DMA1_CHANNEL_ANY;
+	}
+	dma = DMA1_GetChannel(channel);
 
 	/*
 	 *  Configure DMA_CCRx register parameters
 	 */
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_PL_1);                    //10: Channel priority
-	CLEAR_BIT(DMA1_Channel1->CCR, DMA_CCR_DIR);                   //0: Data transfer direction (Peripheral--->Memory)
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_CIRC);                    //1: Circular mode EN
-	CLEAR_BIT(DMA1_Channel1->CCR, DMA_CCR_PINC);                  //0: Peripheral incremented mode EN
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_MINC);                    //1: Memory incremented mode EN
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_PSIZE_0);                 //01: Peripheral size 16Bits
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_MSIZE_0);                 //01: Memory size 16Bits
-	SET_BIT(DMA1_Channel1->CCR, DMA_CCR_TCIE);                    //1: Transfer complete interrupt EN
+	MODIFY_REG(dma->CCR, DMA_CCR_PL, (uint32_t)pConfig->Priority << DMA_CCR_PL_Pos);
+	SET_BIT(dma->CCR, DMA_CCR_DIR);                               //1: Data transfer direction (Memory--->Peripheral)
+	CLEAR_BIT(dma->CCR, DMA_CCR_CIRC);                            //0: One frame per enable
+	CLEAR_BIT(dma->CCR, DMA_CCR_PINC);                            //0: Always USART_TDR
+	SET_BIT(dma->CCR, DMA_CCR_MINC);                              //1: Memory incremented mode EN
+	DMA1_ConfigDataWidth(dma, 8U);                                //Bytes, PSIZE half-word (TDR low byte)
+	SET_BIT(dma->CCR, DMA_CCR_TCIE);                              //1: Transfer complete interrupt EN
+	SET_BIT(dma->CCR, DMA_CCR_TEIE);                              //1: Transfer error interrupt EN
+
+	return channel;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           CHANNEL ALLOCATION                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_Alloc()
+ * Purpose  : Claim a channel and route a DMAMUX request to it
+ * Details  : Requested channel or the lowest free one. CCR is
+ *            reset (EN = 0, PL set), flags cleared, handler and
+ *            NVIC vector enabled. A vector shared with a channel
+ *            in use keeps the more urgent NVIC priority.
+ *            Returns 1..DMA1_CHANNELS, DMA1_CHANNEL_ANY if the
+ *            channel is taken or none is free.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t DMA1_Alloc(const DMA_ChannelConfig_t *pConfig) {
+	uint32_t  channel = DMA1_CHANNEL_ANY;
+	uint32_t  vector, primask;
+	IRQn_Type irqn;
+	bool      shared = false;
 
+	if ((pConfig == NULL) || (pConfig->Request == 0U) || (pConfig->Request > (DMAMUX_CxCR_DMAREQ_ID >> DMAMUX_CxCR_DMAREQ_ID_Pos)) ||
+	    (pConfig->Channel > DMA1_CHANNELS)) {
+		return DMA1_CHANNEL_ANY;
+	}
 
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (uint32_t ch = 1U; ch <= DMA1_CHANNELS; ch++) {
+		if ((dma_slot[ch - 1U].Request == 0U) && ((pConfig->Channel == DMA1_CHANNEL_ANY) || (pConfig->Channel == ch))) {
+			channel = ch;
+			break;
+		}
+	}
+	if (channel != DMA1_CHANNEL_ANY) {
+		dma_slot[channel - 1U].Request = pConfig->Request;        //Claimed before interrupts come back
+	}
+	__set_PRIMASK(primask);
+
+	if (channel == DMA1_CHANNEL_ANY) {
+		return DMA1_CHANNEL_ANY;
+	}
+
+	vector = DMA1_Vector(channel);
+	irqn   = DMA1_GetIRQn(channel);
+	for (uint32_t ch = 1U; ch <= DMA1_CHANNELS; ch++) {
+		shared |= (ch != channel) && (DMA1_Vector(ch) == vector) && (dma_slot[ch - 1U].Handler != NULL);
+	}
+
+	WRITE_REG(DMA1_GetChannel(channel)->CCR, (uint32_t)pConfig->Priority << DMA_CCR_PL_Pos);  //EN = 0: free to configure
+	DMA1_ClearFlags(channel, DMA_FLAG_ALL);
+	WRITE_REG(DMA1_GetMux(channel)->CCR, pConfig->Request << DMAMUX_CxCR_DMAREQ_ID_Pos);      //Set the peripheral as DMA trigger
+
+	dma_slot[channel - 1U].Handler = pConfig->Handler;
+	dma_slot[channel - 1U].pCtx    = pConfig->pCtx;
+
+	if (pConfig->Handler != NULL) {
+		if (!shared || (pConfig->IrqPriority < dma_irq_priority[vector])) {
+			dma_irq_priority[vector] = (uint8_t)pConfig->IrqPriority;
+		}
+
+		/*
+		 * Enable NVIC IRQ
+		 */
+		HAL_NVIC_SetPriority(irqn, dma_irq_priority[vector], 0);
+		HAL_NVIC_EnableIRQ(irqn);
+	}
+
+	return channel;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_Free()
+ * Purpose  : Stop a channel and give it back
+ * Details  : EN and the DMAMUX route cleared; the shared vector
+ *            is disabled once none of its channels has a handler
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void DMA1_Free(uint32_t Channel) {
+	uint32_t vector;
+	bool     used = false;
+
+	if ((Channel == DMA1_CHANNEL_ANY) || (Channel > DMA1_CHANNELS)) {
+		return;
+	}
+
+	CLEAR_BIT(DMA1_GetChannel(Channel)->CCR, DMA_CCR_EN);
+	WRITE_REG(DMA1_GetMux(Channel)->CCR, 0U);
+	DMA1_ClearFlags(Channel, DMA_FLAG_ALL);
+
+	dma_slot[Channel - 1U].Handler = NULL;
+	dma_slot[Channel - 1U].pCtx    = NULL;
+	dma_slot[Channel - 1U].Request = 0U;
+	if (Channel == dma_adc_channel) {
+		dma_adc_channel = DMA1_CHANNEL_ANY;
+	}
+
+	vector = DMA1_Vector(Channel);
+	for (uint32_t ch = 1U; ch <= DMA1_CHANNELS; ch++) {
+		used |= (DMA1_Vector(ch) == vector) && (dma_slot[ch - 1U].Handler != NULL);
+	}
+	if (!used) {
+		HAL_NVIC_DisableIRQ(DMA1_GetIRQn(Channel));
+	}
+}
+
+uint32_t DMA1_GetAdcChannel(void) {
+	return dma_adc_channel;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_GetChannel()
+ * Purpose  : Register block of channel 1..DMA1_CHANNELS
+ * Details  : NULL for anything else. Channel blocks are 0x14
+ *            apart on the device, so no pointer arithmetic.
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+DMA_Channel_TypeDef *DMA1_GetChannel(uint32_t Channel) {
+
+	switch (Channel) {
+	case 1U: return DMA1_Channel1;
+	case 2U: return DMA1_Channel2;
+	case 3U: return DMA1_Channel3;
+	case 4U: return DMA1_Channel4;
+	case 5U: return DMA1_Channel5;
+	default: return NULL;
+	}
+}
+
+IRQn_Type DMA1_GetIRQn(uint32_t Channel) {
+	static const IRQn_Type irqn[3] = { DMA1_Channel1_IRQn, DMA1_Channel2_3_IRQn, DMA1_Ch4_5_DMAMUX1_OVR_IRQn };
+
+	return irqn[DMA1_Vector(Channel)];
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_GetFlags() / DMA1_ClearFlags()
+ * Purpose  : DMA_FLAG_x of one channel
+ * Details  : Clear writes DMA_IFCR (write 1 to clear), other
+ *            channels are untouched
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t DMA1_GetFlags(uint32_t Channel) {
+	return (DMA1->ISR >> (4U * (Channel - 1U))) & DMA_FLAG_ALL;
+}
+
+void DMA1_ClearFlags(uint32_t Channel, uint32_t Flags) {
+	WRITE_REG(DMA1->IFCR, (Flags & DMA_FLAG_ALL) << (4U * (Channel - 1U)));
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : DMA1_ConfigDataWidth()
+ * Purpose  : Match MSIZE to the buffer element, PSIZE to ADC_DR
+ * Details  : MSIZE: <= 8 bits byte, else half-word (results
+ *            never exceed ADC_DR_BITS). PSIZE stays half-word,
+ *            DMA keeps the low byte for 8-bit memory. Channel
+ *            must be disabled (EN = 0).
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+void DMA1_ConfigDataWidth(DMA_Channel_TypeDef *DMA_Channelx, uint32_t DataBits) {
+	uint32_t psize = DMA_SIZE_16BIT;
+	uint32_t msize = (DataBits > 8U) ? DMA_SIZE_16BIT : DMA_SIZE_8BIT;
+
+	MODIFY_REG(DMA_Channelx->CCR, DMA_CCR_PSIZE | DMA_CCR_MSIZE,
+	           (psize << DMA_CCR_PSIZE_Pos) | (msize << DMA_CCR_MSIZE_Pos));
 }
 
 /* ────────────────────────────────────────────────────────────── /
  * Function : ADC_Start_DMA()
  * Purpose  : Start ADC conversions with DMA
- * Details  : Configures DMA and starts ADC conversions
+ * Details  : Configures DMA and starts ADC conversions. Address
+ *            and ElementBits come from the typed wrappers below
  * Runtime  : ~X.Xxx ms
  * ────────────────────────────────────────────────────────────── */
-void ADC_Start_DMA(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint32_t *pData, uint32_t DataLength) {
+static void ADC_Start_DMA(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint32_t Address, uint32_t ElementBits, uint32_t DataLength) {
 
+	CLEAR_BIT(DMA_Channelx->CCR, DMA_CCR_EN);                     //CNDTR/CMAR are only writable with EN = 0
+	DMA1_ConfigDataWidth(DMA_Channelx, ElementBits);              //Follow the buffer element type
 
 	WRITE_REG(DMA_Channelx->CPAR, (uint32_t)&ADCx->DR);          //Set the peripheral register address in the DMA_CPARx register.
-	WRITE_REG(DMA_Channelx->CMAR, (uint32_t)pData);              //Set the memory address in the DMA_CMARx register.
+	WRITE_REG(DMA_Channelx->CMAR, Address);                      //Set the memory address in the DMA_CMARx register.
 	WRITE_REG(DMA_Channelx->CNDTR, DataLength);                  //Configure the total number of data to transfer in the DMA_CNDTRx register.
 
 
@@ -98,3 +396,76 @@ void ADC_Start_DMA(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint32_
 	SET_BIT(ADCx->CR, ADC_CR_ADSTART);                            //Starting conversions (ADSTART)
 
 }
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Start_DMA16()
+ * Purpose  : Stream ADC results into a half-word buffer
+ * Details  : Any resolution, alignment or oversampled result:
+ *            ADC1_ConfigOversampling() rejects anything wider
+ *            than ADC_DR_BITS, so this always returns true
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Start_DMA16(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint16_t *pData, uint32_t DataLength) {
+
+	ADC_Start_DMA(ADCx, DMA_Channelx, (uint32_t)pData, 16U, DataLength);
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : ADC_Start_DMA8()
+ * Purpose  : Stream ADC results into a byte buffer
+ * Details  : Packed: half the SRAM and bus traffic. Results must
+ *            fit a byte (8/6-bit right or 6-bit left aligned)
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+bool ADC_Start_DMA8(ADC_TypeDef *ADCx, DMA_Channel_TypeDef *DMA_Channelx, uint8_t *pData, uint32_t DataLength) {
+
+	if (ADC1_GetResultBits() > 8U) {
+		return false;                                             //Upper bits would be lost
+	}
+
+	ADC_Start_DMA(ADCx, DMA_Channelx, (uint32_t)pData, 8U, DataLength);
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : USART_Start_DMA()
+ * Purpose  : Send DataLength bytes from pData to USART TDR
+ * Details  : Channel set up by DMA1_InitUsartTx(). False while
+ *            the previous transfer still owns the channel.
+ *            pData must stay untouched until transfer complete.
+ * Runtime  : ~X.Xxx ms
+ * ────────────────────────────────────────────────────────────── */
+bool USART_Start_DMA(USART_TypeDef *USARTx, DMA_Channel_TypeDef *DMA_Channelx, const uint8_t *pData, uint32_t DataLength) {
+
+	if ((DMA_Channelx->CCR & DMA_CCR_EN) && (DMA_Channelx->CNDTR != 0U)) {
+		return false;                                             //Previous frame still going out
+	}
+
+	CLEAR_BIT(DMA_Channelx->CCR, DMA_CCR_EN);                     //CNDTR/CMAR are only writable with EN = 0
+
+	WRITE_REG(DMA_Channelx->CPAR, (uint32_t)&USARTx->TDR);       //Destination: transmit data register
+	WRITE_REG(DMA_Channelx->CMAR, (uint32_t)pData);              //Source: the frame in SRAM
+	WRITE_REG(DMA_Channelx->CNDTR, DataLength);
+
+	SET_BIT(DMA_Channelx->CCR, DMA_CCR_EN);                      //TXE = 1 requests the first byte at once
+
+	return true;
+}
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INTERRUPT HANDLERS                                             */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+void DMA1_Channel1_IRQHandler(void) {
+	DMA1_Dispatch(1U, 1U);
+}
+
+void DMA1_Channel2_3_IRQHandler(void) {
+	DMA1_Dispatch(2U, 3U);
+}
+
+void DMA1_Ch4_5_DMAMUX1_OVR_IRQHandler(void) {
+	DMA1_Dispatch(4U, 5U);                                        //DMAMUX overruns are not enabled
+}
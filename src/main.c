@@ -23,6 +23,19 @@
 /* USER CODE BEGIN Includes */
 #include "adc.h"
 #include "dma.h"
+#include "adc_stream.h"
+#include "adc_convert.h"
+#include "adc_queue.h"
+#include "adc_awd.h"
+#include "adc_instr.h"
+#include "adc_decim.h"
+#include "adc_stats.h"
+#include "adc_lowpower.h"
+#include "adc_export.h"
+#include "adc_capture.h"
+#include "adc_vref.h"
+#include "adc_async.h"
+#include "adc_fft.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -32,6 +45,22 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define ADC_BUFFER_LEN                       32U    // Two ping-pong blocks of 16 samples
+#define DECIM_RATIO                          8U     // CIC /4 + FIR /2: ACQ_RATE / 8, ~977 sps free-running
+#define LOW_POWER_PROFILE                    0      // 1: TIM3-paced AUTOFF/WAIT scans, Sleep between blocks
+#define EXPORT_STREAM                        0      // 1: delta-coded capture out on USART2 TX (PA2)
+#define EXPORT_BAUD                          115200U
+#define VDDA_TRACKING                        0      // 1: VREFINT scanned after CH0, mV follow the measured VDDA
+#define VDDA_WINDOW                          64U    // VREFINT samples per VDDA update (~16 ms)
+#define SPECTRUM_ANALYSIS                    0      // 1: 256-point Hann FFT of CH0, band levels per frame
+#define SPECTRUM_LOG2                        8U     // 256 points: ~30 Hz bins, a frame every ~33 ms
+#define CONVERT_BENCH                        0      // 1 (debug): time float vs fixed-point mV on the first block
+#if LOW_POWER_PROFILE
+#define ACQ_RATE                             ADC_PLAN_TARGET_SPS  // CH0 samples/s: one TIM3-paced scan each
+#else
+#define ACQ_RATE                             (ADC_PLAN_SPS / (VDDA_TRACKING ? 2U : 1U))  // CH0 samples/s in CONT
+#endif
+#define STATS_WINDOW                         (ACQ_RATE / 10U)  // 100 ms statistics windows
 
 /* USER CODE END PD */
 
@@ -43,12 +72,32 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-uint16_t adc_buffer[30];  // Make buffer global
+uint16_t adc_buffer[ADC_BUFFER_LEN];  // Make buffer global
+uint16_t adc_mV[ADC_BUFFER_LEN / 2];  // Latest block in millivolts (divider input)
+ADC_InstrSnapshot_t adc_health;       // ISR timing / loss counters, refreshed by the main loop
+#if CONVERT_BENCH
+ADC_ConvertBench_t adc_convert_bench; // Float vs fixed-point cycles, timed once on the first block
+#endif
+ADC_Decim_t adc_decim;                // Filter state carried across blocks
+int16_t adc_filtered[ADC_DECIM_OUT_MAX(ADC_BUFFER_LEN / 2, DECIM_RATIO)];  // Q15, low-rate stream
+ADC_Stats_t adc_stats;                // Min/max/mean/RMS per window, read with ADC_Stats_Get()
+ADC_LowPowerStats_t adc_energy;       // Wake-ups/s and awake cycles per block (LOW_POWER_PROFILE)
+#if VDDA_TRACKING
+uint16_t adc_ch0[ADC_BUFFER_LEN / 4];      // CH0 of the latest block (scan: CH0, VREFINT)
+uint16_t adc_vrefint[ADC_BUFFER_LEN / 4];
+ADC_VrefResult_t adc_vdda;            // Measured VDDA / scale, refreshed by the main loop
+#endif
+#if SPECTRUM_ANALYSIS
+ADC_Fft_t adc_fft;                    // Frame buffer + state, transformed in place
+ADC_FftResult_t adc_spectrum;         // Peak and band levels of the last frame (export these, not samples)
+#endif
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 /* USER CODE BEGIN PFP */
+static void ADC_BlockReady(const ADC_Block_t *pBlock);
+static void ADC_DMA_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx);
 
 /* USER CODE END PFP */
 
@@ -85,12 +134,59 @@ int main(void)
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
-  ADC1_Init();
+  ADC1_InitAsync(ADC_INIT_FLAG_CALCACHE);                       // Calibrates while the rest comes up, polled below
   DMA1_Init();
   GPIO_Init();
   /* USER CODE BEGIN 2 */
 
-  ADC_Start_DMA(ADC1, DMA1_Channel1, (uint32_t*)adc_buffer, 30);
+  {
+	  const DMA_ChannelConfig_t adc_dma = { .Channel = DMA1_CHANNEL_ANY, .Priority = DMA_PRIORITY_HIGH,
+	                                        .IrqPriority = 1U, .Handler = ADC_DMA_IRQHandler };
+
+	  DMA1_InitAdc(&adc_dma);                                   // Channel1 when free: own vector for capture
+  }
+
+  while (ADC1_InitPoll() < ADC_INIT_READY) {
+	  // Regulator start-up / calibration still running (skipped on warm boot)
+  }
+  if (ADC1_InitPoll() == ADC_INIT_ERROR) {
+	  Error_Handler();                                          // ADCAL could not start
+  }
+
+#if VDDA_TRACKING
+  {
+	  ADC_ScanConfig_t scan = { .Mode = ADC_SCAN_SEQUENCE, .NumChannels = 1U, .Channels = { 0U },
+	                            .SampleTime = { (ADC_SampleTime_t)ADC_PLAN_SMP } };
+
+	  ADC_Vref_AddChannels(&scan, false);                       // 2-channel scan: blocks hold whole scans
+	  ADC1_ConfigScan(&scan);
+	  ADC_Vref_Start(VDDA_WINDOW);                              // VREFEN while ADSTART = 0
+  }
+#endif
+  ADC_Decim_Init(&adc_decim, DECIM_RATIO, ADC1_GetResultBits());
+  ADC_Stats_Init(&adc_stats, 1U, STATS_WINDOW, NULL);
+#if SPECTRUM_ANALYSIS
+  {
+	  const uint32_t  rate = ACQ_RATE;                          // CH0 rate of the chosen profile
+	  ADC_FftConfig_t fft = { .Log2Points = SPECTRUM_LOG2, .Window = ADC_FFT_WINDOW_HANN,
+	                          .InputBits = ADC1_GetResultBits(), .Channels = VDDA_TRACKING ? 2U : 1U,
+	                          .NumBands = 3U };
+
+	  fft.Bands[0] = (ADC_FftBand_t){ 1U, ADC_FFT_BIN(200U, rate, SPECTRUM_LOG2) };        // Mains + harmonics
+	  fft.Bands[1] = (ADC_FftBand_t){ fft.Bands[0].High + 1U, ADC_FFT_BIN(1000U, rate, SPECTRUM_LOG2) };
+	  fft.Bands[2] = (ADC_FftBand_t){ fft.Bands[1].High + 1U, 1U << (SPECTRUM_LOG2 - 1U) };  // Up to Nyquist
+	  ADC_Fft_Init(&adc_fft, &fft);
+  }
+#endif
+  ADC_Queue_Reset();
+  ADC_Instr_Start(ADC_BUFFER_LEN / 2);
+#if EXPORT_STREAM
+  ADC_Export_Init(EXPORT_BAUD, ADC_PACK_DELTA, ADC1_GetResultBits());  // ~8 bits/sample: fits 115200 baud
+#endif
+#if LOW_POWER_PROFILE
+  ADC_LowPower_Start(ACQ_RATE, SystemClock_Config, NULL);   // ADC powered down between scans
+#endif
+  ADC_Stream_Start(adc_buffer, ADC_BUFFER_LEN, ADC_BlockReady);
 
   /* USER CODE END 2 */
 
@@ -101,6 +197,57 @@ int main(void)
     /* USER CODE END WHILE */
 	
     /* USER CODE BEGIN 3 */
+	ADC_Block_t block;
+	bool        processed = false;
+
+	while (ADC_Queue_Pop(&block)) {                               // Blocks published by the DMA ISR
+#if CONVERT_BENCH
+		if (adc_convert_bench.Samples == 0U) {
+			ADC_Convert_Benchmark(block.pData, block.Length, &adc_convert_bench);  // Once, on real samples
+		}
+#endif
+#if VDDA_TRACKING
+		uint16_t *const channels[2] = { adc_ch0, adc_vrefint };
+		uint32_t        n;
+
+		ADC_Vref_Update(block.pData, block.Length);               // One add per scan, VDDA once per window
+		ADC_Vref_Convert_Block_mV(block.pData, adc_mV, block.Length);  // Even entries CH0, odd VREFINT
+		n = ADC_Scan_Deinterleave(block.pData, block.Length, channels);
+		ADC_Decim_Process(&adc_decim, adc_ch0, n, adc_filtered);
+		ADC_Stats_Update(&adc_stats, adc_ch0, n);
+#else
+		ADC_Convert_Block_mV(block.pData, adc_mV, block.Length);  // Integer only, no soft-float
+		ADC_Decim_Process(&adc_decim, block.pData, block.Length, adc_filtered);
+		ADC_Stats_Update(&adc_stats, block.pData, block.Length);  // Single pass, no rescan of adc_buffer
+#endif
+#if SPECTRUM_ANALYSIS
+		ADC_Fft_Update(&adc_fft, block.pData, block.Length);      // CH0 at scan position 0, FFT per full frame
+#endif
+#if EXPORT_STREAM
+		ADC_Export_Block(block.pData, block.Length);              // Encoded into the frame the DMA sends
+#endif
+		ADC_Stream_Release(&block);
+#if LOW_POWER_PROFILE
+		ADC_LowPower_BlockDone();
+#endif
+		processed = true;
+	}
+
+	if (processed) {
+		ADC_Instr_GetSnapshot(&adc_health);                       // Export point (debugger / telemetry)
+#if LOW_POWER_PROFILE
+		ADC_LowPower_GetStats(&adc_energy);
+#endif
+#if VDDA_TRACKING
+		ADC_Vref_Get(&adc_vdda);
+#endif
+#if SPECTRUM_ANALYSIS
+		ADC_Fft_Get(&adc_fft, &adc_spectrum);
+#endif
+	}
+#if LOW_POWER_PROFILE
+	ADC_LowPower_Idle(ADC_Queue_Depth);                           // Sleep until the next block (or tick)
+#endif
   }
   /* USER CODE END 3 */
 }
@@ -147,12 +294,36 @@ void SystemClock_Config(void)
 
 /* USER CODE BEGIN 4 */
 
-void DMA1_Channel1_IRQHandler(void)
+static void ADC_DMA_IRQHandler(uint32_t Channel, uint32_t Flags, void *pCtx)
 {
-	if (DMA1->ISR & DMA_ISR_TCIF1) {      // Transfer Complete flag
-		DMA1->IFCR = DMA_IFCR_CTCIF1;     // Clear the flag
+	(void)Channel;
+	(void)pCtx;
+	ADC_INSTR_ENTER(ADC_INSTR_ISR_DMA);   // Latency from CNDTR, duration from SysTick
+	if (!ADC_Capture_IRQHandler(Flags)) { // Triggered capture armed: it owns the channel
+		ADC_Stream_IRQHandler(Flags);     // Half/Transfer Complete -> ping-pong block
+	}
+	ADC_INSTR_EXIT(ADC_INSTR_ISR_DMA);
+}
 
-		float VrefInt = (V_REF_plus * ADC1_Read() / 4095) * (47+10)/10;
+void ADC1_IRQHandler(void)
+{
+	ADC_INSTR_ENTER(ADC_INSTR_ISR_ADC);
+	ADC1_Init_IRQHandler();               // EOCAL / ADRDY during bring-up
+	ADC_Async_IRQHandler();               // EOC / EOS / OVR of interrupt-driven sampling: takes DR first
+	ADC_AWD_IRQHandler();                 // Analog watchdog window events, re-reads the sample in DR
+	ADC_INSTR_EXIT(ADC_INSTR_ISR_ADC);
+}
+
+static void ADC_BlockReady(const ADC_Block_t *pBlock)
+{
+	/*
+	 * ISR context: only publish the descriptor, processing runs in while(1).
+	 * pBlock->pData stays stable until released: DMA is filling the other half.
+	 */
+	if (!ADC_Queue_Push(pBlock)) {
+		ADC_Stream_Release(pBlock);       // Dropped: give the block straight back to the DMA
+	}
+}
 
 /* USER CODE END 4 */
 
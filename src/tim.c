@@ -0,0 +1,103 @@
+
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: tim.c                                ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: January 20, 2026                     ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 TIM Driver - ADC Trigger Timebase                         ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This driver programs TIM3 as a free-running timebase whose update event is routed to TRGO and used       *
+ * as the ADC external trigger (EXTSEL = 011).                                                              *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - Picks PSC/ARR for a requested rate and reports the exact achieved rate.                              *
+ *   - TRGO on update (MMS = 010), no interrupts, no CPU involvement per sample.                            *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - TIM3 kernel clock is PCLK, doubled when the APB prescaler is not 1.                                  *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "tim.h"
+#include "stm32g030xx.h"
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : TIM3_GetClockHz()
+ * Purpose  : TIM3 kernel clock frequency
+ * Details  : PCLK x1 if APB prescaler = 1, else PCLK x2
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t TIM3_GetClockHz(void) {
+	uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+
+	if (RCC->CFGR & RCC_CFGR_PPRE_2) {                            //1xx: HCLK divided
+		pclk *= 2U;
+	}
+	return pclk;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : TIM3_ConfigTRGO()
+ * Purpose  : Program TIM3 update rate and route it to TRGO
+ * Details  : Rounds to the nearest reachable rate, timer stopped
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool TIM3_ConfigTRGO(uint32_t RateHz, TIM_Timebase_t *pTimebase) {
+	uint32_t clock = TIM3_GetClockHz();
+	uint32_t ticks, psc, arr;
+
+	if ((RateHz == 0U) || (RateHz > TIM_TRGO_MAX_HZ) || (RateHz > clock / 2U)) {
+		return false;
+	}
+
+	ticks = (clock + RateHz / 2U) / RateHz;                       //Timer clocks per trigger, rounded
+	psc   = (ticks - 1U) / 65536U;                                //Smallest prescaler that lets ARR fit 16 bits
+	arr   = ((ticks + (psc + 1U) / 2U) / (psc + 1U)) - 1U;
+
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_TIM3EN);                    //TIM3 clock enable
+
+	CLEAR_BIT(TIM3->CR1, TIM_CR1_CEN);                            //Counter stopped while configuring
+	WRITE_REG(TIM3->PSC, psc);
+	WRITE_REG(TIM3->ARR, arr);
+	SET_BIT(TIM3->CR1, TIM_CR1_ARPE);                             //1: ARR preload
+	MODIFY_REG(TIM3->CR2, TIM_CR2_MMS, TIM_CR2_MMS_1);            //010: Update event -> TRGO
+	WRITE_REG(TIM3->EGR, TIM_EGR_UG);                             //Load PSC/ARR shadow registers
+	WRITE_REG(TIM3->CNT, 0);
+
+	if (pTimebase != NULL) {
+		pTimebase->TimerClockHz    = clock;
+		pTimebase->Divider         = (psc + 1U) * (arr + 1U);
+		pTimebase->AchievedMilliHz = (uint32_t)(((uint64_t)clock * 1000U + pTimebase->Divider / 2U) / pTimebase->Divider);
+	}
+
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : TIM3_Start()
+ * Purpose  : Start the trigger timebase
+ * Details  : First TRGO after one full period
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void TIM3_Start(void) {
+
+	SET_BIT(TIM3->CR1, TIM_CR1_CEN);
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : TIM3_Stop()
+ * Purpose  : Stop the trigger timebase
+ * Details  : Counter keeps its value
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+void TIM3_Stop(void) {
+
+	CLEAR_BIT(TIM3->CR1, TIM_CR1_CEN);
+}
@@ -0,0 +1,76 @@
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+/*                                                                                                          *
+ *              ╔═════════════════════════════════════════════════════════════════════════╗                 *
+ *               ║                            FILE: usart.c                              ║                  *
+ *               ║                            AUTHOR: Lovejoy Mhishi                     ║                  *
+ *               ║                            DATE: February 16, 2026                    ║                  *
+ *              ╠═════════════════════════════════════════════════════════════════════════╣                 *
+ *               ║       STM32 USART Driver - DMA Transmit Link                          ║                  *
+ *              ╚═════════════════════════════════════════════════════════════════════════╝                 *
+ * This driver brings up USART2 as a transmit-only link: 8N1, oversampling by 16, TX on PA2 (AF1), with     *
+ * DMA transmit requests enabled. Bytes are moved by DMA1 Channel2 (see USART_Start_DMA() in dma.c).        *
+ *                                                                                                          *
+ * Key Features:                                                                                            *
+ *   - BRR rounded to the nearest divider, the achieved baud rate is reported.                              *
+ *   - No receive path, no USART interrupts: completion comes from the DMA channel.                         *
+ *                                                                                                          *
+ * Notes:                                                                                                   *
+ *   - The kernel clock is PCLK (RCC_CCIPR USART2SEL reset value). BRR is only writable with UE = 0.        *
+ *                                                                                                          */
+/* ******************* ──────────────────────────────────────────────────────────────── ******************* */
+
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+/* 																											*/
+/*                                           INCLUDES                                                       */
+/*                                                                                  						*/
+/* ──────────────────────────────────────────────────────────────────────────────────────────────────────── */
+#include "usart.h"
+#include "stm32g030xx.h"
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : USART2_InitTx()
+ * Purpose  : PA2 as USART2_TX, 8N1 at Baud, DMA transmit
+ * Details  : False if Baud is 0 or above PCLK / 16
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+bool USART2_InitTx(uint32_t Baud, uint32_t *pAchievedBaud) {
+	uint32_t pclk = HAL_RCC_GetPCLK1Freq();
+	uint32_t brr;
+
+	if ((Baud == 0U) || (Baud > pclk / USART_BRR_MIN)) {
+		return false;
+	}
+	brr = (pclk + Baud / 2U) / Baud;
+	if (brr > 0xFFFFU) {
+		return false;
+	}
+
+	SET_BIT(RCC->IOPENR, RCC_IOPENR_GPIOAEN);                     //GPIOA clock enable
+	SET_BIT(RCC->APBENR1, RCC_APBENR1_USART2EN);                  //USART2 clock enable
+
+	MODIFY_REG(GPIOA->AFR[0], GPIO_AFRL_AFSEL2, 1UL << GPIO_AFRL_AFSEL2_Pos);  //AF1: USART2_TX
+	MODIFY_REG(GPIOA->MODER, GPIO_MODER_MODE2, GPIO_MODER_MODE2_1);           //10: Alternate function
+
+	CLEAR_BIT(USART2->CR1, USART_CR1_UE);                         //BRR is only writable with UE = 0
+	WRITE_REG(USART2->BRR, brr);
+	SET_BIT(USART2->CR3, USART_CR3_DMAT);                         //1: TXE raises a DMA request
+	SET_BIT(USART2->CR1, USART_CR1_TE);                           //1: Transmitter EN
+	SET_BIT(USART2->CR1, USART_CR1_UE);                           //1: USART EN
+
+	if (pAchievedBaud != NULL) {
+		*pAchievedBaud = pclk / brr;
+	}
+	return true;
+}
+
+/* ────────────────────────────────────────────────────────────── /
+ * Function : USART2_BytesPerSecond()
+ * Purpose  : Link capacity at the programmed BRR
+ * Details  : PCLK / (BRR * 10), 0 while BRR is not set
+ * Runtime  : ~X.Xxx
+ * ────────────────────────────────────────────────────────────── */
+uint32_t USART2_BytesPerSecond(void) {
+	uint32_t brr = USART2->BRR & 0xFFFFU;
+
+	return (brr != 0U) ? HAL_RCC_GetPCLK1Freq() / (brr * USART_FRAME_BITS) : 0U;
+}